@@ -0,0 +1,299 @@
+/*
+ * Name: flight_recorder.c
+ *
+ * Description:
+ * All Flight Recorder functions and variables are defined in this file.
+ *
+ * Author: Hemant Pundpal                                 Date: 19 Oct 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#define RB_SOURCE_CODE
+#define FR_SOURCE_CODE
+
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "flight_recorder_api.h"
+#include "ring_buffer.h"
+#include "flight_recorder.h"
+
+#if (0 < FLIGHT_RECORDER_TSC_TIME_STAMP)
+#include <x86intrin.h>
+#endif /* FLIGHT_RECORDER_TSC_TIME_STAMP */
+
+
+/* Registered flight recorders (rings remain available to the dump after the thread exits) */
+static fr_t * gp_flight_recorder_list[FLIGHT_RECORDER_MAX_THREAD_COUNT];
+
+/* Registered flight recorder count, published after the flight recorder is added to the list */
+static atomic_uint g_flight_recorder_count = 0;
+
+/* Registration is not the hot path, protect creation of the ring buffers */
+static pthread_mutex_t g_flight_recorder_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Flight recorder of the calling thread */
+static _Thread_local fr_t * tp_flight_recorder = NULL;
+
+/* Set while a dump is running, the snapshots of the flight recorders are used by one dump at a time (lock free) */
+static atomic_flag g_flight_recorder_dump_in_progress = ATOMIC_FLAG_INIT;
+
+/* Get the event time stamp. */
+static uint64_t get_time_stamp(void);
+
+/* Take a consistent snapshot of the flight recorder ring. */
+static void take_flight_recorder_snapshot(fr_t * p_flight_recorder);
+
+/* Write an event record to the dump file descriptor. */
+static uint32_t write_flight_recorder_record(int dump_file_descriptor, const fr_event_t * p_event);
+
+/* Function to register the calling thread with the flight recorder */
+uint32_t register_flight_recorder_thread(void)
+{
+    uint32_t status = FR_FAIL;
+
+    if (tp_flight_recorder != NULL)
+    {
+        return FR_ALREADY_REGISTERED;
+    }
+
+    pthread_mutex_lock(&g_flight_recorder_mutex);
+
+    uint32_t recorder_id = atomic_load_explicit(&g_flight_recorder_count, memory_order_relaxed);
+
+    /* Check conditions are OK */
+    if (recorder_id < FLIGHT_RECORDER_MAX_THREAD_COUNT)
+    {
+        /* Allocate the memory for the flight recorder and the dump snapshot */
+        fr_t * p_flight_recorder = (fr_t *)allocate_ring_buffer_memory(NULL, sizeof(fr_t));
+        fr_event_t * p_snapshot = (fr_event_t *)allocate_ring_buffer_memory(NULL, (FLIGHT_RECORDER_EVENT_COUNT * sizeof(fr_event_t)));
+
+        if ((p_flight_recorder != NULL) && (p_snapshot != NULL))
+        {
+            rgbf_t * p_ring_buffer = NULL;
+
+            /* Ring size is a multiple of the event size, so an over write always drops whole events. */
+            status = create_ring_buffer(&p_ring_buffer, FLIGHT_RECORDER_RING_SIZE);
+
+            if (RB_SUCCESS == status)
+            {
+                /* Initialize the flight recorder */
+                p_flight_recorder->recorder_id = recorder_id;
+                p_flight_recorder->p_ring_buffer = p_ring_buffer;
+                p_flight_recorder->p_snapshot = p_snapshot;
+                atomic_init(&p_flight_recorder->write_sequence, 0U);
+
+                /* Add to the list, then publish the count so the dump sees an initialized flight recorder. */
+                gp_flight_recorder_list[recorder_id] = p_flight_recorder;
+                atomic_store_explicit(&g_flight_recorder_count, (recorder_id + 1U), memory_order_release);
+
+                tp_flight_recorder = p_flight_recorder;
+
+                status = FR_SUCCESS;
+            }
+            else
+            {
+                status = (RB_MAX_OUT_ERROR == status) ? FR_MAX_OUT_ERROR : FR_NO_MEMORY_ERROR;
+            }
+        }
+        else
+        {
+            status = FR_NO_MEMORY_ERROR;
+        }
+
+        if (FR_SUCCESS != status)
+        {
+            free_ring_buffer_memory(NULL, p_snapshot);
+            free_ring_buffer_memory(NULL, p_flight_recorder);
+        }
+    }
+    else
+    {
+        status = FR_MAX_OUT_ERROR;
+    }
+
+    pthread_mutex_unlock(&g_flight_recorder_mutex);
+
+    /* Return Status */
+    return status;
+}
+
+/* Function to write an event to the calling thread ring */
+uint32_t write_flight_recorder_event(uint32_t event_id, uint64_t event_data_0, uint64_t event_data_1)
+{
+    fr_t * p_flight_recorder = tp_flight_recorder;
+
+    if (p_flight_recorder == NULL)
+    {
+        return FR_NOT_REGISTERED;
+    }
+
+    fr_event_t event;
+    event.time_stamp = get_time_stamp();
+    event.recorder_id = p_flight_recorder->recorder_id;
+    event.event_id = event_id;
+    event.event_data_0 = event_data_0;
+    event.event_data_1 = event_data_1;
+
+    /* Only the owner thread writes the sequence, mark write in progress (odd). */
+    uint32_t sequence = atomic_load_explicit(&p_flight_recorder->write_sequence, memory_order_relaxed);
+    atomic_store_explicit(&p_flight_recorder->write_sequence, (sequence + 1U), memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    /* Over write the oldest event when the ring is full. */
+    block_write_to_ring_buffer(p_flight_recorder->p_ring_buffer, (const uint8_t *)&event, (uint32_t)sizeof(fr_event_t), TRUE);
+
+    /* Write complete (even). */
+    atomic_store_explicit(&p_flight_recorder->write_sequence, (sequence + 2U), memory_order_release);
+
+    return FR_SUCCESS;
+}
+
+/* Function to dump the events of all registered threads into the file descriptor */
+uint32_t dump_flight_recorder(int dump_file_descriptor)
+{
+    uint32_t status = FR_SUCCESS;
+    uint32_t flight_recorder_count = atomic_load_explicit(&g_flight_recorder_count, memory_order_acquire);
+
+    /* Only one dump at a time, a second dump (e.g. a signal while dumping) would over write the snapshots. */
+    if (atomic_flag_test_and_set_explicit(&g_flight_recorder_dump_in_progress, memory_order_acquire))
+    {
+        return FR_DUMP_IN_PROGRESS;
+    }
+
+    /* Snapshot all the rings first, then merge by time stamp. */
+    for (uint32_t i = 0; i < flight_recorder_count; i++)
+    {
+        take_flight_recorder_snapshot(gp_flight_recorder_list[i]);
+    }
+
+    while (FR_SUCCESS == status)
+    {
+        fr_t * p_oldest = NULL;
+
+        /* Find the oldest event at the head of each snapshot (ties are dumped in recorder order). */
+        for (uint32_t i = 0; i < flight_recorder_count; i++)
+        {
+            fr_t * p_flight_recorder = gp_flight_recorder_list[i];
+
+            if (p_flight_recorder->snapshot_index < p_flight_recorder->snapshot_count)
+            {
+                if ((p_oldest == NULL) ||
+                    (p_flight_recorder->p_snapshot[p_flight_recorder->snapshot_index].time_stamp <
+                     p_oldest->p_snapshot[p_oldest->snapshot_index].time_stamp))
+                {
+                    p_oldest = p_flight_recorder;
+                }
+            }
+        }
+
+        /* All events dumped. */
+        if (p_oldest == NULL)
+        {
+            break;
+        }
+
+        status = write_flight_recorder_record(dump_file_descriptor, &p_oldest->p_snapshot[p_oldest->snapshot_index]);
+
+        p_oldest->snapshot_index++;
+    }
+
+    atomic_flag_clear_explicit(&g_flight_recorder_dump_in_progress, memory_order_release);
+
+    /* Return Status */
+    return status;
+}
+
+/* local / internal function to get the event time stamp */
+static uint64_t get_time_stamp(void)
+{
+#if (0 < FLIGHT_RECORDER_TSC_TIME_STAMP)
+    return (uint64_t)__rdtsc();
+#else
+    struct timespec time_now;
+
+    /* CLOCK_MONOTONIC is served from the vDSO on Linux, it is not a system call. */
+    clock_gettime(CLOCK_MONOTONIC, &time_now);
+
+    return ((uint64_t)time_now.tv_sec * 1000000000ULL) + (uint64_t)time_now.tv_nsec;
+#endif /* FLIGHT_RECORDER_TSC_TIME_STAMP */
+}
+
+/* local / internal function to take a consistent snapshot of the flight recorder ring */
+static void take_flight_recorder_snapshot(fr_t * p_flight_recorder)
+{
+    rgbf_t * p_ring_buffer = p_flight_recorder->p_ring_buffer;
+
+    for (uint32_t attempt = 0; attempt < FLIGHT_RECORDER_SNAPSHOT_RETRY; attempt++)
+    {
+        uint32_t sequence = atomic_load_explicit(&p_flight_recorder->write_sequence, memory_order_acquire);
+
+        uint32_t write_index = p_ring_buffer->write_index;
+        uint32_t read_index = p_ring_buffer->read_index;
+        uint32_t used_size = 0;
+
+        if (p_ring_buffer->b_data_unread == TRUE)
+        {
+            /* read and write index are same when the ring is full. */
+            used_size = (read_index < write_index) ?
+                (write_index - read_index) :
+                (p_ring_buffer->buffer_size - (read_index - write_index));
+        }
+
+        /* Events never straddle the end of the ring, copy the two parts. */
+        uint32_t first_size = ((read_index + used_size) > p_ring_buffer->buffer_size) ?
+            (p_ring_buffer->buffer_size - read_index) : used_size;
+
+        memcpy(p_flight_recorder->p_snapshot, &p_ring_buffer->p_buffer[read_index], first_size);
+        memcpy(((uint8_t *)p_flight_recorder->p_snapshot) + first_size, p_ring_buffer->p_buffer, (used_size - first_size));
+
+        p_flight_recorder->snapshot_count = used_size / (uint32_t)sizeof(fr_event_t);
+        p_flight_recorder->snapshot_index = 0;
+
+        atomic_thread_fence(memory_order_acquire);
+
+        /*
+         * Snapshot is consistent if no write was in progress or completed while copying.
+         * Otherwise retry, the last attempt is kept (best effort, e.g. the thread crashed while writing).
+         */
+        if (((sequence & 1U) == 0U) &&
+            (sequence == atomic_load_explicit(&p_flight_recorder->write_sequence, memory_order_relaxed)))
+        {
+            break;
+        }
+    }
+}
+
+/* local / internal function to write an event record to the dump file descriptor (write is async signal safe, stdio is not) */
+static uint32_t write_flight_recorder_record(int dump_file_descriptor, const fr_event_t * p_event)
+{
+    uint32_t status = FR_SUCCESS;
+    const uint8_t * p_record = (const uint8_t *)p_event;
+    size_t written_size = 0;
+
+    while ((FR_SUCCESS == status) && (written_size < sizeof(fr_event_t)))
+    {
+        ssize_t size = write(dump_file_descriptor, &p_record[written_size], (sizeof(fr_event_t) - written_size));
+
+        if (size > 0)
+        {
+            written_size += (size_t)size;
+        }
+        else if ((size < 0) && (EINTR == errno))
+        {
+            /* Interrupted before anything was written, write again. */
+        }
+        else
+        {
+            status = FR_FILE_WRITE_ERROR;
+        }
+    }
+
+    /* Return Status */
+    return status;
+}
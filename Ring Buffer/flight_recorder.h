@@ -0,0 +1,61 @@
+/*
+ * Name: flight_recorder.h
+ *
+ * Description:
+ * All definition and function declarations required by the flight recorder module are
+ * in this file.
+ * Application code should not #include this file to use the flight recorder api.
+ *
+ * Author: Hemant Pundpal                                 Date: 19 Oct 2026
+ *
+ */
+
+#ifndef __FLIGHT_RECORDER__
+#define __FLIGHT_RECORDER__
+
+#include <stdatomic.h>
+
+/*
+ * Size of the thread ring in octets. Do not modify this value.
+ * Note: The thread rings are created with the core create_ring_buffer function, they are not limited to RINGBUFFER_SIZE_MAX.
+ */
+#define FLIGHT_RECORDER_RING_SIZE       (FLIGHT_RECORDER_EVENT_COUNT * (uint32_t)sizeof(fr_event_t))
+
+/* Number of attempts to take a consistent snapshot of a ring that is being written. */
+#define FLIGHT_RECORDER_SNAPSHOT_RETRY  4U
+
+/* Flight recorder (one per registered thread). */
+typedef struct flight_recorder
+{
+    uint32_t       recorder_id;
+    rgbf_t       * p_ring_buffer;
+
+    /*
+     * Write sequence, odd while the owner thread is writing an event. The dump uses it to
+     * detect a torn snapshot (the owner thread never waits for the dump).
+     */
+    atomic_uint    write_sequence;
+
+    /* Snapshot of the ring taken by the dump (allocated at registration, dump does not allocate). */
+    fr_event_t   * p_snapshot;
+    uint32_t       snapshot_count;
+    uint32_t       snapshot_index;
+
+}fr_t;
+
+
+/* Function to register the calling thread with the flight recorder */
+uint32_t register_flight_recorder_thread(void);
+
+/* Function to write an event to the calling thread ring */
+uint32_t write_flight_recorder_event(uint32_t event_id, uint64_t event_data_0, uint64_t event_data_1);
+
+/* Function to dump the events of all registered threads into the file descriptor */
+uint32_t dump_flight_recorder(int dump_file_descriptor);
+
+
+
+/* Error check for dump the flight recorder function */
+uint32_t dump_flight_recorder_ec(int dump_file_descriptor);
+
+#endif /* __FLIGHT_RECORDER__ */
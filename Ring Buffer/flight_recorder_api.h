@@ -0,0 +1,123 @@
+/*
+ * Name: flight_recorder_api.h
+ *
+ * Description:
+ * All definitions and api function declarations required by the application to use the flight recorder.
+ * The flight recorder keeps a private over write mode ring buffer per thread with fixed format, time
+ * stamped binary events. The rings of all threads can be dumped (merged by time stamp) into a file.
+ * Application code should #include this file to use the flight recorder api.
+ *
+ * Author: Hemant Pundpal                                 Date: 19 Oct 2026
+ *
+ */
+
+#ifndef __FLIGHT_RECORDER_API__
+#define __FLIGHT_RECORDER_API__
+
+
+#include "ring_buffer_api.h"
+
+/*
+ * Number of events each thread ring can hold before the oldest event is over written.
+ * This value can be modified as per platform and application requirements.
+ */
+#define FLIGHT_RECORDER_EVENT_COUNT         1024U
+
+/*
+ * Maximum number of threads that can register with the flight recorder. This value can be
+ * modified as per platform and application requirements.
+ */
+#define FLIGHT_RECORDER_MAX_THREAD_COUNT    16U
+
+/*
+ * Time stamp source. Events are time stamped with the monotonic clock (nano seconds) by default.
+ * Setting FLIGHT_RECORDER_TSC_TIME_STAMP to 1 time stamps events with the x86 time stamp counter,
+ * which is cheaper to read (time stamps are then in counter ticks).
+ */
+#define FLIGHT_RECORDER_TSC_TIME_STAMP      0
+
+
+/* Flight Recorder API Return values */
+#define FR_SUCCESS                  0x0U
+#define FR_NOT_REGISTERED           0x1U
+#define FR_ALREADY_REGISTERED       0x2U
+#define FR_MAX_OUT_ERROR            0x3U
+#define FR_NO_MEMORY_ERROR          0x4U
+#define FR_FILE_DESCRIPTOR_INVALID  0x5U
+#define FR_FILE_WRITE_ERROR         0x6U
+#define FR_DUMP_IN_PROGRESS         0x7U
+
+#define FR_FAIL                     0xFFFFFFFFU
+
+/*
+ * Flight recorder event. Fixed format (32 octets), this is also the record format of the dump file.
+ * - time_stamp: monotonic clock in nano seconds (or counter ticks), set by the flight recorder.
+ * - recorder_id: id of the thread ring that recorded the event, set by the flight recorder.
+ * - event_id, event_data_0, event_data_1: application defined.
+ */
+typedef struct flight_recorder_event
+{
+    uint64_t     time_stamp;
+    uint32_t     recorder_id;
+    uint32_t     event_id;
+    uint64_t     event_data_0;
+    uint64_t     event_data_1;
+
+}fr_event_t;
+
+
+/*
+ * Defines the flight recorder api mapping based on error checking selected by the user.
+ * This section is only applicable to the application that is using the flight recorder api.
+ * This section (FR_SOURCE_CODE) is turned off for the flight recorder implementation source code.
+ */
+#ifndef FR_SOURCE_CODE
+
+/*
+ * Determines if error checking is desired. If so, map flight recorder api function to appropriate
+ * error checking front-ends. Otherwise, map API functions to core functions that actually perform
+ * the work.
+ *
+ * Note: The write event function is never error checked, it is the hot path.
+ */
+#if (0 < DISABLE_ERROR_CHECK)
+
+/* Api functions without error checking. */
+
+#define register_flight_recorder_thread     register_flight_recorder_thread
+#define write_flight_recorder_event         write_flight_recorder_event
+#define dump_flight_recorder                dump_flight_recorder
+
+#else
+
+/* Api functions with error checking. */
+
+#define register_flight_recorder_thread     register_flight_recorder_thread
+#define write_flight_recorder_event         write_flight_recorder_event
+#define dump_flight_recorder                dump_flight_recorder_ec
+
+#endif /* DISABLE_ERROR_CHECK */
+
+/*
+ * Register the calling thread with the flight recorder (creates the thread private ring).
+ * Each thread must register once before writing events.
+ */
+uint32_t register_flight_recorder_thread(void);
+
+/*
+ * Write an event to the calling thread ring (over writes the oldest event when the ring is full).
+ * No locks and no system calls are used, the ring is private to the calling thread.
+ */
+uint32_t write_flight_recorder_event(uint32_t event_id, uint64_t event_data_0, uint64_t event_data_1);
+
+/*
+ * Dump the events of all registered threads, merged by time stamp (oldest first), into the file descriptor as fr_event_t records.
+ * Note: no memory is allocated and no stdio is used (records are written with write), the file should be opened before the
+ * dump is required, e.g. in a crash or signal handler. One dump runs at a time, a dump started while another dump is running
+ * (e.g. from a signal handler or another thread) returns FR_DUMP_IN_PROGRESS.
+ */
+uint32_t dump_flight_recorder(int dump_file_descriptor);
+
+#endif /* FR_SOURCE_CODE */
+
+#endif /* __FLIGHT_RECORDER_API__ */
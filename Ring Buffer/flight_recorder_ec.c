@@ -0,0 +1,33 @@
+/*
+ * Name: flight_recorder_ec.c
+ *
+ * Description:
+ * All Flight Recorder error checking functions and are defined in this file.
+ *
+ * Author: Hemant Pundpal                            Date: 19 Oct 2026
+ *
+ */
+
+#define RB_SOURCE_CODE
+#define FR_SOURCE_CODE
+
+#include "flight_recorder_api.h"
+#include "flight_recorder.h"
+#include "error_assert.h"
+
+/* Error check for dump the flight recorder function */
+uint32_t dump_flight_recorder_ec(int dump_file_descriptor)
+{
+    /* Check if file descriptor is valid */
+    assert(dump_file_descriptor < 0);
+    if (dump_file_descriptor < 0)
+    {
+        return FR_FILE_DESCRIPTOR_INVALID;
+    }
+
+    uint32_t status = FR_FAIL;
+    status = dump_flight_recorder(dump_file_descriptor);
+
+    /* Return Status */
+    return status;
+}
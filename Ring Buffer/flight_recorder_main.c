@@ -0,0 +1,268 @@
+/*
+ * Name: flight_recorder_main.c
+ *
+ * Description:
+ * THIS IS A DEMO CODE JUST TO EXCERCISE / DEMONSTRATE THE FLIGHT RECORDER API
+ * (thread registration, over write of the oldest events, dump while the threads write, merged dump in time stamp order,
+ * FR_DUMP_IN_PROGRESS).
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "flight_recorder_api.h"
+
+/* Number of threads writing events (the main thread also registers). */
+#define FR_DEMO_THREAD_COUNT        4U
+
+/* Events written by each thread, more than the ring holds so the oldest events are over written. */
+#define FR_DEMO_EVENT_COUNT         (FLIGHT_RECORDER_EVENT_COUNT + (FLIGHT_RECORDER_EVENT_COUNT / 2U))
+
+/* Event ids of the demo events (event_data_0 is the event sequence number of the thread). */
+#define FR_DEMO_EVENT_MAIN          0x10U
+#define FR_DEMO_EVENT_THREAD        0x20U
+
+/* Sleep between the events written while the flight recorder is dumped (micro seconds). */
+#define FR_DEMO_WRITE_PACE_US       20U
+
+/* Result of the check of a dump. */
+typedef struct fr_demo_dump_check
+{
+    uint32_t     record_count;
+    uint32_t     recorder_event_count[FLIGHT_RECORDER_MAX_THREAD_COUNT];
+    uint64_t     recorder_last_sequence[FLIGHT_RECORDER_MAX_THREAD_COUNT];
+    bool_t       b_time_stamp_order;
+    bool_t       b_sequence_order;
+
+}fr_demo_dump_check_t;
+
+/* Writer thread, registers, writes the events and then keeps writing paced events until stopped. */
+static void * fr_demo_writer_thread(void * p_argument);
+
+/* Dump thread, dumps into a pipe that is read only after the main thread got FR_DUMP_IN_PROGRESS. */
+static void * fr_demo_dump_thread(void * p_argument);
+
+/* Dump the flight recorder into a temporary file and check the records. */
+static uint32_t fr_demo_dump_and_check(fr_demo_dump_check_t * p_dump_check);
+
+/* Read the dump records from the file descriptor and check them (time stamp order, sequence of each thread). */
+static void fr_demo_check_records(int dump_file_descriptor, fr_demo_dump_check_t * p_dump_check);
+
+/* Writer threads wait here after the events are written, and again before the paced events are written. */
+static pthread_barrier_t g_fr_demo_barrier;
+
+/* Set to stop the paced events of the writer threads. */
+static atomic_uint g_fr_demo_stop = 0U;
+
+int main(void)
+{
+    pthread_t writer_threads[FR_DEMO_THREAD_COUNT];
+    pthread_t dump_thread;
+    fr_demo_dump_check_t dump_check;
+    uint32_t status = FR_FAIL;
+
+    /* Registration. */
+    status = write_flight_recorder_event(FR_DEMO_EVENT_MAIN, 0U, 0U);
+    printf("Write before registration: status 0x%X - %s \n", status, (FR_NOT_REGISTERED == status) ? "not registered as expected" : "FAILED");
+
+    status = register_flight_recorder_thread();
+    printf("Register main thread: status 0x%X - %s \n", status, (FR_SUCCESS == status) ? "registered" : "FAILED");
+
+    status = register_flight_recorder_thread();
+    printf("Register main thread again: status 0x%X - %s \n", status, (FR_ALREADY_REGISTERED == status) ? "already registered as expected" : "FAILED");
+
+    for (uint64_t i = 0; i < 3U; i++)
+    {
+        (void)write_flight_recorder_event(FR_DEMO_EVENT_MAIN, i, 0U);
+    }
+
+    /* Writer threads write more events than the ring holds, the oldest events are over written. */
+    (void)pthread_barrier_init(&g_fr_demo_barrier, NULL, (FR_DEMO_THREAD_COUNT + 1U));
+    for (uint32_t i = 0; i < FR_DEMO_THREAD_COUNT; i++)
+    {
+        (void)pthread_create(&writer_threads[i], NULL, fr_demo_writer_thread, NULL);
+    }
+    (void)pthread_barrier_wait(&g_fr_demo_barrier);
+
+    /* All threads are waiting, the dump has the last FLIGHT_RECORDER_EVENT_COUNT events of each writer thread. */
+    status = fr_demo_dump_and_check(&dump_check);
+    bool_t b_over_written = TRUE;
+    for (uint32_t i = 1U; i <= FR_DEMO_THREAD_COUNT; i++)
+    {
+        if ((FLIGHT_RECORDER_EVENT_COUNT != dump_check.recorder_event_count[i]) ||
+            ((FR_DEMO_EVENT_COUNT - 1U) != dump_check.recorder_last_sequence[i]))
+        {
+            b_over_written = FALSE;
+        }
+    }
+    printf("Dump after over write: status 0x%X, records %u (main thread %u, each writer thread %u of %u events) - %s \n", status,
+        dump_check.record_count, dump_check.recorder_event_count[0], dump_check.recorder_event_count[1], FR_DEMO_EVENT_COUNT,
+        ((FR_SUCCESS == status) && (3U == dump_check.recorder_event_count[0]) && (TRUE == b_over_written) &&
+        (TRUE == dump_check.b_time_stamp_order) && (TRUE == dump_check.b_sequence_order)) ?
+        "oldest events over written, merged in time stamp order" : "FAILED");
+
+    /* Dump while the writer threads write, the snapshot of each ring is taken between the writes (write sequence). */
+    (void)pthread_barrier_wait(&g_fr_demo_barrier);
+    (void)nanosleep(&(struct timespec){ 0, 1000000L }, NULL);
+    status = fr_demo_dump_and_check(&dump_check);
+    printf("Dump while writing: status 0x%X - %s \n", status,
+        ((FR_SUCCESS == status) && (TRUE == dump_check.b_time_stamp_order) && (TRUE == dump_check.b_sequence_order)) ?
+        "consistent snapshots, merged in time stamp order" : "FAILED");
+
+    /*
+     * One dump at a time, the dump thread is blocked on the full pipe until the main thread reads it (the dump of all the
+     * rings is larger than the pipe). Once the first records are in the pipe the dump thread holds the dump.
+     */
+    int pipe_fd[2];
+    if (0 == pipe(pipe_fd))
+    {
+        struct pollfd poll_fd = { pipe_fd[0], POLLIN, 0 };
+
+        (void)pthread_create(&dump_thread, NULL, fr_demo_dump_thread, &pipe_fd[1]);
+        (void)poll(&poll_fd, 1U, -1);
+
+        status = dump_flight_recorder(pipe_fd[1]);
+        printf("Dump while another dump runs: status 0x%X - %s \n", status,
+            (FR_DUMP_IN_PROGRESS == status) ? "dump in progress as expected" : "FAILED");
+
+        /* Read the dump of the dump thread. */
+        fr_demo_check_records(pipe_fd[0], &dump_check);
+        (void)pthread_join(dump_thread, NULL);
+        printf("Dump of the dump thread: records %u - %s \n", dump_check.record_count,
+            ((TRUE == dump_check.b_time_stamp_order) && (TRUE == dump_check.b_sequence_order)) ? "merged in time stamp order" : "FAILED");
+
+        (void)close(pipe_fd[0]);
+    }
+
+    atomic_store(&g_fr_demo_stop, 1U);
+    for (uint32_t i = 0; i < FR_DEMO_THREAD_COUNT; i++)
+    {
+        (void)pthread_join(writer_threads[i], NULL);
+    }
+    (void)pthread_barrier_destroy(&g_fr_demo_barrier);
+
+    return 0;
+}
+
+/* Writer thread, registers, writes the events and then keeps writing paced events until stopped. */
+static void * fr_demo_writer_thread(void * p_argument)
+{
+    struct timespec pace = { 0, (FR_DEMO_WRITE_PACE_US * 1000L) };
+    uint64_t sequence = 0U;
+
+    (void)p_argument;
+    if (FR_SUCCESS != register_flight_recorder_thread())
+    {
+        printf("Register writer thread FAILED \n");
+    }
+
+    for (; sequence < FR_DEMO_EVENT_COUNT; sequence++)
+    {
+        (void)write_flight_recorder_event(FR_DEMO_EVENT_THREAD, sequence, 0U);
+    }
+
+    (void)pthread_barrier_wait(&g_fr_demo_barrier);
+    (void)pthread_barrier_wait(&g_fr_demo_barrier);
+
+    while (!atomic_load(&g_fr_demo_stop))
+    {
+        (void)write_flight_recorder_event(FR_DEMO_EVENT_THREAD, sequence, 0U);
+        sequence++;
+        (void)nanosleep(&pace, NULL);
+    }
+
+    return NULL;
+}
+
+/* Dump thread, dumps into a pipe that is read only after the main thread got FR_DUMP_IN_PROGRESS. */
+static void * fr_demo_dump_thread(void * p_argument)
+{
+    int dump_file_descriptor = *(int *)p_argument;
+
+    if (FR_SUCCESS != dump_flight_recorder(dump_file_descriptor))
+    {
+        printf("Dump of the dump thread FAILED \n");
+    }
+
+    /* End of the dump for the reader. */
+    (void)close(dump_file_descriptor);
+
+    return NULL;
+}
+
+/* Dump the flight recorder into a temporary file and check the records. */
+static uint32_t fr_demo_dump_and_check(fr_demo_dump_check_t * p_dump_check)
+{
+    uint32_t status = FR_FILE_DESCRIPTOR_INVALID;
+    FILE * p_dump_file = tmpfile();
+
+    if (p_dump_file != NULL)
+    {
+        int dump_file_descriptor = fileno(p_dump_file);
+
+        status = dump_flight_recorder(dump_file_descriptor);
+        (void)lseek(dump_file_descriptor, 0, SEEK_SET);
+        fr_demo_check_records(dump_file_descriptor, p_dump_check);
+
+        (void)fclose(p_dump_file);
+    }
+
+    return status;
+}
+
+/* Read the dump records from the file descriptor and check them (time stamp order, sequence of each thread). */
+static void fr_demo_check_records(int dump_file_descriptor, fr_demo_dump_check_t * p_dump_check)
+{
+    fr_event_t event;
+    uint64_t last_time_stamp = 0U;
+    size_t read_size = 0U;
+
+    memset(p_dump_check, 0, sizeof(fr_demo_dump_check_t));
+    p_dump_check->b_time_stamp_order = TRUE;
+    p_dump_check->b_sequence_order = TRUE;
+
+    while (TRUE)
+    {
+        ssize_t size = read(dump_file_descriptor, &((uint8_t *)&event)[read_size], (sizeof(fr_event_t) - read_size));
+        if (size <= 0)
+        {
+            break;
+        }
+
+        read_size += (size_t)size;
+        if (read_size < sizeof(fr_event_t))
+        {
+            continue;
+        }
+        read_size = 0U;
+
+        /* Merged dump is oldest first. */
+        if (event.time_stamp < last_time_stamp)
+        {
+            p_dump_check->b_time_stamp_order = FALSE;
+        }
+        last_time_stamp = event.time_stamp;
+
+        /* Events of each thread are consecutive (no torn or lost event in the middle of a ring). */
+        if (event.recorder_id < FLIGHT_RECORDER_MAX_THREAD_COUNT)
+        {
+            if ((p_dump_check->recorder_event_count[event.recorder_id]) &&
+                (event.event_data_0 != (p_dump_check->recorder_last_sequence[event.recorder_id] + 1U)))
+            {
+                p_dump_check->b_sequence_order = FALSE;
+            }
+            p_dump_check->recorder_event_count[event.recorder_id]++;
+            p_dump_check->recorder_last_sequence[event.recorder_id] = event.event_data_0;
+        }
+        p_dump_check->record_count++;
+    }
+}
@@ -10,6 +10,8 @@
 
 #define RB_SOURCE_CODE
 
+#include <string.h>
+
 #include "ring_buffer_api.h"
 #include "ring_buffer.h"
 
@@ -20,29 +22,67 @@ static uint32_t g_ring_buffer_count = 0;
 /* Created Ring Buffer List (doubly circular) */
 static rgbf_t * gp_ring_buffer_created_list = NULL;
 
+/* Allocator functions of the default allocator (calloc and free) */
+static void * heap_alloc(void * p_allocator_context, size_t size);
+static void heap_free(void * p_allocator_context, void * p_memory);
+static void * heap_realloc(void * p_allocator_context, void * p_memory, size_t size);
+
+/* Allocator functions of the counting allocator */
+static void * counting_alloc(void * p_allocator_context, size_t size);
+static void counting_free(void * p_allocator_context, void * p_memory);
+static void * counting_realloc(void * p_allocator_context, void * p_memory, size_t size);
+static void * counting_aligned_alloc(void * p_allocator_context, size_t alignment, size_t size);
+
+/* Default allocator (calloc and free) */
+static const rb_allocator_t g_heap_allocator = { heap_alloc, heap_free, heap_realloc, NULL, NULL };
+
+/* Allocator of the ring buffers created without an allocator */
+static const rb_allocator_t * gp_ring_buffer_allocator = &g_heap_allocator;
+
 /* Add created ring buffer to the ring buffer list */
 static void add_to_ring_buffer_list(rgbf_t * p_ring_buffer);
 
 /* Add created ring buffer to the ring buffer list */
 static void remove_ring_buffer_from_list(rgbf_t * p_ring_buffer);
 
+/* Copy a block into the ring buffer at the index, returns the index after the block */
+static uint32_t copy_block_to_ring_buffer(rgbf_t * p_ring_buffer, uint32_t index, const uint8_t * p_block, uint32_t size);
+
+/* Copy a block out of the ring buffer from the index, returns the index after the block */
+static uint32_t copy_block_from_ring_buffer(const rgbf_t * p_ring_buffer, uint32_t index, uint8_t * p_block, uint32_t size);
+
+/* Get the unread size of the ring buffer */
+static uint32_t get_unread_size(const rgbf_t * p_ring_buffer);
+
 /* Function to create Ring Buffer */
 uint32_t create_ring_buffer(rgbf_t ** p_ring_buffer, uint32_t size)
+{
+    return create_ring_buffer_with_allocator(p_ring_buffer, size, NULL);
+}
+
+/* Function to create Ring Buffer with the allocator */
+uint32_t create_ring_buffer_with_allocator(rgbf_t ** p_ring_buffer, uint32_t size, const rb_allocator_t * p_allocator)
 {
     uint32_t status = RB_FAIL;
 
+    /* Ring buffer is freed with the allocator it is created with */
+    if (!p_allocator)
+    {
+        p_allocator = gp_ring_buffer_allocator;
+    }
+
     /* Check conditions are OK */
     if (g_ring_buffer_count < RINGBUFFER_MAX_COUNT)
     {
         /* Allocate the memory for ring buffer */
         *p_ring_buffer = NULL;
-        *p_ring_buffer = (rgbf_t *)calloc(1, sizeof(rgbf_t));
+        *p_ring_buffer = (rgbf_t *)allocate_ring_buffer_memory(p_allocator, sizeof(rgbf_t));
 
         if (*p_ring_buffer != NULL)
         {
             /* Allocate the buffer */
             (*p_ring_buffer)->p_buffer = NULL;
-            (*p_ring_buffer)->p_buffer = (uint8_t *)calloc(size, sizeof(uint8_t));
+            (*p_ring_buffer)->p_buffer = (uint8_t *)allocate_ring_buffer_memory(p_allocator, size);
 
             if ((*p_ring_buffer)->p_buffer)
             {
@@ -53,6 +93,7 @@ uint32_t create_ring_buffer(rgbf_t ** p_ring_buffer, uint32_t size)
                 (*p_ring_buffer)->read_index = 0;
                 (*p_ring_buffer)->buffer_size = size;
                 (*p_ring_buffer)->b_data_unread = FALSE;
+                (*p_ring_buffer)->p_allocator = p_allocator;
 
                 /* Add Ring Buffer to global list of Ring Buffers */
                 add_to_ring_buffer_list(*p_ring_buffer);
@@ -69,7 +110,8 @@ uint32_t create_ring_buffer(rgbf_t ** p_ring_buffer, uint32_t size)
             {
                 /* memory is not available for buffer size requested. */
                 /* Free the memory allocated for the ring buffer */
-                free(*p_ring_buffer);
+                free_ring_buffer_memory(p_allocator, *p_ring_buffer);
+                *p_ring_buffer = NULL;
                 status = RB_NO_MEMORY_ERROR;
             }
         }
@@ -170,24 +212,15 @@ uint32_t block_write_to_ring_buffer(rgbf_t * p_ring_buffer, const uint8_t * p_bl
         }
     }
 
-    if ((status == RB_SUCCESS) || b_over_write)
+    /* A block larger than the ring buffer is never written (even with over write), the copy would overrun the buffer. */
+    if (size > p_ring_buffer->buffer_size)
+    {
+        status = RB_FAIL;
+    }
+    else if ((status == RB_SUCCESS) || b_over_write)
     {
-        uint32_t count = 0;
         /* Write the block */
-        do
-        {
-            p_ring_buffer->p_buffer[p_ring_buffer->write_index] = p_block[count];
-
-            /* Increment the write index */
-            p_ring_buffer->write_index++;
-            count++;
-
-            /* Check is write index is rolling over */
-            if (p_ring_buffer->write_index == p_ring_buffer->buffer_size)
-            {
-                p_ring_buffer->write_index = 0;
-            }
-        } while (count < size);
+        p_ring_buffer->write_index = copy_block_to_ring_buffer(p_ring_buffer, p_ring_buffer->write_index, p_block, size);
 
         /* Set data unread */
         p_ring_buffer->b_data_unread = TRUE;
@@ -262,7 +295,8 @@ uint32_t read_block_from_ring_buffer(rgbf_t * p_ring_buffer, uint8_t * p_block,
     }
     else
     {
-        if (p_ring_buffer->b_data_unread == TRUE)
+        /* Ring buffer is full, a block larger than the ring buffer is never read. */
+        if ((p_ring_buffer->b_data_unread == TRUE) && (size <= p_ring_buffer->buffer_size))
         {
             status = RB_SUCCESS;
         }
@@ -272,23 +306,8 @@ uint32_t read_block_from_ring_buffer(rgbf_t * p_ring_buffer, uint8_t * p_block,
     /* check condition */
     if (status == RB_SUCCESS)
     {
-        uint32_t count = 0;
-        do
-        {
-            /* read the byte */
-            p_block[count] = p_ring_buffer->p_buffer[p_ring_buffer->read_index];
-
-            /* Increment the read index. */
-            p_ring_buffer->read_index++;
-
-            /* Check if read index is rolling over */
-            if (p_ring_buffer->read_index == p_ring_buffer->buffer_size)
-            {
-                p_ring_buffer->read_index = 0;
-            }
-
-            count++;
-        } while (count < size);
+        /* Read the block */
+        p_ring_buffer->read_index = copy_block_from_ring_buffer(p_ring_buffer, p_ring_buffer->read_index, p_block, size);
 
         if (p_ring_buffer->read_index == p_ring_buffer->write_index)
         {
@@ -340,9 +359,9 @@ uint32_t delete_ring_buffer(rgbf_t * p_ring_buffer)
     g_ring_buffer_count--;
 
     /* delete the buffer */
-    free(p_ring_buffer->p_buffer);
+    free_ring_buffer_memory(p_ring_buffer->p_allocator, p_ring_buffer->p_buffer);
     /* delete the structure */
-    free(p_ring_buffer);
+    free_ring_buffer_memory(p_ring_buffer->p_allocator, p_ring_buffer);
 
     /* set status success */
     status = RB_SUCCESS;
@@ -350,6 +369,259 @@ uint32_t delete_ring_buffer(rgbf_t * p_ring_buffer)
     return status;
 }
 
+/* Function to write a set of blocks to Ring Buffer */
+uint32_t ring_buffer_writev(rgbf_t * p_ring_buffer, const rb_iovec_t * p_iovec, uint32_t iovec_count, bool_t b_over_write)
+{
+    uint32_t status = RB_FAIL;
+    uint32_t available_size = 0;
+    uint32_t size = 0;
+
+    /* Total size of the blocks, free size is checked once for all the blocks. */
+    for (uint32_t i = 0; i < iovec_count; i++)
+    {
+        size += p_iovec[i].size;
+    }
+
+    /* Check is buffer is empty */
+    if (p_ring_buffer->b_data_unread != TRUE)
+    {
+        status = RB_SUCCESS;
+    }
+    else
+    {
+        if (p_ring_buffer->read_index != p_ring_buffer->write_index)
+        {
+            /* Get free size */
+            available_size = (p_ring_buffer->read_index < p_ring_buffer->write_index) ?
+                (p_ring_buffer->buffer_size - (p_ring_buffer->write_index - p_ring_buffer->read_index)) :
+                (p_ring_buffer->read_index - p_ring_buffer->write_index);
+
+            /* Check if required size is smaller than available size. */
+            if (available_size >= size)
+            {
+                status = RB_SUCCESS;
+            }
+        }
+    }
+
+    /* Blocks larger than the ring buffer are never written (even with over write), the copy would overrun the buffer. */
+    if (size > p_ring_buffer->buffer_size)
+    {
+        status = RB_FAIL;
+    }
+    else if ((status == RB_SUCCESS) || b_over_write)
+    {
+        /* Write all the blocks, then update the write index once. */
+        uint32_t write_index = p_ring_buffer->write_index;
+        for (uint32_t i = 0; i < iovec_count; i++)
+        {
+            write_index = copy_block_to_ring_buffer(p_ring_buffer, write_index, p_iovec[i].p_block, p_iovec[i].size);
+        }
+        p_ring_buffer->write_index = write_index;
+
+        /* Set data unread */
+        p_ring_buffer->b_data_unread = TRUE;
+
+        /* Check if it is a overwrite */
+        if (status == RB_FAIL && b_over_write)
+        {
+            /* set read is equal to write */
+            p_ring_buffer->read_index = p_ring_buffer->write_index;
+
+            /* Set status success */
+            status = RB_SUCCESS;
+        }
+    }
+
+    /* Return Status */
+    return status;
+}
+
+/* Function to read a set of blocks from the Ring Buffer */
+uint32_t ring_buffer_readv(rgbf_t * p_ring_buffer, const rb_iovec_t * p_iovec, uint32_t iovec_count)
+{
+    uint32_t status = RB_FAIL;
+    uint32_t available_size = 0;
+    uint32_t size = 0;
+
+    /* Total size of the blocks, unread size is checked once for all the blocks. */
+    for (uint32_t i = 0; i < iovec_count; i++)
+    {
+        size += p_iovec[i].size;
+    }
+
+    if (p_ring_buffer->read_index != p_ring_buffer->write_index)
+    {
+        /* Get unread size */
+        available_size = (p_ring_buffer->write_index < p_ring_buffer->read_index) ?
+            (p_ring_buffer->buffer_size - (p_ring_buffer->read_index - p_ring_buffer->write_index)) :
+            (p_ring_buffer->write_index - p_ring_buffer->read_index);
+
+        /* Check if required size is smaller than available size. */
+        if (available_size >= size)
+        {
+            status = RB_SUCCESS;
+        }
+    }
+    else
+    {
+        /* Ring buffer is full, a block larger than the ring buffer is never read. */
+        if ((p_ring_buffer->b_data_unread == TRUE) && (size <= p_ring_buffer->buffer_size))
+        {
+            status = RB_SUCCESS;
+        }
+    }
+
+    /* check condition */
+    if (status == RB_SUCCESS)
+    {
+        /* Read all the blocks, then update the read index once. */
+        uint32_t read_index = p_ring_buffer->read_index;
+        for (uint32_t i = 0; i < iovec_count; i++)
+        {
+            read_index = copy_block_from_ring_buffer(p_ring_buffer, read_index, p_iovec[i].p_block, p_iovec[i].size);
+        }
+        p_ring_buffer->read_index = read_index;
+
+        if (p_ring_buffer->read_index == p_ring_buffer->write_index)
+        {
+            /* Reset data unread */
+            p_ring_buffer->b_data_unread = FALSE;
+        }
+    }
+
+    return status;
+}
+
+/* Function to get the unread data of the Ring Buffer in place (without read) */
+uint32_t ring_buffer_peek(rgbf_t * p_ring_buffer, rb_iovec_t * p_iovec, uint32_t * p_iovec_count)
+{
+    uint32_t status = RB_FAIL;
+    uint32_t unread_size = get_unread_size(p_ring_buffer);
+
+    /* check condition */
+    if (unread_size)
+    {
+        /* Unread data up to the end of the buffer. */
+        uint32_t size = p_ring_buffer->buffer_size - p_ring_buffer->read_index;
+        if (size > unread_size)
+        {
+            size = unread_size;
+        }
+
+        p_iovec[0].p_block = &p_ring_buffer->p_buffer[p_ring_buffer->read_index];
+        p_iovec[0].size = size;
+        *p_iovec_count = 1;
+
+        if (unread_size > size)
+        {
+            /* Unread data rolled over to the start of the buffer. */
+            p_iovec[1].p_block = p_ring_buffer->p_buffer;
+            p_iovec[1].size = unread_size - size;
+            *p_iovec_count = 2;
+        }
+
+        status = RB_SUCCESS;
+    }
+
+    return status;
+}
+
+/* Function to skip unread data of the Ring Buffer (read without copy) */
+uint32_t ring_buffer_skip(rgbf_t * p_ring_buffer, uint32_t size)
+{
+    uint32_t status = RB_FAIL;
+
+    /* Check if required size is smaller than unread size. */
+    if (size <= get_unread_size(p_ring_buffer))
+    {
+        p_ring_buffer->read_index = (p_ring_buffer->read_index + size) % p_ring_buffer->buffer_size;
+
+        if (p_ring_buffer->read_index == p_ring_buffer->write_index)
+        {
+            /* Reset data unread */
+            p_ring_buffer->b_data_unread = FALSE;
+        }
+
+        status = RB_SUCCESS;
+    }
+
+    return status;
+}
+
+/* Function to set the allocator of the ring buffers */
+uint32_t ring_buffer_set_allocator(const rb_allocator_t * p_allocator)
+{
+    /* NULL, restore the default allocator (calloc and free) */
+    gp_ring_buffer_allocator = (p_allocator) ? p_allocator : &g_heap_allocator;
+
+    return RB_SUCCESS;
+}
+
+/* Function to get the allocator of the ring buffers */
+const rb_allocator_t * ring_buffer_get_allocator(void)
+{
+    return gp_ring_buffer_allocator;
+}
+
+/* Function to initialize the counting allocator */
+uint32_t ring_buffer_counting_allocator_init(rb_counting_allocator_t * p_counting_allocator, const rb_allocator_t * p_backing_allocator)
+{
+    p_counting_allocator->p_backing_allocator = (p_backing_allocator) ? p_backing_allocator : &g_heap_allocator;
+
+    /* Optional functions are only counted if the backing allocator has them */
+    p_counting_allocator->allocator.p_alloc = counting_alloc;
+    p_counting_allocator->allocator.p_free = counting_free;
+    p_counting_allocator->allocator.p_realloc = (p_counting_allocator->p_backing_allocator->p_realloc) ? counting_realloc : NULL;
+    p_counting_allocator->allocator.p_aligned_alloc = (p_counting_allocator->p_backing_allocator->p_aligned_alloc) ? counting_aligned_alloc : NULL;
+    p_counting_allocator->allocator.p_allocator_context = p_counting_allocator;
+
+    return ring_buffer_counting_allocator_reset(p_counting_allocator);
+}
+
+/* Function to reset the counts of the counting allocator */
+uint32_t ring_buffer_counting_allocator_reset(rb_counting_allocator_t * p_counting_allocator)
+{
+    p_counting_allocator->allocation_count = 0;
+    p_counting_allocator->free_count = 0;
+    p_counting_allocator->allocated_bytes = 0;
+    p_counting_allocator->reallocation_count = 0;
+    p_counting_allocator->reallocated_bytes = 0;
+
+    return RB_SUCCESS;
+}
+
+/* Allocate zero initialized memory with the allocator (NULL, allocator set with ring_buffer_set_allocator) */
+void * allocate_ring_buffer_memory(const rb_allocator_t * p_allocator, size_t size)
+{
+    if (!p_allocator)
+    {
+        p_allocator = gp_ring_buffer_allocator;
+    }
+
+    void * p_memory = p_allocator->p_alloc(p_allocator->p_allocator_context, size);
+    if (p_memory)
+    {
+        memset(p_memory, 0, size);
+    }
+
+    return p_memory;
+}
+
+/* Free memory allocated with the allocator (NULL, allocator set with ring_buffer_set_allocator) */
+void free_ring_buffer_memory(const rb_allocator_t * p_allocator, void * p_memory)
+{
+    if (!p_allocator)
+    {
+        p_allocator = gp_ring_buffer_allocator;
+    }
+
+    if (p_memory)
+    {
+        p_allocator->p_free(p_allocator->p_allocator_context, p_memory);
+    }
+}
+
 /* local / internal function to add created ring buffer to the ring buffer list */
 static void add_to_ring_buffer_list(rgbf_t * p_ring_buffer)
 {
@@ -399,3 +671,149 @@ static void remove_ring_buffer_from_list(rgbf_t * p_ring_buffer)
         }
     }
 }
+
+/* Local / internal function to copy a block into the ring buffer at the index */
+static uint32_t copy_block_to_ring_buffer(rgbf_t * p_ring_buffer, uint32_t index, const uint8_t * p_block, uint32_t size)
+{
+    /* Copy up to the end of the buffer and then the rolled over part. */
+    uint32_t first_size = p_ring_buffer->buffer_size - index;
+    if (first_size > size)
+    {
+        first_size = size;
+    }
+
+    memcpy(&p_ring_buffer->p_buffer[index], p_block, first_size);
+    memcpy(p_ring_buffer->p_buffer, &p_block[first_size], (size - first_size));
+
+    /* Check if index is rolling over */
+    index += size;
+    if (index >= p_ring_buffer->buffer_size)
+    {
+        index -= p_ring_buffer->buffer_size;
+    }
+
+    return index;
+}
+
+/* Local / internal function to copy a block out of the ring buffer from the index */
+static uint32_t copy_block_from_ring_buffer(const rgbf_t * p_ring_buffer, uint32_t index, uint8_t * p_block, uint32_t size)
+{
+    /* Copy up to the end of the buffer and then the rolled over part. */
+    uint32_t first_size = p_ring_buffer->buffer_size - index;
+    if (first_size > size)
+    {
+        first_size = size;
+    }
+
+    memcpy(p_block, &p_ring_buffer->p_buffer[index], first_size);
+    memcpy(&p_block[first_size], p_ring_buffer->p_buffer, (size - first_size));
+
+    /* Check if index is rolling over */
+    index += size;
+    if (index >= p_ring_buffer->buffer_size)
+    {
+        index -= p_ring_buffer->buffer_size;
+    }
+
+    return index;
+}
+
+/* Local / internal function to get the unread size of the ring buffer */
+static uint32_t get_unread_size(const rgbf_t * p_ring_buffer)
+{
+    uint32_t unread_size = 0;
+
+    if (p_ring_buffer->read_index != p_ring_buffer->write_index)
+    {
+        unread_size = (p_ring_buffer->write_index < p_ring_buffer->read_index) ?
+            (p_ring_buffer->buffer_size - (p_ring_buffer->read_index - p_ring_buffer->write_index)) :
+            (p_ring_buffer->write_index - p_ring_buffer->read_index);
+    }
+    else if (p_ring_buffer->b_data_unread == TRUE)
+    {
+        /* Ring buffer is full */
+        unread_size = p_ring_buffer->buffer_size;
+    }
+
+    return unread_size;
+}
+
+/* Local / internal default allocator functions (the allocator context is not used) */
+static void * heap_alloc(void * p_allocator_context, size_t size)
+{
+    (void)p_allocator_context;
+    return malloc(size);
+}
+
+static void heap_free(void * p_allocator_context, void * p_memory)
+{
+    (void)p_allocator_context;
+    free(p_memory);
+}
+
+static void * heap_realloc(void * p_allocator_context, void * p_memory, size_t size)
+{
+    (void)p_allocator_context;
+    return realloc(p_memory, size);
+}
+
+/* Add to a count of the counting allocator (relaxed, the counts are read after the counted operations) */
+#if (0 < RB_ATOMIC_COUNTS)
+#define ADD_RB_ALLOCATOR_COUNT(count, value)    atomic_fetch_add_explicit(&(count), (uint64_t)(value), memory_order_relaxed)
+#else
+#define ADD_RB_ALLOCATOR_COUNT(count, value)    ((count) += (uint64_t)(value))
+#endif /* RB_ATOMIC_COUNTS */
+
+/* Local / internal counting allocator functions, count and forward to the backing allocator */
+static void * counting_alloc(void * p_allocator_context, size_t size)
+{
+    rb_counting_allocator_t * p_counting_allocator = (rb_counting_allocator_t *)p_allocator_context;
+    const rb_allocator_t * p_backing_allocator = p_counting_allocator->p_backing_allocator;
+
+    ADD_RB_ALLOCATOR_COUNT(p_counting_allocator->allocation_count, 1);
+    ADD_RB_ALLOCATOR_COUNT(p_counting_allocator->allocated_bytes, size);
+
+    return p_backing_allocator->p_alloc(p_backing_allocator->p_allocator_context, size);
+}
+
+static void counting_free(void * p_allocator_context, void * p_memory)
+{
+    rb_counting_allocator_t * p_counting_allocator = (rb_counting_allocator_t *)p_allocator_context;
+    const rb_allocator_t * p_backing_allocator = p_counting_allocator->p_backing_allocator;
+
+    ADD_RB_ALLOCATOR_COUNT(p_counting_allocator->free_count, 1);
+
+    p_backing_allocator->p_free(p_backing_allocator->p_allocator_context, p_memory);
+}
+
+static void * counting_realloc(void * p_allocator_context, void * p_memory, size_t size)
+{
+    rb_counting_allocator_t * p_counting_allocator = (rb_counting_allocator_t *)p_allocator_context;
+    const rb_allocator_t * p_backing_allocator = p_counting_allocator->p_backing_allocator;
+
+    if (NULL == p_memory)
+    {
+        /* Realloc of NULL is an allocation */
+        ADD_RB_ALLOCATOR_COUNT(p_counting_allocator->allocation_count, 1);
+        ADD_RB_ALLOCATOR_COUNT(p_counting_allocator->allocated_bytes, size);
+    }
+    else
+    {
+        /* Resize of allocated memory */
+        ADD_RB_ALLOCATOR_COUNT(p_counting_allocator->reallocation_count, 1);
+        ADD_RB_ALLOCATOR_COUNT(p_counting_allocator->reallocated_bytes, size);
+    }
+
+    return p_backing_allocator->p_realloc(p_backing_allocator->p_allocator_context, p_memory, size);
+}
+
+static void * counting_aligned_alloc(void * p_allocator_context, size_t alignment, size_t size)
+{
+    rb_counting_allocator_t * p_counting_allocator = (rb_counting_allocator_t *)p_allocator_context;
+    const rb_allocator_t * p_backing_allocator = p_counting_allocator->p_backing_allocator;
+
+    ADD_RB_ALLOCATOR_COUNT(p_counting_allocator->allocation_count, 1);
+    ADD_RB_ALLOCATOR_COUNT(p_counting_allocator->allocated_bytes, size);
+
+    return p_backing_allocator->p_aligned_alloc(p_backing_allocator->p_allocator_context, alignment, size);
+}
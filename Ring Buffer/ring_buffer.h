@@ -38,6 +38,39 @@ uint32_t reset_ring_buffer(rgbf_t * p_ring_buffer);
 /* Delete the Ring Buffer */
 uint32_t delete_ring_buffer(rgbf_t * pRingBuffer);
 
+/* Function to write a set of blocks to Ring Buffer */
+uint32_t ring_buffer_writev(rgbf_t * p_ring_buffer, const rb_iovec_t * p_iovec, uint32_t iovec_count, bool_t b_over_write);
+
+/* Function to read a set of blocks from the Ring Buffer */
+uint32_t ring_buffer_readv(rgbf_t * p_ring_buffer, const rb_iovec_t * p_iovec, uint32_t iovec_count);
+
+/* Function to get the unread data of the Ring Buffer in place */
+uint32_t ring_buffer_peek(rgbf_t * p_ring_buffer, rb_iovec_t * p_iovec, uint32_t * p_iovec_count);
+
+/* Function to skip unread data of the Ring Buffer */
+uint32_t ring_buffer_skip(rgbf_t * p_ring_buffer, uint32_t size);
+
+/* Function to create Ring Buffer with the allocator */
+uint32_t create_ring_buffer_with_allocator(rgbf_t ** p_ring_buffer, uint32_t size, const rb_allocator_t * p_allocator);
+
+/* Function to set the allocator of the ring buffers */
+uint32_t ring_buffer_set_allocator(const rb_allocator_t * p_allocator);
+
+/* Function to get the allocator of the ring buffers */
+const rb_allocator_t * ring_buffer_get_allocator(void);
+
+/* Function to initialize the counting allocator */
+uint32_t ring_buffer_counting_allocator_init(rb_counting_allocator_t * p_counting_allocator, const rb_allocator_t * p_backing_allocator);
+
+/* Function to reset the counts of the counting allocator */
+uint32_t ring_buffer_counting_allocator_reset(rb_counting_allocator_t * p_counting_allocator);
+
+/* Allocate zero initialized memory with the allocator (NULL, allocator set with ring_buffer_set_allocator) */
+void * allocate_ring_buffer_memory(const rb_allocator_t * p_allocator, size_t size);
+
+/* Free memory allocated with the allocator (NULL, allocator set with ring_buffer_set_allocator) */
+void free_ring_buffer_memory(const rb_allocator_t * p_allocator, void * p_memory);
+
 
 
 /* Error check for create Ring Buffer function */
@@ -61,4 +94,28 @@ uint32_t reset_ring_buffer_ec(rgbf_t * p_ring_buffer);
 /* Error check for delete the Ring Buffer */
 uint32_t delete_ring_buffer_ec(rgbf_t * pRingBuffer);
 
+/* Error check for write a set of blocks to Ring Buffer */
+uint32_t ring_buffer_writev_ec(rgbf_t * p_ring_buffer, const rb_iovec_t * p_iovec, uint32_t iovec_count, bool_t b_over_write);
+
+/* Error check for read a set of blocks from the Ring Buffer */
+uint32_t ring_buffer_readv_ec(rgbf_t * p_ring_buffer, const rb_iovec_t * p_iovec, uint32_t iovec_count);
+
+/* Error check for get the unread data of the Ring Buffer in place */
+uint32_t ring_buffer_peek_ec(rgbf_t * p_ring_buffer, rb_iovec_t * p_iovec, uint32_t * p_iovec_count);
+
+/* Error check for skip unread data of the Ring Buffer */
+uint32_t ring_buffer_skip_ec(rgbf_t * p_ring_buffer, uint32_t size);
+
+/* Error check for create Ring Buffer with the allocator function */
+uint32_t create_ring_buffer_with_allocator_ec(rgbf_t ** p_ring_buffer, uint32_t size, const rb_allocator_t * p_allocator);
+
+/* Error check for set the allocator of the ring buffers */
+uint32_t ring_buffer_set_allocator_ec(const rb_allocator_t * p_allocator);
+
+/* Error check for initialize the counting allocator */
+uint32_t ring_buffer_counting_allocator_init_ec(rb_counting_allocator_t * p_counting_allocator, const rb_allocator_t * p_backing_allocator);
+
+/* Error check for reset the counts of the counting allocator */
+uint32_t ring_buffer_counting_allocator_reset_ec(rb_counting_allocator_t * p_counting_allocator);
+
 #endif /* __RING_BUFFER__ */
@@ -78,12 +78,21 @@ typedef struct ring_buffer
     uint32_t     read_index;
     uint32_t     buffer_size;
     bool_t       b_data_unread;
+    const rb_allocator_t * p_allocator;
     struct ring_buffer
         * p_next_ring_buffer,
         * p_previous_ring_buffer;
 
 }rgbf_t;
 
+/* Ring Buffer I/O vector (one block of a scatter / gather write or read). */
+typedef struct ring_buffer_iovec
+{
+    uint8_t    * p_block;
+    uint32_t     size;
+
+}rb_iovec_t;
+
 
 /*
  * Defines the ring buffer api mapping based on error checking selected by the user.
@@ -110,6 +119,15 @@ typedef struct ring_buffer
 #define read_block_from_ring_buffer  read_block_from_ring_buffer
 #define reset_ring_buffer            reset_ring_buffer
 #define delete_ring_buffer           delete_ring_buffer
+#define ring_buffer_writev           ring_buffer_writev
+#define ring_buffer_readv            ring_buffer_readv
+#define ring_buffer_peek             ring_buffer_peek
+#define ring_buffer_skip             ring_buffer_skip
+#define create_ring_buffer_with_allocator      create_ring_buffer_with_allocator
+#define ring_buffer_set_allocator              ring_buffer_set_allocator
+#define ring_buffer_get_allocator              ring_buffer_get_allocator
+#define ring_buffer_counting_allocator_init    ring_buffer_counting_allocator_init
+#define ring_buffer_counting_allocator_reset   ring_buffer_counting_allocator_reset
 
 #else
 
@@ -122,6 +140,15 @@ typedef struct ring_buffer
 #define read_block_from_ring_buffer  read_block_from_ring_buffer_ec
 #define reset_ring_buffer            reset_ring_buffer_ec
 #define delete_ring_buffer           delete_ring_buffer_ec
+#define ring_buffer_writev           ring_buffer_writev_ec
+#define ring_buffer_readv            ring_buffer_readv_ec
+#define ring_buffer_peek             ring_buffer_peek_ec
+#define ring_buffer_skip             ring_buffer_skip_ec
+#define create_ring_buffer_with_allocator      create_ring_buffer_with_allocator_ec
+#define ring_buffer_set_allocator              ring_buffer_set_allocator_ec
+#define ring_buffer_get_allocator              ring_buffer_get_allocator
+#define ring_buffer_counting_allocator_init    ring_buffer_counting_allocator_init_ec
+#define ring_buffer_counting_allocator_reset   ring_buffer_counting_allocator_reset_ec
 
 #endif /* DISABLE_ERROR_CHECK */
 
@@ -146,6 +173,54 @@ uint32_t reset_ring_buffer(rgbf_t * p_ring_buffer);
 /* Delete the Ring Buffer */
 uint32_t delete_ring_buffer(rgbf_t * pRingBuffer);
 
+/*
+ * Write a set of blocks to Ring Buffer (gather write).
+ * The free size is checked once for all the blocks and the write index is updated once, either all
+ * the blocks are written or none (unless over write is set).
+ */
+uint32_t ring_buffer_writev(rgbf_t * p_ring_buffer, const rb_iovec_t * p_iovec, uint32_t iovec_count, bool_t b_over_write);
+
+/*
+ * Read a set of blocks from the Ring Buffer (scatter read).
+ * The unread size is checked once for all the blocks and the read index is updated once, either all
+ * the blocks are read or none.
+ */
+uint32_t ring_buffer_readv(rgbf_t * p_ring_buffer, const rb_iovec_t * p_iovec, uint32_t iovec_count);
+
+/*
+ * Get the unread data of the Ring Buffer in place, the read index is not updated.
+ * The unread data is returned as one block, or two blocks if it rolled over to the start of the buffer
+ * (p_iovec should have two I/O vectors). The blocks are valid till the data is read, skipped or over written.
+ */
+uint32_t ring_buffer_peek(rgbf_t * p_ring_buffer, rb_iovec_t * p_iovec, uint32_t * p_iovec_count);
+
+/* Skip unread data of the Ring Buffer (e.g. after the data returned by ring_buffer_peek is used), no data is copied. */
+uint32_t ring_buffer_skip(rgbf_t * p_ring_buffer, uint32_t size);
+
+/*
+ * Create Ring Buffer with the allocator, the ring buffer is freed with the same allocator on delete.
+ * If the allocator is NULL the allocator set with ring_buffer_set_allocator is used.
+ */
+uint32_t create_ring_buffer_with_allocator(rgbf_t ** p_ring_buffer, uint32_t size, const rb_allocator_t * p_allocator);
+
+/*
+ * Set the allocator of the ring buffers created after this call (NULL, calloc and free).
+ * The allocator should be valid till the ring buffers created with it are deleted.
+ */
+uint32_t ring_buffer_set_allocator(const rb_allocator_t * p_allocator);
+
+/* Get the allocator set with ring_buffer_set_allocator (calloc and free by default) */
+const rb_allocator_t * ring_buffer_get_allocator(void);
+
+/*
+ * Initialize the counting allocator on the backing allocator (NULL, calloc and free), set &counting_allocator.allocator
+ * with ring_buffer_set_allocator or create_ring_buffer_with_allocator to count the allocations and allocated bytes.
+ */
+uint32_t ring_buffer_counting_allocator_init(rb_counting_allocator_t * p_counting_allocator, const rb_allocator_t * p_backing_allocator);
+
+/* Reset the counts of the counting allocator */
+uint32_t ring_buffer_counting_allocator_reset(rb_counting_allocator_t * p_counting_allocator);
+
 #endif /* BR_SOURCE_CODE */
 
 #endif /* __RING_BUFFER_API__ */
@@ -0,0 +1,443 @@
+/*
+ * Name: ring_buffer_bench.c
+ *
+ * Description:
+ * Ring Buffer throughput and latency benchmark.
+ * - byte versus block write / read throughput across block sizes and ring buffer sizes.
+ * - gather / scatter (writev / readv) throughput and statically allocated ring buffer throughput.
+ * - over write mode cost (block write to a full ring buffer).
+ * - round trip latency percentiles between a producer and a consumer thread pinned to cores.
+ *
+ * Results are printed as CSV (one header line, one line per result) so that results can be
+ * compared across versions. A benchmark with a failed ring buffer call prints no result (the
+ * failure is printed to stderr).
+ *
+ * Usage: ring_buffer_bench [iterations]
+ *
+ * Author: Hemant Pundpal                            Date: 19 Oct 2026
+ *
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif /* _GNU_SOURCE */
+
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "ring_buffer_api.h"
+#include "ring_buffer_static.h"
+
+#define BENCH_DEFAULT_ITERATIONS    2000000U
+#define BENCH_LATENCY_SAMPLES       100000U
+#define BENCH_WRITEV_BLOCK_COUNT    16U
+#define BENCH_MAX_BLOCK_SIZE        256U
+
+/* Statically allocated ring buffer for comparison with the ring buffer api. */
+DECLARE_STATIC_RING_BUFFER(bench_static, 1024U)
+
+/* Ring buffer sizes and block sizes to benchmark. */
+static const uint32_t g_ring_buffer_sizes[] = { 64U, 256U, 1024U };
+static const uint32_t g_block_sizes[] = { 1U, 4U, 16U, 64U, 256U };
+
+/* Round trip latency: ping and pong ring buffers, each protected by its own critical section. */
+typedef struct bench_latency
+{
+    rgbf_t           * p_ping_ring_buffer;
+    rgbf_t           * p_pong_ring_buffer;
+    pthread_mutex_t    ping_mutex;
+    pthread_mutex_t    pong_mutex;
+    uint32_t           samples;
+    uint32_t           block_size;
+    uint32_t           cpu;
+    bool_t             b_producer_failed;
+    bool_t             b_consumer_failed;
+} bench_latency_t;
+
+static uint64_t get_time_ns(void);
+static void print_result(const char * p_name, uint32_t ring_size, uint32_t block_size, uint64_t operations, uint64_t elapsed_ns,
+    uint32_t status);
+static void bench_byte_throughput(uint32_t ring_size, uint32_t iterations);
+static void bench_block_throughput(uint32_t ring_size, uint32_t block_size, uint32_t iterations);
+static void bench_writev_throughput(uint32_t ring_size, uint32_t block_size, uint32_t iterations);
+static void bench_static_byte_throughput(uint32_t iterations);
+static void bench_static_throughput(uint32_t block_size, uint32_t iterations);
+static void bench_over_write(uint32_t ring_size, uint32_t block_size, uint32_t iterations);
+static void bench_round_trip_latency(uint32_t block_size);
+static void * bench_consumer_thread(void * p_argument);
+static void pin_to_cpu(uint32_t cpu);
+static int compare_uint64(const void * p_left, const void * p_right);
+
+/* Blocks written to and read from the ring buffers. */
+static uint8_t g_block[BENCH_MAX_BLOCK_SIZE * BENCH_WRITEV_BLOCK_COUNT];
+static uint8_t g_read_block[BENCH_MAX_BLOCK_SIZE * BENCH_WRITEV_BLOCK_COUNT];
+
+int main(int argc, char * argv[])
+{
+    uint32_t iterations = BENCH_DEFAULT_ITERATIONS;
+
+    if (argc > 1)
+    {
+        iterations = (uint32_t)strtoul(argv[1], NULL, 10);
+    }
+
+    printf("benchmark,ring_size,block_size,operations,ns_per_op,mb_per_s,p50_ns,p99_ns,p999_ns,max_ns\n");
+
+    for (uint32_t i = 0; i < (sizeof(g_ring_buffer_sizes) / sizeof(g_ring_buffer_sizes[0])); i++)
+    {
+        bench_byte_throughput(g_ring_buffer_sizes[i], iterations);
+
+        for (uint32_t j = 0; j < (sizeof(g_block_sizes) / sizeof(g_block_sizes[0])); j++)
+        {
+            if (g_block_sizes[j] <= g_ring_buffer_sizes[i])
+            {
+                bench_block_throughput(g_ring_buffer_sizes[i], g_block_sizes[j], iterations);
+                bench_over_write(g_ring_buffer_sizes[i], g_block_sizes[j], iterations);
+            }
+
+            if ((g_block_sizes[j] * BENCH_WRITEV_BLOCK_COUNT) <= g_ring_buffer_sizes[i])
+            {
+                bench_writev_throughput(g_ring_buffer_sizes[i], g_block_sizes[j], (iterations / BENCH_WRITEV_BLOCK_COUNT));
+            }
+        }
+    }
+
+    bench_static_byte_throughput(iterations);
+    for (uint32_t j = 0; j < (sizeof(g_block_sizes) / sizeof(g_block_sizes[0])); j++)
+    {
+        bench_static_throughput(g_block_sizes[j], iterations);
+    }
+
+    bench_round_trip_latency(1U);
+    bench_round_trip_latency(64U);
+
+    return 0;
+}
+
+/* Get monotonic time in nano seconds. */
+static uint64_t get_time_ns(void)
+{
+    struct timespec time_now;
+    clock_gettime(CLOCK_MONOTONIC, &time_now);
+    return ((uint64_t)time_now.tv_sec * 1000000000ULL) + (uint64_t)time_now.tv_nsec;
+}
+
+/* Print a throughput result (latency columns are empty), or the failure if a ring buffer call failed. */
+static void print_result(const char * p_name, uint32_t ring_size, uint32_t block_size, uint64_t operations, uint64_t elapsed_ns,
+    uint32_t status)
+{
+    if (RB_SUCCESS != status)
+    {
+        fprintf(stderr, "%s,%u,%u: ring buffer call failed (status 0x%X)\n", p_name, ring_size, block_size, status);
+        return;
+    }
+
+    double ns_per_op = (double)elapsed_ns / (double)operations;
+    double mb_per_s = ((double)operations * (double)block_size * 1000.0) / (double)elapsed_ns;
+
+    printf("%s,%u,%u,%llu,%.3f,%.1f,,,,\n", p_name, ring_size, block_size, (unsigned long long)operations, ns_per_op, mb_per_s);
+}
+
+/* Byte write and read throughput (one write and one read per operation). */
+static void bench_byte_throughput(uint32_t ring_size, uint32_t iterations)
+{
+    rgbf_t * p_ring_buffer = NULL;
+    uint8_t byte = 0xA5U;
+
+    if (RB_SUCCESS != create_ring_buffer(&p_ring_buffer, ring_size))
+    {
+        return;
+    }
+
+    uint32_t status = RB_SUCCESS;
+    uint64_t start_ns = get_time_ns();
+    for (uint32_t i = 0; (RB_SUCCESS == status) && (i < iterations); i++)
+    {
+        status = byte_write_to_ring_buffer(p_ring_buffer, &byte, FALSE);
+        if (RB_SUCCESS == status)
+        {
+            status = read_byte_from_ring_buffer(p_ring_buffer, &byte);
+        }
+    }
+    print_result("byte_write_read", ring_size, 1U, iterations, (get_time_ns() - start_ns), status);
+
+    delete_ring_buffer(p_ring_buffer);
+}
+
+/* Block write and read throughput (one write and one read per operation). */
+static void bench_block_throughput(uint32_t ring_size, uint32_t block_size, uint32_t iterations)
+{
+    rgbf_t * p_ring_buffer = NULL;
+
+    if (RB_SUCCESS != create_ring_buffer(&p_ring_buffer, ring_size))
+    {
+        return;
+    }
+
+    uint32_t status = RB_SUCCESS;
+    uint64_t start_ns = get_time_ns();
+    for (uint32_t i = 0; (RB_SUCCESS == status) && (i < iterations); i++)
+    {
+        status = block_write_to_ring_buffer(p_ring_buffer, g_block, block_size, FALSE);
+        if (RB_SUCCESS == status)
+        {
+            status = read_block_from_ring_buffer(p_ring_buffer, g_read_block, block_size);
+        }
+    }
+    print_result("block_write_read", ring_size, block_size, iterations, (get_time_ns() - start_ns), status);
+
+    delete_ring_buffer(p_ring_buffer);
+}
+
+/* Gather write and scatter read throughput (operations are blocks, BENCH_WRITEV_BLOCK_COUNT blocks per call). */
+static void bench_writev_throughput(uint32_t ring_size, uint32_t block_size, uint32_t iterations)
+{
+    rgbf_t * p_ring_buffer = NULL;
+    rb_iovec_t iovec[BENCH_WRITEV_BLOCK_COUNT];
+    rb_iovec_t read_iovec[BENCH_WRITEV_BLOCK_COUNT];
+
+    if ((iterations == 0U) || (RB_SUCCESS != create_ring_buffer(&p_ring_buffer, ring_size)))
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < BENCH_WRITEV_BLOCK_COUNT; i++)
+    {
+        iovec[i].p_block = &g_block[i * block_size];
+        iovec[i].size = block_size;
+        read_iovec[i].p_block = &g_read_block[i * block_size];
+        read_iovec[i].size = block_size;
+    }
+
+    uint32_t status = RB_SUCCESS;
+    uint64_t start_ns = get_time_ns();
+    for (uint32_t i = 0; (RB_SUCCESS == status) && (i < iterations); i++)
+    {
+        status = ring_buffer_writev(p_ring_buffer, iovec, BENCH_WRITEV_BLOCK_COUNT, FALSE);
+        if (RB_SUCCESS == status)
+        {
+            status = ring_buffer_readv(p_ring_buffer, read_iovec, BENCH_WRITEV_BLOCK_COUNT);
+        }
+    }
+    print_result("writev_readv", ring_size, block_size, ((uint64_t)iterations * BENCH_WRITEV_BLOCK_COUNT), (get_time_ns() - start_ns),
+        status);
+
+    delete_ring_buffer(p_ring_buffer);
+}
+
+/* Statically allocated ring buffer byte write and read throughput (one write and one read per operation). */
+static void bench_static_byte_throughput(uint32_t iterations)
+{
+    static bench_static_rgbf_t static_ring_buffer = STATIC_RING_BUFFER_INIT;
+    uint8_t byte = 0xA5U;
+
+    uint32_t status = RB_SUCCESS;
+    uint64_t start_ns = get_time_ns();
+    for (uint32_t i = 0; (RB_SUCCESS == status) && (i < iterations); i++)
+    {
+        status = byte_write_to_bench_static(&static_ring_buffer, &byte, FALSE);
+        if (RB_SUCCESS == status)
+        {
+            status = read_byte_from_bench_static(&static_ring_buffer, &byte);
+        }
+    }
+    print_result("static_byte_write_read", 1024U, 1U, iterations, (get_time_ns() - start_ns), status);
+}
+
+/* Statically allocated ring buffer block write and read throughput. */
+static void bench_static_throughput(uint32_t block_size, uint32_t iterations)
+{
+    static bench_static_rgbf_t static_ring_buffer = STATIC_RING_BUFFER_INIT;
+
+    uint32_t status = RB_SUCCESS;
+    uint64_t start_ns = get_time_ns();
+    for (uint32_t i = 0; (RB_SUCCESS == status) && (i < iterations); i++)
+    {
+        status = block_write_to_bench_static(&static_ring_buffer, g_block, block_size, FALSE);
+        if (RB_SUCCESS == status)
+        {
+            status = read_block_from_bench_static(&static_ring_buffer, g_read_block, block_size);
+        }
+    }
+    print_result("static_block_write_read", 1024U, block_size, iterations, (get_time_ns() - start_ns), status);
+}
+
+/* Over write cost, every block write is to a full ring buffer. */
+static void bench_over_write(uint32_t ring_size, uint32_t block_size, uint32_t iterations)
+{
+    rgbf_t * p_ring_buffer = NULL;
+    uint8_t byte = 0x5AU;
+
+    if (RB_SUCCESS != create_ring_buffer(&p_ring_buffer, ring_size))
+    {
+        return;
+    }
+
+    /* Fill the ring buffer. */
+    while (RB_SUCCESS == byte_write_to_ring_buffer(p_ring_buffer, &byte, FALSE))
+    {
+    }
+
+    uint32_t status = RB_SUCCESS;
+    uint64_t start_ns = get_time_ns();
+    for (uint32_t i = 0; (RB_SUCCESS == status) && (i < iterations); i++)
+    {
+        status = block_write_to_ring_buffer(p_ring_buffer, g_block, block_size, TRUE);
+    }
+    print_result("block_over_write", ring_size, block_size, iterations, (get_time_ns() - start_ns), status);
+
+    delete_ring_buffer(p_ring_buffer);
+}
+
+/* Round trip latency: producer writes a block to ping, consumer reads it and writes it to pong. */
+static void bench_round_trip_latency(uint32_t block_size)
+{
+    bench_latency_t latency;
+    pthread_t consumer_thread;
+    uint8_t block[BENCH_MAX_BLOCK_SIZE];
+    uint64_t * p_samples = (uint64_t *)calloc(BENCH_LATENCY_SAMPLES, sizeof(uint64_t));
+    uint32_t cpu_count = (uint32_t)sysconf(_SC_NPROCESSORS_ONLN);
+
+    memset(&latency, 0, sizeof(latency));
+    latency.samples = BENCH_LATENCY_SAMPLES;
+    latency.block_size = block_size;
+    latency.cpu = (cpu_count > 1U) ? 1U : 0U;
+    pthread_mutex_init(&latency.ping_mutex, NULL);
+    pthread_mutex_init(&latency.pong_mutex, NULL);
+
+    if ((p_samples == NULL) ||
+        (RB_SUCCESS != create_ring_buffer(&latency.p_ping_ring_buffer, RINGBUFFER_SIZE_MAX)) ||
+        (RB_SUCCESS != create_ring_buffer(&latency.p_pong_ring_buffer, RINGBUFFER_SIZE_MAX)))
+    {
+        free(p_samples);
+        return;
+    }
+
+    /* Producer on cpu 0, consumer on cpu 1 (same cpu if only one is available). */
+    pin_to_cpu(0U);
+    pthread_create(&consumer_thread, NULL, bench_consumer_thread, &latency);
+
+    uint32_t failed_status = RB_SUCCESS;
+    for (uint32_t i = 0; (RB_SUCCESS == failed_status) && (i < BENCH_LATENCY_SAMPLES); i++)
+    {
+        uint32_t status = RB_FAIL;
+        bool_t b_consumer_failed = FALSE;
+        uint64_t start_ns = get_time_ns();
+
+        /* A failed write stops the consumer. */
+        pthread_mutex_lock(&latency.ping_mutex);
+        failed_status = block_write_to_ring_buffer(latency.p_ping_ring_buffer, g_block, block_size, FALSE);
+        latency.b_producer_failed = (RB_SUCCESS != failed_status) ? TRUE : FALSE;
+        pthread_mutex_unlock(&latency.ping_mutex);
+
+        while ((RB_SUCCESS == failed_status) && (RB_SUCCESS != status))
+        {
+            pthread_mutex_lock(&latency.pong_mutex);
+            status = read_block_from_ring_buffer(latency.p_pong_ring_buffer, block, block_size);
+            b_consumer_failed = latency.b_consumer_failed;
+            pthread_mutex_unlock(&latency.pong_mutex);
+
+            if ((RB_SUCCESS != status) && (TRUE == b_consumer_failed))
+            {
+                failed_status = RB_FAIL;
+            }
+            else if ((RB_SUCCESS != status) && (cpu_count <= 1U))
+            {
+                sched_yield();
+            }
+        }
+
+        p_samples[i] = get_time_ns() - start_ns;
+    }
+
+    pthread_join(consumer_thread, NULL);
+
+    if (RB_SUCCESS != failed_status)
+    {
+        fprintf(stderr, "round_trip_latency,%u,%u: ring buffer call failed (status 0x%X)\n", RINGBUFFER_SIZE_MAX, block_size, failed_status);
+    }
+    else
+    {
+        qsort(p_samples, BENCH_LATENCY_SAMPLES, sizeof(uint64_t), compare_uint64);
+        printf("round_trip_latency,%u,%u,%u,,,%llu,%llu,%llu,%llu\n", RINGBUFFER_SIZE_MAX, block_size, BENCH_LATENCY_SAMPLES,
+            (unsigned long long)p_samples[(BENCH_LATENCY_SAMPLES * 50U) / 100U],
+            (unsigned long long)p_samples[(BENCH_LATENCY_SAMPLES * 99U) / 100U],
+            (unsigned long long)p_samples[(BENCH_LATENCY_SAMPLES * 999U) / 1000U],
+            (unsigned long long)p_samples[BENCH_LATENCY_SAMPLES - 1U]);
+    }
+
+    delete_ring_buffer(latency.p_ping_ring_buffer);
+    delete_ring_buffer(latency.p_pong_ring_buffer);
+    pthread_mutex_destroy(&latency.ping_mutex);
+    pthread_mutex_destroy(&latency.pong_mutex);
+    free(p_samples);
+}
+
+/* Consumer: echo each block from ping to pong. */
+static void * bench_consumer_thread(void * p_argument)
+{
+    bench_latency_t * p_latency = (bench_latency_t *)p_argument;
+    uint8_t block[BENCH_MAX_BLOCK_SIZE];
+    uint32_t cpu_count = (uint32_t)sysconf(_SC_NPROCESSORS_ONLN);
+
+    pin_to_cpu(p_latency->cpu);
+
+    for (uint32_t i = 0; i < p_latency->samples; i++)
+    {
+        uint32_t status = RB_FAIL;
+        bool_t b_producer_failed = FALSE;
+
+        /* Wait for a block (stop if the producer failed to write it). */
+        while (RB_SUCCESS != status)
+        {
+            pthread_mutex_lock(&p_latency->ping_mutex);
+            status = read_block_from_ring_buffer(p_latency->p_ping_ring_buffer, block, p_latency->block_size);
+            b_producer_failed = p_latency->b_producer_failed;
+            pthread_mutex_unlock(&p_latency->ping_mutex);
+
+            if ((RB_SUCCESS != status) && (TRUE == b_producer_failed))
+            {
+                return NULL;
+            }
+
+            if ((RB_SUCCESS != status) && (cpu_count <= 1U))
+            {
+                sched_yield();
+            }
+        }
+
+        /* A failed write stops the producer. */
+        pthread_mutex_lock(&p_latency->pong_mutex);
+        status = block_write_to_ring_buffer(p_latency->p_pong_ring_buffer, block, p_latency->block_size, FALSE);
+        p_latency->b_consumer_failed = (RB_SUCCESS != status) ? TRUE : FALSE;
+        pthread_mutex_unlock(&p_latency->pong_mutex);
+
+        if (RB_SUCCESS != status)
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/* Pin the calling thread to the cpu. */
+static void pin_to_cpu(uint32_t cpu)
+{
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+}
+
+/* qsort compare function for latency samples. */
+static int compare_uint64(const void * p_left, const void * p_right)
+{
+    uint64_t left = *(const uint64_t *)p_left;
+    uint64_t right = *(const uint64_t *)p_right;
+
+    return (left > right) - (left < right);
+}
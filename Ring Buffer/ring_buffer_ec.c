@@ -180,3 +180,232 @@ uint32_t delete_ring_buffer_ec(rgbf_t * p_ring_buffer)
 
     return status;
 }
+
+/* Error check for write a set of blocks to Ring Buffer */
+uint32_t ring_buffer_writev_ec(rgbf_t * p_ring_buffer, const rb_iovec_t * p_iovec, uint32_t iovec_count, bool_t b_over_write)
+{
+    /* Check if ring buffer pointer is valid */
+    assert(!p_ring_buffer || (p_ring_buffer->buffer_id != (uint32_t)(uintptr_t)p_ring_buffer));
+    if (!p_ring_buffer || (p_ring_buffer->buffer_id != (uint32_t)(uintptr_t)p_ring_buffer))
+    {
+        return RB_PTR_INVALID;
+    }
+
+    /* Check if I/O vector pointer is valid */
+    assert(!p_iovec || !iovec_count);
+    if (!p_iovec || !iovec_count)
+    {
+        return RB_DATA_PTR_INVALID;
+    }
+
+    /* Check each block pointer and the total size to copy into ring buffer is correct. */
+    uint32_t size = 0;
+    for (uint32_t i = 0; i < iovec_count; i++)
+    {
+        assert(!p_iovec[i].p_block);
+        if (!p_iovec[i].p_block)
+        {
+            return RB_DATA_PTR_INVALID;
+        }
+
+        assert(p_iovec[i].size > (p_ring_buffer->buffer_size - size));
+        if (p_iovec[i].size > (p_ring_buffer->buffer_size - size))
+        {
+            return RB_BUFFER_SIZE_ERROR;
+        }
+        size += p_iovec[i].size;
+    }
+
+    assert(!size);
+    if (!size)
+    {
+        return RB_BUFFER_SIZE_ERROR;
+    }
+
+    uint32_t status = RB_FAIL;
+    status = ring_buffer_writev(p_ring_buffer, p_iovec, iovec_count, b_over_write);
+
+    /* Return Status */
+    return status;
+}
+
+/* Error check for read a set of blocks from the Ring Buffer */
+uint32_t ring_buffer_readv_ec(rgbf_t * p_ring_buffer, const rb_iovec_t * p_iovec, uint32_t iovec_count)
+{
+    /* Check if ring buffer pointer is valid */
+    assert(!p_ring_buffer || (p_ring_buffer->buffer_id != (uint32_t)(uintptr_t)p_ring_buffer));
+    if (!p_ring_buffer || (p_ring_buffer->buffer_id != (uint32_t)(uintptr_t)p_ring_buffer))
+    {
+        return RB_PTR_INVALID;
+    }
+
+    /* Check if I/O vector pointer is valid */
+    assert(!p_iovec || !iovec_count);
+    if (!p_iovec || !iovec_count)
+    {
+        return RB_DATA_PTR_INVALID;
+    }
+
+    /* Check each block pointer and the total size to read is correct. */
+    uint32_t size = 0;
+    for (uint32_t i = 0; i < iovec_count; i++)
+    {
+        assert(!p_iovec[i].p_block);
+        if (!p_iovec[i].p_block)
+        {
+            return RB_DATA_PTR_INVALID;
+        }
+
+        assert(p_iovec[i].size > (p_ring_buffer->buffer_size - size));
+        if (p_iovec[i].size > (p_ring_buffer->buffer_size - size))
+        {
+            return RB_BUFFER_SIZE_ERROR;
+        }
+        size += p_iovec[i].size;
+    }
+
+    assert(!size);
+    if (!size)
+    {
+        return RB_BUFFER_SIZE_ERROR;
+    }
+
+    uint32_t status = RB_FAIL;
+    status = ring_buffer_readv(p_ring_buffer, p_iovec, iovec_count);
+
+    return status;
+}
+
+/* Error check for get the unread data of the Ring Buffer in place */
+uint32_t ring_buffer_peek_ec(rgbf_t * p_ring_buffer, rb_iovec_t * p_iovec, uint32_t * p_iovec_count)
+{
+    /* Check if ring buffer pointer is valid */
+    assert(!p_ring_buffer || (p_ring_buffer->buffer_id != (uint32_t)(uintptr_t)p_ring_buffer));
+    if (!p_ring_buffer || (p_ring_buffer->buffer_id != (uint32_t)(uintptr_t)p_ring_buffer))
+    {
+        return RB_PTR_INVALID;
+    }
+
+    /* Check if I/O vector pointer is valid */
+    assert(!p_iovec || !p_iovec_count);
+    if (!p_iovec || !p_iovec_count)
+    {
+        return RB_DATA_PTR_INVALID;
+    }
+
+    uint32_t status = RB_FAIL;
+    status = ring_buffer_peek(p_ring_buffer, p_iovec, p_iovec_count);
+
+    return status;
+}
+
+/* Error check for skip unread data of the Ring Buffer */
+uint32_t ring_buffer_skip_ec(rgbf_t * p_ring_buffer, uint32_t size)
+{
+    /* Check if ring buffer pointer is valid */
+    assert(!p_ring_buffer || (p_ring_buffer->buffer_id != (uint32_t)(uintptr_t)p_ring_buffer));
+    if (!p_ring_buffer || (p_ring_buffer->buffer_id != (uint32_t)(uintptr_t)p_ring_buffer))
+    {
+        return RB_PTR_INVALID;
+    }
+
+    /* Check size is correct */
+    assert(!size || (size > p_ring_buffer->buffer_size));
+    if (!size || (size > p_ring_buffer->buffer_size))
+    {
+        return RB_BUFFER_SIZE_ERROR;
+    }
+
+    uint32_t status = RB_FAIL;
+    status = ring_buffer_skip(p_ring_buffer, size);
+
+    return status;
+}
+
+/* Error check for create Ring Buffer with the allocator function */
+uint32_t create_ring_buffer_with_allocator_ec(rgbf_t ** p_ring_buffer, uint32_t size, const rb_allocator_t * p_allocator)
+{
+    /* Check is ring buffer pointer is valid */
+    assert(!p_ring_buffer || *p_ring_buffer != NULL);
+    if (!p_ring_buffer || *p_ring_buffer != NULL)
+    {
+        return RB_PTR_INVALID;
+    }
+
+    /* Check if the the buffer size is correct */
+    assert(size > RINGBUFFER_SIZE_MAX || size < RINGBUFFER_SIZE_MIN);
+    if (size > RINGBUFFER_SIZE_MAX || size < RINGBUFFER_SIZE_MIN)
+    {
+        return RB_BUFFER_SIZE_ERROR;
+    }
+
+    /* Check the allocator functions are set */
+    assert(p_allocator && (!p_allocator->p_alloc || !p_allocator->p_free));
+    if (p_allocator && (!p_allocator->p_alloc || !p_allocator->p_free))
+    {
+        return RB_DATA_PTR_INVALID;
+    }
+
+    uint32_t status = RB_FAIL;
+    status = create_ring_buffer_with_allocator(p_ring_buffer, size, p_allocator);
+
+    /* Return Status */
+    return status;
+}
+
+/* Error check for set the allocator of the ring buffers */
+uint32_t ring_buffer_set_allocator_ec(const rb_allocator_t * p_allocator)
+{
+    /* Check the allocator functions are set */
+    assert(p_allocator && (!p_allocator->p_alloc || !p_allocator->p_free));
+    if (p_allocator && (!p_allocator->p_alloc || !p_allocator->p_free))
+    {
+        return RB_DATA_PTR_INVALID;
+    }
+
+    uint32_t status = RB_FAIL;
+    status = ring_buffer_set_allocator(p_allocator);
+
+    return status;
+}
+
+/* Error check for initialize the counting allocator */
+uint32_t ring_buffer_counting_allocator_init_ec(rb_counting_allocator_t * p_counting_allocator, const rb_allocator_t * p_backing_allocator)
+{
+    /* Check if counting allocator pointer is valid */
+    assert(!p_counting_allocator);
+    if (!p_counting_allocator)
+    {
+        return RB_PTR_INVALID;
+    }
+
+    /* Check the backing allocator functions are set and it is not the counting allocator itself */
+    assert(p_backing_allocator && (!p_backing_allocator->p_alloc || !p_backing_allocator->p_free ||
+        (p_backing_allocator == &p_counting_allocator->allocator)));
+    if (p_backing_allocator && (!p_backing_allocator->p_alloc || !p_backing_allocator->p_free ||
+        (p_backing_allocator == &p_counting_allocator->allocator)))
+    {
+        return RB_DATA_PTR_INVALID;
+    }
+
+    uint32_t status = RB_FAIL;
+    status = ring_buffer_counting_allocator_init(p_counting_allocator, p_backing_allocator);
+
+    return status;
+}
+
+/* Error check for reset the counts of the counting allocator */
+uint32_t ring_buffer_counting_allocator_reset_ec(rb_counting_allocator_t * p_counting_allocator)
+{
+    /* Check if counting allocator pointer is valid and initialized */
+    assert(!p_counting_allocator || (p_counting_allocator->allocator.p_allocator_context != p_counting_allocator));
+    if (!p_counting_allocator || (p_counting_allocator->allocator.p_allocator_context != p_counting_allocator))
+    {
+        return RB_PTR_INVALID;
+    }
+
+    uint32_t status = RB_FAIL;
+    status = ring_buffer_counting_allocator_reset(p_counting_allocator);
+
+    return status;
+}
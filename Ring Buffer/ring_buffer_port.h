@@ -9,8 +9,8 @@
  *
  */
 
-#ifndef __DATA_TYPES__
-#define __DATA_TYPES__
+#ifndef __RB_PORT_H__
+#define __RB_PORT_H__
 
 
 #include <stdio.h>
@@ -19,10 +19,38 @@
 
 
 /*
- * If the compiler recognize bool data type, then define BOOL_AWARE in this file.
+ * The fixed width integer types of stdint.h are used if the target has stdint.h (C99 and later), else the fixed width integer
+ * types are defined below. Set RB_PORT_HAS_STDINT to 0 if the target has no stdint.h, it should be the same as
+ * TLV_PORT_HAS_STDINT if the TLV API is included too.
  */
+#ifndef RB_PORT_HAS_STDINT
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#define RB_PORT_HAS_STDINT     1
+#else
+#define RB_PORT_HAS_STDINT     0
+#endif
+#endif /* RB_PORT_HAS_STDINT */
 
+/*
+ * The counts of the counting allocator are atomic (C11 stdatomic.h), one counting allocator can count the allocations of
+ * all the threads. Set RB_ATOMIC_COUNTS to 0 if the target has no stdatomic.h, the counts are then not atomic and the
+ * counting allocator should be used by one thread only.
+ */
+#ifndef RB_ATOMIC_COUNTS
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#define RB_ATOMIC_COUNTS       1
+#else
+#define RB_ATOMIC_COUNTS       0
+#endif
+#endif /* RB_ATOMIC_COUNTS */
 
+/*
+ * If the compiler recognize bool data type, then define BOOL_AWARE in this file.
+ */
+
+#if (0 < RB_PORT_HAS_STDINT)
+#include <stdint.h>
+#else
 #ifndef uint8_t
 typedef unsigned char uint8_t;
 #endif /* uint8_t */
@@ -35,6 +63,21 @@ typedef unsigned short uint16_t;
 typedef unsigned int uint32_t;
 #endif /* uint32_t */
 
+#ifndef uint64_t
+typedef unsigned long long uint64_t;
+#endif /* uint64_t */
+
+#ifndef uintptr_t
+typedef unsigned long uintptr_t;
+#endif /* uintptr_t */
+#endif /* RB_PORT_HAS_STDINT */
+
+/*
+ * bool_t is shared with the port headers of the other modules (e.g. tlv_port.h), it is defined by the port header included first.
+ */
+#ifndef __DATA_TYPES__
+#define __DATA_TYPES__
+
 #ifndef bool_t
 
 #ifndef BOOL_AWARE
@@ -54,3 +97,50 @@ typedef bool bool_t;
 #endif /* bool_t */
 
 #endif /* __DATA_TYPES__ */
+
+#endif /* __RB_PORT_H__ */
+
+#ifndef __RB_ALLOCATOR__
+#define __RB_ALLOCATOR__
+
+/* Count of the counting allocator (atomic with RB_ATOMIC_COUNTS). */
+#if (0 < RB_ATOMIC_COUNTS)
+#include <stdatomic.h>
+typedef _Atomic uint64_t    rb_allocator_count_t;
+#else
+typedef uint64_t            rb_allocator_count_t;
+#endif /* RB_ATOMIC_COUNTS */
+
+/*
+ * Ring buffer allocator, the ring buffers (and flight recorders) are allocated and freed with the allocator functions
+ * (e.g. a size class allocator) instead of calloc and free. p_alloc and p_free should be set, p_realloc and
+ * p_aligned_alloc are optional (NULL). The allocator context is passed to each function.
+ */
+typedef struct rb_allocator
+{
+    void       * (*p_alloc)(void * p_allocator_context, size_t size);
+    void         (*p_free)(void * p_allocator_context, void * p_memory);
+    void       * (*p_realloc)(void * p_allocator_context, void * p_memory, size_t size);
+    void       * (*p_aligned_alloc)(void * p_allocator_context, size_t alignment, size_t size);
+    void       * p_allocator_context;
+
+}rb_allocator_t;
+
+/*
+ * Counting allocator, counts the allocations, frees and allocated bytes and forwards them to the backing allocator
+ * (profiling). Counts are atomic with RB_ATOMIC_COUNTS. A realloc of allocated memory is
+ * counted as a reallocation with the new size, a realloc of NULL is counted as an allocation.
+ */
+typedef struct rb_counting_allocator
+{
+    rb_allocator_t          allocator;
+    const rb_allocator_t  * p_backing_allocator;
+    rb_allocator_count_t    allocation_count;
+    rb_allocator_count_t    free_count;
+    rb_allocator_count_t    allocated_bytes;
+    rb_allocator_count_t    reallocation_count;
+    rb_allocator_count_t    reallocated_bytes;
+
+}rb_counting_allocator_t;
+
+#endif /* __RB_ALLOCATOR__ */
@@ -0,0 +1,215 @@
+/*
+ * Name: ring_buffer_static.h
+ *
+ * Description:
+ * Statically allocated ring buffer (no heap use). The ring buffer type and its functions are
+ * declared by a macro with compile time size, all functions are inline.
+ * Write, read and reset semantics are the same as the ring buffer api (ring_buffer.c).
+ * Application code should #include this file to use statically allocated ring buffers.
+ *
+ * Example:
+ *   DECLARE_STATIC_RING_BUFFER(uart_rx, 256U)
+ *   static uart_rx_rgbf_t uart_rx = STATIC_RING_BUFFER_INIT;
+ *   status = byte_write_to_uart_rx(&uart_rx, &byte, FALSE);
+ *   status = read_block_from_uart_rx(&uart_rx, block, 16U);
+ *
+ * Author: Hemant Pundpal                                 Date: 19 Oct 2026
+ *
+ */
+
+#ifndef __RING_BUFFER_STATIC__
+#define __RING_BUFFER_STATIC__
+
+#include <string.h>
+
+#include "ring_buffer_api.h"
+
+/* Initializer for a statically allocated ring buffer (empty). */
+#define STATIC_RING_BUFFER_INIT    { 0U, 0U, FALSE, { 0U } }
+
+/*
+ * Copy a block to or from a statically allocated ring buffer (same library memcpy as ring_buffer.c).
+ * The block size is bounded by the compile time ring buffer size, with the bound known GCC expands memcpy inline
+ * (rep movs), which is several times slower than the library memcpy for blocks of 16 octets and more.
+ * This is a deliberate GCC only workaround: the copy is kept out of line (noipa) so that the bound is not known and
+ * the library memcpy is called, at the cost of a call per block copy. Clang and other compilers keep the copy static
+ * inline. The byte functions do not copy blocks and are inline with all compilers (static_byte_write_read row of
+ * ring_buffer_bench.c, the block copy is measured by the static_block_write_read rows).
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+#define STATIC_RING_BUFFER_COPY    static __attribute__((noipa, unused))
+#else
+#define STATIC_RING_BUFFER_COPY    static inline
+#endif /* __GNUC__ */
+
+STATIC_RING_BUFFER_COPY void copy_static_ring_buffer_block(uint8_t * p_destination, const uint8_t * p_source, uint32_t block_size)
+{
+    memcpy(p_destination, p_source, block_size);
+}
+
+/*
+ * Declare a statically allocated ring buffer type <name>_rgbf_t of <size> octets and its functions:
+ * - byte_write_to_<name>(p_ring_buffer, p_byte, b_over_write)
+ * - block_write_to_<name>(p_ring_buffer, p_block, size, b_over_write)
+ * - read_byte_from_<name>(p_ring_buffer, p_byte)
+ * - read_block_from_<name>(p_ring_buffer, p_block, size)
+ * - reset_<name>(p_ring_buffer)
+ *
+ * Note: Pointers are not checked. Block size is checked (RB_BUFFER_SIZE_ERROR) as the size is not a constant.
+ */
+#define DECLARE_STATIC_RING_BUFFER(name, size)                                                                      \
+                                                                                                                    \
+typedef struct name##_ring_buffer                                                                                   \
+{                                                                                                                   \
+    uint32_t     write_index;                                                                                       \
+    uint32_t     read_index;                                                                                        \
+    bool_t       b_data_unread;                                                                                     \
+    uint8_t      buffer[(size)];                                                                                    \
+                                                                                                                    \
+}name##_rgbf_t;                                                                                                     \
+                                                                                                                    \
+/* Write a Byte to Ring Buffer */                                                                                   \
+static inline uint32_t byte_write_to_##name(name##_rgbf_t * p_ring_buffer, const uint8_t * p_byte, bool_t b_over_write) \
+{                                                                                                                   \
+    /* Check size if available */                                                                                   \
+    uint32_t status = ((p_ring_buffer->b_data_unread != TRUE) ||                                                    \
+        (p_ring_buffer->write_index != p_ring_buffer->read_index)) ? RB_SUCCESS : RB_FAIL;                          \
+                                                                                                                    \
+    /* If size available or over write set */                                                                       \
+    if ((status == RB_SUCCESS) || b_over_write)                                                                     \
+    {                                                                                                               \
+        p_ring_buffer->buffer[p_ring_buffer->write_index] = *p_byte;                                                \
+                                                                                                                    \
+        /* Increment the write index, check if rolling over */                                                      \
+        p_ring_buffer->write_index = (p_ring_buffer->write_index == ((size) - 1U)) ? 0U : (p_ring_buffer->write_index + 1U); \
+        p_ring_buffer->b_data_unread = TRUE;                                                                        \
+                                                                                                                    \
+        /* Check if it is a overwrite */                                                                            \
+        if (status == RB_FAIL)                                                                                      \
+        {                                                                                                           \
+            p_ring_buffer->read_index = p_ring_buffer->write_index;                                                 \
+            status = RB_SUCCESS;                                                                                    \
+        }                                                                                                           \
+    }                                                                                                               \
+                                                                                                                    \
+    return status;                                                                                                  \
+}                                                                                                                   \
+                                                                                                                    \
+/* Write a block to Ring Buffer */                                                                                  \
+static inline uint32_t block_write_to_##name(name##_rgbf_t * p_ring_buffer, const uint8_t * p_block, uint32_t block_size, bool_t b_over_write) \
+{                                                                                                                   \
+    uint32_t status = RB_FAIL;                                                                                      \
+                                                                                                                    \
+    if ((block_size == 0U) || (block_size > (size)))                                                                \
+    {                                                                                                               \
+        return RB_BUFFER_SIZE_ERROR;                                                                                \
+    }                                                                                                               \
+                                                                                                                    \
+    /* Check is buffer is empty, else if required size is smaller than available size. */                          \
+    if (p_ring_buffer->b_data_unread != TRUE)                                                                       \
+    {                                                                                                               \
+        status = RB_SUCCESS;                                                                                        \
+    }                                                                                                               \
+    else if (p_ring_buffer->read_index != p_ring_buffer->write_index)                                               \
+    {                                                                                                               \
+        uint32_t available_size = (p_ring_buffer->read_index < p_ring_buffer->write_index) ?                        \
+            ((size) - (p_ring_buffer->write_index - p_ring_buffer->read_index)) :                                   \
+            (p_ring_buffer->read_index - p_ring_buffer->write_index);                                               \
+        status = (available_size >= block_size) ? RB_SUCCESS : RB_FAIL;                                             \
+    }                                                                                                               \
+                                                                                                                    \
+    if ((status == RB_SUCCESS) || b_over_write)                                                                     \
+    {                                                                                                               \
+        /* Write the block, up to the end of the buffer and then the rolled over part. */                           \
+        uint32_t first_size = (size) - p_ring_buffer->write_index;                                                  \
+        first_size = (first_size > block_size) ? block_size : first_size;                                           \
+        copy_static_ring_buffer_block(&p_ring_buffer->buffer[p_ring_buffer->write_index], p_block, first_size);     \
+        copy_static_ring_buffer_block(p_ring_buffer->buffer, &p_block[first_size], (block_size - first_size));      \
+                                                                                                                    \
+        p_ring_buffer->write_index += block_size;                                                                   \
+        p_ring_buffer->write_index -= (p_ring_buffer->write_index >= (size)) ? (size) : 0U;                         \
+        p_ring_buffer->b_data_unread = TRUE;                                                                        \
+                                                                                                                    \
+        /* Check if it is a overwrite */                                                                            \
+        if (status == RB_FAIL)                                                                                      \
+        {                                                                                                           \
+            p_ring_buffer->read_index = p_ring_buffer->write_index;                                                 \
+            status = RB_SUCCESS;                                                                                    \
+        }                                                                                                           \
+    }                                                                                                               \
+                                                                                                                    \
+    return status;                                                                                                  \
+}                                                                                                                   \
+                                                                                                                    \
+/* Read a byte from the Ring Buffer */                                                                              \
+static inline uint32_t read_byte_from_##name(name##_rgbf_t * p_ring_buffer, uint8_t * p_byte)                       \
+{                                                                                                                   \
+    /* Check if there is unread data. */                                                                            \
+    if (p_ring_buffer->b_data_unread != TRUE)                                                                       \
+    {                                                                                                               \
+        return RB_FAIL;                                                                                             \
+    }                                                                                                               \
+                                                                                                                    \
+    *p_byte = p_ring_buffer->buffer[p_ring_buffer->read_index];                                                     \
+                                                                                                                    \
+    /* Increment the read index, check if rolling over */                                                           \
+    p_ring_buffer->read_index = (p_ring_buffer->read_index == ((size) - 1U)) ? 0U : (p_ring_buffer->read_index + 1U); \
+                                                                                                                    \
+    /* All data read, reset data unread flag. */                                                                    \
+    p_ring_buffer->b_data_unread = (p_ring_buffer->read_index == p_ring_buffer->write_index) ? FALSE : TRUE;        \
+                                                                                                                    \
+    return RB_SUCCESS;                                                                                              \
+}                                                                                                                   \
+                                                                                                                    \
+/* Read a block from the Ring Buffer */                                                                             \
+static inline uint32_t read_block_from_##name(name##_rgbf_t * p_ring_buffer, uint8_t * p_block, uint32_t block_size) \
+{                                                                                                                   \
+    uint32_t status = RB_FAIL;                                                                                      \
+                                                                                                                    \
+    if ((block_size == 0U) || (block_size > (size)))                                                                \
+    {                                                                                                               \
+        return RB_BUFFER_SIZE_ERROR;                                                                                \
+    }                                                                                                               \
+                                                                                                                    \
+    /* Check if required size is smaller than unread size, or the buffer is full. */                                \
+    if (p_ring_buffer->read_index != p_ring_buffer->write_index)                                                    \
+    {                                                                                                               \
+        uint32_t available_size = (p_ring_buffer->write_index < p_ring_buffer->read_index) ?                        \
+            ((size) - (p_ring_buffer->read_index - p_ring_buffer->write_index)) :                                   \
+            (p_ring_buffer->write_index - p_ring_buffer->read_index);                                               \
+        status = (available_size >= block_size) ? RB_SUCCESS : RB_FAIL;                                             \
+    }                                                                                                               \
+    else if (p_ring_buffer->b_data_unread == TRUE)                                                                  \
+    {                                                                                                               \
+        status = RB_SUCCESS;                                                                                        \
+    }                                                                                                               \
+                                                                                                                    \
+    if (status == RB_SUCCESS)                                                                                       \
+    {                                                                                                               \
+        /* Read the block, up to the end of the buffer and then the rolled over part. */                            \
+        uint32_t first_size = (size) - p_ring_buffer->read_index;                                                   \
+        first_size = (first_size > block_size) ? block_size : first_size;                                           \
+        copy_static_ring_buffer_block(p_block, &p_ring_buffer->buffer[p_ring_buffer->read_index], first_size);      \
+        copy_static_ring_buffer_block(&p_block[first_size], p_ring_buffer->buffer, (block_size - first_size));      \
+                                                                                                                    \
+        p_ring_buffer->read_index += block_size;                                                                    \
+        p_ring_buffer->read_index -= (p_ring_buffer->read_index >= (size)) ? (size) : 0U;                           \
+                                                                                                                    \
+        /* Reset data unread */                                                                                     \
+        p_ring_buffer->b_data_unread = (p_ring_buffer->read_index == p_ring_buffer->write_index) ? FALSE : TRUE;    \
+    }                                                                                                               \
+                                                                                                                    \
+    return status;                                                                                                  \
+}                                                                                                                   \
+                                                                                                                    \
+/* Reset the Ring Buffer */                                                                                         \
+static inline uint32_t reset_##name(name##_rgbf_t * p_ring_buffer)                                                  \
+{                                                                                                                   \
+    p_ring_buffer->write_index = 0U;                                                                                \
+    p_ring_buffer->read_index = 0U;                                                                                 \
+    p_ring_buffer->b_data_unread = FALSE;                                                                           \
+                                                                                                                    \
+    return RB_SUCCESS;                                                                                              \
+}
+
+#endif /* __RING_BUFFER_STATIC__ */
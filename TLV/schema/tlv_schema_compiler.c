@@ -0,0 +1,669 @@
+/*
+ * Name: tlv_schema_compiler.c
+ *
+ * Description:
+ * TLV schema compiler, generates the encode and decode functions of an application struct from a TLV schema.
+ * The generated functions are straight-line code: tag and length octets are precomputed (no tag to app data map,
+ * no TLV objects and no memory allocation), encode and decode are memcpy() and integer conversions.
+ *
+ * Build (from the TLV directory):
+ *     gcc -std=c11 -I. -o tlv_schema_compiler schema/tlv_schema_compiler.c tlv_definition.c
+ * Use:
+ *     tlv_schema_compiler <schema file> <output directory>
+ *
+ * Schema file format (one directive per line, '#' starts a comment):
+ *     schema     <name>                                        generated <name>.h, <name>.c and <name>_encode() / <name>_decode()
+ *     include    "<header>"                                     header of the application struct (can be repeated)
+ *     struct     <type>                                         application struct type
+ *     container  <tag name> <tag>                               container TLV object of indefinite length (can be nested)
+ *     end                                                       end of the last container
+ *     integer    <member> <c type> <tag name> <tag>             signed integer (int8_t, int16_t, int32_t, uint8_t, uint16_t, uint32_t)
+ *     value      <member> <c type> <tag name> <tag>             value octets of the member as is (same as the app data layer)
+ *     string     <member> <tag name> <tag> <length>             string of length octets, member is a char array of length + 1 (null terminated)
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#define TLV_OBJECT_SOURCE_CODE
+
+#include <string.h>
+#include <ctype.h>
+
+#include "tlv_api.h"
+#include "tlv_definition.h"
+
+/* Schema limits. */
+#define SCHEMA_MAX_LINE_LENGTH          256U
+#define SCHEMA_MAX_TOKENS               8U
+#define SCHEMA_MAX_NAME_LENGTH          64U
+#define SCHEMA_MAX_INCLUDES             8U
+#define SCHEMA_MAX_ITEMS                128U
+#define SCHEMA_MAX_CONTAINER_DEPTH      8U
+
+/* Maximum number of tag and length octets of a TLV object. */
+#define SCHEMA_MAX_HEADER_OCTETS        (TAG_4OCTET + VALUE_LENGTH_5OCTET)
+
+/* Schema item kind. */
+typedef enum
+{
+    SCHEMA_CONTAINER = 0,
+    SCHEMA_END,
+    SCHEMA_INTEGER,
+    SCHEMA_VALUE,
+    SCHEMA_STRING
+} schema_item_kind_t;
+
+/* Schema item, a container, end of container or a field of the application struct. */
+typedef struct schema_item
+{
+    schema_item_kind_t    kind;
+    char                  member[SCHEMA_MAX_NAME_LENGTH];
+    char                  c_type[SCHEMA_MAX_NAME_LENGTH];
+    char                  tag_name[SCHEMA_MAX_NAME_LENGTH];
+    uint32_t              tag;
+
+    /* Value length (string) or size of the c type (integer and value). */
+    uint32_t              value_length;
+
+    /* Precomputed tag octets and tag with length octets (integer length is encoded at run time). */
+    uint8_t               header[SCHEMA_MAX_HEADER_OCTETS];
+    uint32_t              tag_octet_count;
+    uint32_t              header_octet_count;
+} schema_item_t;
+
+/* TLV schema. */
+typedef struct schema
+{
+    char                  name[SCHEMA_MAX_NAME_LENGTH];
+    char                  upper_name[SCHEMA_MAX_NAME_LENGTH];
+    char                  struct_type[SCHEMA_MAX_NAME_LENGTH];
+    char                  include[SCHEMA_MAX_INCLUDES][SCHEMA_MAX_NAME_LENGTH];
+    uint32_t              include_count;
+    schema_item_t         item[SCHEMA_MAX_ITEMS];
+    uint32_t              item_count;
+    uint32_t              max_encoded_length;
+} schema_t;
+
+/* C types supported for the integer and value fields. */
+static const struct
+{
+    const char          * p_c_type;
+    uint32_t              size;
+} c_types[] =
+{
+    { "int8_t", 1U }, { "int16_t", 2U }, { "int32_t", 4U },
+    { "uint8_t", 1U }, { "uint16_t", 2U }, { "uint32_t", 4U },
+    { "char", 1U }
+};
+
+static schema_t schema;
+
+/* Parse the schema file, returns 0 on success. */
+static int32_t parse_schema(FILE * p_schema_file);
+
+/* Parse one schema item (container or field), returns 0 on success. */
+static int32_t parse_schema_item(char * p_tokens[], uint32_t token_count, uint32_t line_number);
+
+/* Precompute the tag and length octets of the schema items, returns 0 on success. */
+static int32_t compute_schema_headers(void_t);
+
+/* Generate the header file and source file of the schema. */
+static int32_t generate_header_file(const char * p_output_directory);
+static int32_t generate_source_file(const char * p_output_directory);
+
+/* Write the precomputed octets of the schema item. */
+static void_t write_octets(FILE * p_file, const uint8_t * p_octets, uint32_t octet_count);
+
+int main(int argc, char * argv[])
+{
+    FILE * p_schema_file = NULL;
+    int32_t status = 0;
+
+    if (3 != argc)
+    {
+        fprintf(stderr, "usage: %s <schema file> <output directory>\n", argv[0]);
+        return 1;
+    }
+
+    p_schema_file = fopen(argv[1], "r");
+    if (!p_schema_file)
+    {
+        fprintf(stderr, "%s: cannot open schema file\n", argv[1]);
+        return 1;
+    }
+
+    status = parse_schema(p_schema_file);
+    fclose(p_schema_file);
+
+    if (!status)
+    {
+        status = compute_schema_headers();
+    }
+    if (!status)
+    {
+        status = generate_header_file(argv[2]);
+    }
+    if (!status)
+    {
+        status = generate_source_file(argv[2]);
+    }
+
+    return (status) ? 1 : 0;
+}
+
+/* Parse the schema file, returns 0 on success. */
+static int32_t parse_schema(FILE * p_schema_file)
+{
+    char line[SCHEMA_MAX_LINE_LENGTH];
+    uint32_t line_number = 0U;
+    uint32_t container_depth = 0U;
+
+    while (fgets(line, (int)sizeof(line), p_schema_file))
+    {
+        char * p_tokens[SCHEMA_MAX_TOKENS];
+        uint32_t token_count = 0U;
+        char * p_comment = strchr(line, '#');
+
+        line_number++;
+        if (p_comment)
+        {
+            *p_comment = '\0';
+        }
+
+        /* Split the line into tokens. */
+        for (char * p_token = strtok(line, " \t\r\n"); p_token; p_token = strtok(NULL, " \t\r\n"))
+        {
+            if (SCHEMA_MAX_TOKENS == token_count)
+            {
+                fprintf(stderr, "line %u: too many tokens\n", line_number);
+                return -1;
+            }
+            p_tokens[token_count++] = p_token;
+        }
+
+        if (!token_count)
+        {
+            continue;
+        }
+
+        if ((!strcmp(p_tokens[0], "schema")) && (2U == token_count) && (strlen(p_tokens[1]) < SCHEMA_MAX_NAME_LENGTH))
+        {
+            strcpy(schema.name, p_tokens[1]);
+            for (uint32_t i = 0U; schema.name[i]; i++)
+            {
+                schema.upper_name[i] = (char)toupper((unsigned char)schema.name[i]);
+            }
+        }
+        else if ((!strcmp(p_tokens[0], "include")) && (2U == token_count) && (strlen(p_tokens[1]) < SCHEMA_MAX_NAME_LENGTH) &&
+            (schema.include_count < SCHEMA_MAX_INCLUDES))
+        {
+            strcpy(schema.include[schema.include_count++], p_tokens[1]);
+        }
+        else if ((!strcmp(p_tokens[0], "struct")) && (2U == token_count) && (strlen(p_tokens[1]) < SCHEMA_MAX_NAME_LENGTH))
+        {
+            strcpy(schema.struct_type, p_tokens[1]);
+        }
+        else
+        {
+            if (parse_schema_item(p_tokens, token_count, line_number))
+            {
+                return -1;
+            }
+
+            /* Containers should be closed in order. */
+            if (SCHEMA_CONTAINER == schema.item[schema.item_count - 1U].kind)
+            {
+                if (SCHEMA_MAX_CONTAINER_DEPTH == container_depth)
+                {
+                    fprintf(stderr, "line %u: too many nested containers\n", line_number);
+                    return -1;
+                }
+                container_depth++;
+            }
+            else if (SCHEMA_END == schema.item[schema.item_count - 1U].kind)
+            {
+                if (!container_depth)
+                {
+                    fprintf(stderr, "line %u: end without container\n", line_number);
+                    return -1;
+                }
+                container_depth--;
+            }
+        }
+    }
+
+    if ((!schema.name[0]) || (!schema.struct_type[0]) || (!schema.item_count) || (container_depth))
+    {
+        fprintf(stderr, "schema, struct and at least one field are required, all containers should be closed\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+/* Parse one schema item (container or field), returns 0 on success. */
+static int32_t parse_schema_item(char * p_tokens[], uint32_t token_count, uint32_t line_number)
+{
+    schema_item_t * p_item = NULL;
+    uint32_t tag_token = 0U;
+
+    if (SCHEMA_MAX_ITEMS == schema.item_count)
+    {
+        fprintf(stderr, "line %u: too many schema items\n", line_number);
+        return -1;
+    }
+    p_item = &schema.item[schema.item_count];
+    for (uint32_t i = 1U; i < token_count; i++)
+    {
+        if (strlen(p_tokens[i]) >= SCHEMA_MAX_NAME_LENGTH)
+        {
+            fprintf(stderr, "line %u: name too long\n", line_number);
+            return -1;
+        }
+    }
+
+    if ((!strcmp(p_tokens[0], "container")) && (3U == token_count))
+    {
+        p_item->kind = SCHEMA_CONTAINER;
+        strcpy(p_item->tag_name, p_tokens[1]);
+        tag_token = 2U;
+    }
+    else if ((!strcmp(p_tokens[0], "end")) && (1U == token_count))
+    {
+        p_item->kind = SCHEMA_END;
+    }
+    else if (((!strcmp(p_tokens[0], "integer")) || (!strcmp(p_tokens[0], "value"))) && (5U == token_count))
+    {
+        p_item->kind = (!strcmp(p_tokens[0], "integer")) ? SCHEMA_INTEGER : SCHEMA_VALUE;
+        strcpy(p_item->member, p_tokens[1]);
+        strcpy(p_item->c_type, p_tokens[2]);
+        strcpy(p_item->tag_name, p_tokens[3]);
+        tag_token = 4U;
+
+        for (uint32_t i = 0U; i < (uint32_t)(sizeof(c_types) / sizeof(c_types[0])); i++)
+        {
+            if (!strcmp(p_item->c_type, c_types[i].p_c_type))
+            {
+                p_item->value_length = c_types[i].size;
+            }
+        }
+        if (!p_item->value_length)
+        {
+            fprintf(stderr, "line %u: c type %s is not supported\n", line_number, p_item->c_type);
+            return -1;
+        }
+    }
+    else if ((!strcmp(p_tokens[0], "string")) && (5U == token_count))
+    {
+        p_item->kind = SCHEMA_STRING;
+        strcpy(p_item->member, p_tokens[1]);
+        strcpy(p_item->tag_name, p_tokens[2]);
+        tag_token = 3U;
+        p_item->value_length = (uint32_t)strtoul(p_tokens[4], NULL, 0);
+        if ((!p_item->value_length) || (APP_TAG_MAX_VALUE_LENGTH < p_item->value_length))
+        {
+            fprintf(stderr, "line %u: string length should be 1 to %u\n", line_number, APP_TAG_MAX_VALUE_LENGTH);
+            return -1;
+        }
+    }
+    else
+    {
+        fprintf(stderr, "line %u: unknown directive %s\n", line_number, p_tokens[0]);
+        return -1;
+    }
+
+    if (tag_token)
+    {
+        p_item->tag = (uint32_t)strtoul(p_tokens[tag_token], NULL, 0);
+        if ((TAG_END_OF_CONTENT == p_item->tag) || (TAG_MAX_EXTENDED < p_item->tag) ||
+            ((SCHEMA_CONTAINER == p_item->kind) && (TAG_MAX_UNIVERSAL >= p_item->tag)))
+        {
+            fprintf(stderr, "line %u: tag %u is not supported\n", line_number, p_item->tag);
+            return -1;
+        }
+    }
+
+    schema.item_count++;
+    return 0;
+}
+
+/* Precompute the tag and length octets of the schema items, returns 0 on success. */
+static int32_t compute_schema_headers(void_t)
+{
+    for (uint32_t i = 0U; i < schema.item_count; i++)
+    {
+        schema_item_t * p_item = &schema.item[i];
+
+        switch (p_item->kind)
+        {
+            case SCHEMA_CONTAINER:
+            {
+                /* Tag octets and the indefinite length octet, same as the app data layer container. */
+                p_item->tag_octet_count = encode_tag_octets(p_item->header, p_item->tag);
+                p_item->header[p_item->tag_octet_count] = (uint8_t)INDEFINITE_LENGTH;
+                p_item->header_octet_count = p_item->tag_octet_count + VALUE_LENGTH_1OCTET;
+                schema.max_encoded_length += p_item->header_octet_count;
+            }
+            break;
+            case SCHEMA_END:
+            {
+                /* End of contents octets. */
+                schema.max_encoded_length += VALUE_LENGTH_2OCTET;
+            }
+            break;
+            case SCHEMA_INTEGER:
+            {
+                /* Tag octets only, the length octet depends on the value (minimum number of value octets). */
+                p_item->tag_octet_count = encode_tag_octets(p_item->header, p_item->tag);
+                p_item->header_octet_count = p_item->tag_octet_count;
+                schema.max_encoded_length += p_item->header_octet_count + VALUE_LENGTH_1OCTET + p_item->value_length;
+            }
+            break;
+            default:
+            {
+                /* Value and string, tag and length octets are fixed. */
+                p_item->tag_octet_count = encode_tag_octets(p_item->header, p_item->tag);
+                p_item->header_octet_count = p_item->tag_octet_count + encode_length_octets(&p_item->header[p_item->tag_octet_count], p_item->value_length);
+                schema.max_encoded_length += p_item->header_octet_count + p_item->value_length;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* Generate the header file of the schema. */
+static int32_t generate_header_file(const char * p_output_directory)
+{
+    char path[SCHEMA_MAX_LINE_LENGTH];
+    FILE * p_file = NULL;
+
+    snprintf(path, sizeof(path), "%s/%s.h", p_output_directory, schema.name);
+    p_file = fopen(path, "w");
+    if (!p_file)
+    {
+        fprintf(stderr, "%s: cannot create file\n", path);
+        return -1;
+    }
+
+    fprintf(p_file, "/*\n * Name: %s.h\n *\n * Description:\n", schema.name);
+    fprintf(p_file, " * TLV encode and decode functions of %s, generated by tlv_schema_compiler from the TLV schema. Do not edit.\n *\n */\n\n", schema.struct_type);
+    fprintf(p_file, "#ifndef __%s_H__\n#define __%s_H__\n\n", schema.upper_name, schema.upper_name);
+    fprintf(p_file, "#include \"tlv_port.h\"\n#include \"tlv_tag_numbers.h\"\n");
+    for (uint32_t i = 0U; i < schema.include_count; i++)
+    {
+        fprintf(p_file, "#include %s\n", schema.include[i]);
+    }
+    fprintf(p_file, "\n/* Maximum length (number of octets) of the TLV encoded %s. */\n", schema.struct_type);
+    fprintf(p_file, "#define %s_MAX_ENCODED_LENGTH    %uU\n\n", schema.upper_name, schema.max_encoded_length);
+    fprintf(p_file, "/*\n * - Function to encode %s into the TLV data buffer (tag and length octets are precomputed).\n", schema.struct_type);
+    fprintf(p_file, " * - Returns TLV_BAD_BUFFER_LENGTH if the buffer size is less than %s_MAX_ENCODED_LENGTH.\n */\n", schema.upper_name);
+    fprintf(p_file, "uint32_t %s_encode(const %s * p_app_data, uint8_t * p_tlv_data_buffer, uint32_t buffer_size, uint32_t * p_encoded_length);\n\n",
+        schema.name, schema.struct_type);
+    fprintf(p_file, "/*\n * - Function to decode the TLV data buffer into %s, TLV objects are expected in the schema order.\n", schema.struct_type);
+    fprintf(p_file, " * - Returns TLV_BAD_TAG if a tag is not as in the schema, TLV_BAD_DATA_SIZE if a value is too long.\n */\n");
+    fprintf(p_file, "uint32_t %s_decode(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, %s * p_app_data);\n\n",
+        schema.name, schema.struct_type);
+    fprintf(p_file, "#endif /* __%s_H__ */\n", schema.upper_name);
+
+    fclose(p_file);
+    return 0;
+}
+
+/* Generate the source file of the schema. */
+static int32_t generate_source_file(const char * p_output_directory)
+{
+    char path[SCHEMA_MAX_LINE_LENGTH];
+    FILE * p_file = NULL;
+    bool_t b_integer = FALSE;
+    bool_t b_length = FALSE;
+
+    snprintf(path, sizeof(path), "%s/%s.c", p_output_directory, schema.name);
+    p_file = fopen(path, "w");
+    if (!p_file)
+    {
+        fprintf(stderr, "%s: cannot create file\n", path);
+        return -1;
+    }
+
+    for (uint32_t i = 0U; i < schema.item_count; i++)
+    {
+        b_integer = (SCHEMA_INTEGER == schema.item[i].kind) ? TRUE : b_integer;
+        b_length = ((SCHEMA_VALUE == schema.item[i].kind) || (SCHEMA_STRING == schema.item[i].kind)) ? TRUE : b_length;
+    }
+
+    fprintf(p_file, "/*\n * Name: %s.c\n *\n * Description:\n", schema.name);
+    fprintf(p_file, " * TLV encode and decode functions of %s, generated by tlv_schema_compiler from the TLV schema. Do not edit.\n *\n */\n\n", schema.struct_type);
+    fprintf(p_file, "#include <string.h>\n\n#include \"tlv_api.h\"\n#include \"%s.h\"\n\n", schema.name);
+
+    /* Tag numbers of the schema should be same as the application tag numbers. */
+    for (uint32_t i = 0U; i < schema.item_count; i++)
+    {
+        if (SCHEMA_END != schema.item[i].kind)
+        {
+            fprintf(p_file, "#if (%s != %uU)\n#error \"%s is not same as in the TLV schema, generate the code again.\"\n#endif\n",
+                schema.item[i].tag_name, schema.item[i].tag, schema.item[i].tag_name);
+        }
+    }
+    fprintf(p_file, "\n");
+
+    /* Precomputed tag and length octets. */
+    for (uint32_t i = 0U; i < schema.item_count; i++)
+    {
+        const schema_item_t * p_item = &schema.item[i];
+        if (SCHEMA_END != p_item->kind)
+        {
+            fprintf(p_file, "/* %s %s. */\nstatic const uint8_t %s_header_%u[] = { ",
+                p_item->tag_name, (SCHEMA_CONTAINER == p_item->kind) ? "tag and indefinite length octets" :
+                ((SCHEMA_INTEGER == p_item->kind) ? "tag octets" : "tag and length octets"), schema.name, i);
+            write_octets(p_file, p_item->header, p_item->header_octet_count);
+            fprintf(p_file, " };\n");
+        }
+    }
+    fprintf(p_file, "\n");
+
+    if (b_integer)
+    {
+        fprintf(p_file,
+            "/* Encode the length and value octets of the integer, minimum number of value octets (least significant octet first, same as the TLV encoder). */\n"
+            "static uint32_t encode_integer_value(uint8_t * p_tlv_encoded_buffer, int64_t value, uint32_t value_size)\n"
+            "{\n"
+            "    uint32_t value_length = value_size;\n\n"
+            "    for (uint32_t i = 1U; i <= value_size; i++)\n"
+            "    {\n"
+            "        p_tlv_encoded_buffer[i] = (uint8_t)(value & 0xFF);\n"
+            "        value = (value >> 8U);\n"
+            "    }\n\n"
+            "    /* Remove the sign extension octets. */\n"
+            "    while ((value_length > 1U) &&\n"
+            "        (((0x00U == p_tlv_encoded_buffer[value_length]) && (!(p_tlv_encoded_buffer[value_length - 1U] & 0x80U))) ||\n"
+            "        ((0xFFU == p_tlv_encoded_buffer[value_length]) && (p_tlv_encoded_buffer[value_length - 1U] & 0x80U))))\n"
+            "    {\n"
+            "        value_length--;\n"
+            "    }\n"
+            "    p_tlv_encoded_buffer[0] = (uint8_t)value_length;\n\n"
+            "    return (1U + value_length);\n"
+            "}\n\n"
+            "/* Decode the integer value octets (least significant octet first). */\n"
+            "static int64_t decode_integer_value(const uint8_t * p_value, uint32_t value_length)\n"
+            "{\n"
+            "    int64_t value = 0;\n\n"
+            "    for (uint32_t i = value_length; i > 0U; i--)\n"
+            "    {\n"
+            "        value = (value * 256) + p_value[i - 1U];\n"
+            "    }\n"
+            "    if (p_value[value_length - 1U] & 0x80U)\n"
+            "    {\n"
+            "        /* Negative value. */\n"
+            "        value -= ((int64_t)1 << (8U * value_length));\n"
+            "    }\n\n"
+            "    return value;\n"
+            "}\n\n");
+    }
+
+    if (b_length)
+    {
+        fprintf(p_file,
+            "/* Decode the definite length octets, returns number of length octets (0 if not valid). */\n"
+            "static uint32_t decode_length_octets(const uint8_t * p_tlv_encoded_buffer, uint32_t buffer_length, uint32_t * p_value_length)\n"
+            "{\n"
+            "    uint32_t length_octets = 0U;\n\n"
+            "    if ((buffer_length >= 1U) && (!(p_tlv_encoded_buffer[0] & 0x80U)))\n"
+            "    {\n"
+            "        *p_value_length = p_tlv_encoded_buffer[0];\n"
+            "        length_octets = 1U;\n"
+            "    }\n"
+            "    else if ((buffer_length >= 1U) && (p_tlv_encoded_buffer[0] > 0x80U) && (p_tlv_encoded_buffer[0] <= 0x84U) &&\n"
+            "        (buffer_length > (uint32_t)(p_tlv_encoded_buffer[0] & 0x7FU)))\n"
+            "    {\n"
+            "        /* Long form length, 1 to 4 length octets (most significant first). */\n"
+            "        *p_value_length = 0U;\n"
+            "        length_octets = 1U + (uint32_t)(p_tlv_encoded_buffer[0] & 0x7FU);\n"
+            "        for (uint32_t i = 1U; i < length_octets; i++)\n"
+            "        {\n"
+            "            *p_value_length = (*p_value_length << 8U) | p_tlv_encoded_buffer[i];\n"
+            "        }\n"
+            "    }\n\n"
+            "    return length_octets;\n"
+            "}\n\n");
+    }
+
+    /* Encode function. */
+    fprintf(p_file, "/* Function to encode %s into the TLV data buffer (tag and length octets are precomputed). */\n", schema.struct_type);
+    fprintf(p_file, "uint32_t %s_encode(const %s * p_app_data, uint8_t * p_tlv_data_buffer, uint32_t buffer_size, uint32_t * p_encoded_length)\n{\n",
+        schema.name, schema.struct_type);
+    fprintf(p_file, "    uint32_t buffer_index = 0U;\n\n");
+    fprintf(p_file, "    if (buffer_size < %s_MAX_ENCODED_LENGTH)\n    {\n        return TLV_BAD_BUFFER_LENGTH;\n    }\n\n", schema.upper_name);
+    for (uint32_t i = 0U; i < schema.item_count; i++)
+    {
+        const schema_item_t * p_item = &schema.item[i];
+        switch (p_item->kind)
+        {
+            case SCHEMA_CONTAINER:
+            {
+                fprintf(p_file, "    /* %s container. */\n", p_item->tag_name);
+                fprintf(p_file, "    memcpy(&p_tlv_data_buffer[buffer_index], %s_header_%u, %uU);\n", schema.name, i, p_item->header_octet_count);
+                fprintf(p_file, "    buffer_index += %uU;\n\n", p_item->header_octet_count);
+            }
+            break;
+            case SCHEMA_END:
+            {
+                fprintf(p_file, "    /* End of contents octets. */\n");
+                fprintf(p_file, "    p_tlv_data_buffer[buffer_index++] = (uint8_t)TAG_END_OF_CONTENT;\n");
+                fprintf(p_file, "    p_tlv_data_buffer[buffer_index++] = (uint8_t)TAG_END_OF_CONTENT;\n\n");
+            }
+            break;
+            case SCHEMA_INTEGER:
+            {
+                fprintf(p_file, "    /* %s (%s). */\n", p_item->member, p_item->tag_name);
+                fprintf(p_file, "    memcpy(&p_tlv_data_buffer[buffer_index], %s_header_%u, %uU);\n", schema.name, i, p_item->header_octet_count);
+                fprintf(p_file, "    buffer_index += %uU;\n", p_item->header_octet_count);
+                fprintf(p_file, "    buffer_index += encode_integer_value(&p_tlv_data_buffer[buffer_index], (int64_t)p_app_data->%s, %uU);\n\n",
+                    p_item->member, p_item->value_length);
+            }
+            break;
+            default:
+            {
+                fprintf(p_file, "    /* %s (%s). */\n", p_item->member, p_item->tag_name);
+                fprintf(p_file, "    memcpy(&p_tlv_data_buffer[buffer_index], %s_header_%u, %uU);\n", schema.name, i, p_item->header_octet_count);
+                fprintf(p_file, "    buffer_index += %uU;\n", p_item->header_octet_count);
+                fprintf(p_file, "    memcpy(&p_tlv_data_buffer[buffer_index], %sp_app_data->%s, %uU);\n",
+                    (SCHEMA_VALUE == p_item->kind) ? "&" : "", p_item->member, p_item->value_length);
+                fprintf(p_file, "    buffer_index += %uU;\n\n", p_item->value_length);
+            }
+        }
+    }
+    fprintf(p_file, "    *p_encoded_length = buffer_index;\n\n    /* Return status. */\n    return TLV_SUCCESS;\n}\n\n");
+
+    /* Decode function. */
+    fprintf(p_file, "/* Function to decode the TLV data buffer into %s, TLV objects are expected in the schema order. */\n", schema.struct_type);
+    fprintf(p_file, "uint32_t %s_decode(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, %s * p_app_data)\n{\n",
+        schema.name, schema.struct_type);
+    fprintf(p_file, "    uint32_t buffer_index = 0U;\n");
+    if (b_length || b_integer)
+    {
+        fprintf(p_file, "    uint32_t value_length = 0U;\n");
+    }
+    if (b_length)
+    {
+        fprintf(p_file, "    uint32_t length_octets = 0U;\n");
+    }
+    fprintf(p_file, "\n");
+    for (uint32_t i = 0U; i < schema.item_count; i++)
+    {
+        const schema_item_t * p_item = &schema.item[i];
+        switch (p_item->kind)
+        {
+            case SCHEMA_CONTAINER:
+            {
+                fprintf(p_file, "    /* %s container. */\n", p_item->tag_name);
+                fprintf(p_file, "    if (((buffer_index + %uU) > buffer_length) || memcmp(&p_tlv_data_buffer[buffer_index], %s_header_%u, %uU))\n",
+                    p_item->header_octet_count, schema.name, i, p_item->header_octet_count);
+                fprintf(p_file, "    {\n        return TLV_BAD_TAG;\n    }\n");
+                fprintf(p_file, "    buffer_index += %uU;\n\n", p_item->header_octet_count);
+            }
+            break;
+            case SCHEMA_END:
+            {
+                fprintf(p_file, "    /* End of contents octets. */\n");
+                fprintf(p_file, "    if (((buffer_index + 2U) > buffer_length) || p_tlv_data_buffer[buffer_index] || p_tlv_data_buffer[buffer_index + 1U])\n");
+                fprintf(p_file, "    {\n        return TLV_BAD_TAG;\n    }\n");
+                fprintf(p_file, "    buffer_index += 2U;\n\n");
+            }
+            break;
+            case SCHEMA_INTEGER:
+            {
+                fprintf(p_file, "    /* %s (%s). */\n", p_item->member, p_item->tag_name);
+                fprintf(p_file, "    if (((buffer_index + %uU) > buffer_length) || memcmp(&p_tlv_data_buffer[buffer_index], %s_header_%u, %uU))\n",
+                    p_item->header_octet_count + 1U, schema.name, i, p_item->header_octet_count);
+                fprintf(p_file, "    {\n        return TLV_BAD_TAG;\n    }\n");
+                fprintf(p_file, "    buffer_index += %uU;\n", p_item->header_octet_count);
+                fprintf(p_file, "    value_length = p_tlv_data_buffer[buffer_index++];\n");
+                fprintf(p_file, "    if ((!value_length) || (value_length > %uU) || ((buffer_index + value_length) > buffer_length))\n", p_item->value_length);
+                fprintf(p_file, "    {\n        return TLV_BAD_DATA_SIZE;\n    }\n");
+                fprintf(p_file, "    p_app_data->%s = (%s)decode_integer_value(&p_tlv_data_buffer[buffer_index], value_length);\n",
+                    p_item->member, p_item->c_type);
+                fprintf(p_file, "    buffer_index += value_length;\n\n");
+            }
+            break;
+            default:
+            {
+                fprintf(p_file, "    /* %s (%s). */\n", p_item->member, p_item->tag_name);
+                fprintf(p_file, "    if (((buffer_index + %uU) > buffer_length) || memcmp(&p_tlv_data_buffer[buffer_index], %s_header_%u, %uU))\n",
+                    p_item->tag_octet_count, schema.name, i, p_item->tag_octet_count);
+                fprintf(p_file, "    {\n        return TLV_BAD_TAG;\n    }\n");
+                fprintf(p_file, "    buffer_index += %uU;\n", p_item->tag_octet_count);
+                fprintf(p_file, "    length_octets = decode_length_octets(&p_tlv_data_buffer[buffer_index], (buffer_length - buffer_index), &value_length);\n");
+                fprintf(p_file, "    if ((!length_octets) || (value_length > %uU) || ((buffer_index + length_octets + value_length) > buffer_length))\n",
+                    p_item->value_length);
+                fprintf(p_file, "    {\n        return TLV_BAD_DATA_SIZE;\n    }\n");
+                fprintf(p_file, "    buffer_index += length_octets;\n");
+                if (SCHEMA_VALUE == p_item->kind)
+                {
+                    fprintf(p_file, "    memset(&p_app_data->%s, 0, %uU);\n", p_item->member, p_item->value_length);
+                    fprintf(p_file, "    memcpy(&p_app_data->%s, &p_tlv_data_buffer[buffer_index], value_length);\n", p_item->member);
+                }
+                else
+                {
+                    fprintf(p_file, "    memset(p_app_data->%s, 0, %uU);\n", p_item->member, p_item->value_length + 1U);
+                    fprintf(p_file, "    memcpy(p_app_data->%s, &p_tlv_data_buffer[buffer_index], value_length);\n", p_item->member);
+                }
+                fprintf(p_file, "    buffer_index += value_length;\n\n");
+            }
+        }
+    }
+    fprintf(p_file, "    /* Return status. */\n    return TLV_SUCCESS;\n}\n");
+
+    fclose(p_file);
+    return 0;
+}
+
+/* Write the precomputed octets of the schema item. */
+static void_t write_octets(FILE * p_file, const uint8_t * p_octets, uint32_t octet_count)
+{
+    for (uint32_t i = 0U; i < octet_count; i++)
+    {
+        fprintf(p_file, "%s0x%02XU", (i) ? ", " : "", p_octets[i]);
+    }
+}
@@ -0,0 +1,27 @@
+/*
+ * Name: tlv_txn_data.h
+ *
+ * Description:
+ * Transaction data of the TLV schema example (same as the application data of the TLV test application).
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#ifndef __TLV_TXN_DATA_H__
+#define __TLV_TXN_DATA_H__
+
+#include "tlv_port.h"
+
+#define MAX_TXN_REF_LEN         7U
+
+/* Transaction data. */
+typedef struct transaction_data
+{
+    char           s_txn_string[MAX_TXN_REF_LEN + 1U]; /*  null terminated string */
+    int32_t        txn_amount;
+    uint8_t        txn_type;
+    uint16_t       txn_currency_code;
+} txn_data_t;
+
+#endif /* __TLV_TXN_DATA_H__ */
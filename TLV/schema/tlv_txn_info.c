@@ -0,0 +1,239 @@
+/*
+ * Name: tlv_txn_info.c
+ *
+ * Description:
+ * TLV encode and decode functions of txn_data_t, generated by tlv_schema_compiler from the TLV schema. Do not edit.
+ *
+ */
+
+#include <string.h>
+
+#include "tlv_api.h"
+#include "tlv_txn_info.h"
+
+#if (TAG_APP_TXN_INFO != 32U)
+#error "TAG_APP_TXN_INFO is not same as in the TLV schema, generate the code again."
+#endif
+#if (TAG_UTF8STRING != 12U)
+#error "TAG_UTF8STRING is not same as in the TLV schema, generate the code again."
+#endif
+#if (TAG_INTEGER != 2U)
+#error "TAG_INTEGER is not same as in the TLV schema, generate the code again."
+#endif
+#if (TAG_CONT_SPCF_UINT_8 != 160U)
+#error "TAG_CONT_SPCF_UINT_8 is not same as in the TLV schema, generate the code again."
+#endif
+#if (TAG_CONT_SPCF_UINT_16 != 159U)
+#error "TAG_CONT_SPCF_UINT_16 is not same as in the TLV schema, generate the code again."
+#endif
+
+/* TAG_APP_TXN_INFO tag and indefinite length octets. */
+static const uint8_t tlv_txn_info_header_0[] = { 0x7FU, 0x20U, 0x80U };
+/* TAG_UTF8STRING tag and length octets. */
+static const uint8_t tlv_txn_info_header_1[] = { 0x0CU, 0x07U };
+/* TAG_INTEGER tag octets. */
+static const uint8_t tlv_txn_info_header_2[] = { 0x02U };
+/* TAG_CONT_SPCF_UINT_8 tag and length octets. */
+static const uint8_t tlv_txn_info_header_3[] = { 0xBFU, 0x81U, 0x20U, 0x01U };
+/* TAG_CONT_SPCF_UINT_16 tag and length octets. */
+static const uint8_t tlv_txn_info_header_4[] = { 0xBFU, 0x81U, 0x1FU, 0x02U };
+
+/* Encode the length and value octets of the integer, minimum number of value octets (least significant octet first, same as the TLV encoder). */
+static uint32_t encode_integer_value(uint8_t * p_tlv_encoded_buffer, int64_t value, uint32_t value_size)
+{
+    uint32_t value_length = value_size;
+
+    for (uint32_t i = 1U; i <= value_size; i++)
+    {
+        p_tlv_encoded_buffer[i] = (uint8_t)(value & 0xFF);
+        value = (value >> 8U);
+    }
+
+    /* Remove the sign extension octets. */
+    while ((value_length > 1U) &&
+        (((0x00U == p_tlv_encoded_buffer[value_length]) && (!(p_tlv_encoded_buffer[value_length - 1U] & 0x80U))) ||
+        ((0xFFU == p_tlv_encoded_buffer[value_length]) && (p_tlv_encoded_buffer[value_length - 1U] & 0x80U))))
+    {
+        value_length--;
+    }
+    p_tlv_encoded_buffer[0] = (uint8_t)value_length;
+
+    return (1U + value_length);
+}
+
+/* Decode the integer value octets (least significant octet first). */
+static int64_t decode_integer_value(const uint8_t * p_value, uint32_t value_length)
+{
+    int64_t value = 0;
+
+    for (uint32_t i = value_length; i > 0U; i--)
+    {
+        value = (value * 256) + p_value[i - 1U];
+    }
+    if (p_value[value_length - 1U] & 0x80U)
+    {
+        /* Negative value. */
+        value -= ((int64_t)1 << (8U * value_length));
+    }
+
+    return value;
+}
+
+/* Decode the definite length octets, returns number of length octets (0 if not valid). */
+static uint32_t decode_length_octets(const uint8_t * p_tlv_encoded_buffer, uint32_t buffer_length, uint32_t * p_value_length)
+{
+    uint32_t length_octets = 0U;
+
+    if ((buffer_length >= 1U) && (!(p_tlv_encoded_buffer[0] & 0x80U)))
+    {
+        *p_value_length = p_tlv_encoded_buffer[0];
+        length_octets = 1U;
+    }
+    else if ((buffer_length >= 1U) && (p_tlv_encoded_buffer[0] > 0x80U) && (p_tlv_encoded_buffer[0] <= 0x84U) &&
+        (buffer_length > (uint32_t)(p_tlv_encoded_buffer[0] & 0x7FU)))
+    {
+        /* Long form length, 1 to 4 length octets (most significant first). */
+        *p_value_length = 0U;
+        length_octets = 1U + (uint32_t)(p_tlv_encoded_buffer[0] & 0x7FU);
+        for (uint32_t i = 1U; i < length_octets; i++)
+        {
+            *p_value_length = (*p_value_length << 8U) | p_tlv_encoded_buffer[i];
+        }
+    }
+
+    return length_octets;
+}
+
+/* Function to encode txn_data_t into the TLV data buffer (tag and length octets are precomputed). */
+uint32_t tlv_txn_info_encode(const txn_data_t * p_app_data, uint8_t * p_tlv_data_buffer, uint32_t buffer_size, uint32_t * p_encoded_length)
+{
+    uint32_t buffer_index = 0U;
+
+    if (buffer_size < TLV_TXN_INFO_MAX_ENCODED_LENGTH)
+    {
+        return TLV_BAD_BUFFER_LENGTH;
+    }
+
+    /* TAG_APP_TXN_INFO container. */
+    memcpy(&p_tlv_data_buffer[buffer_index], tlv_txn_info_header_0, 3U);
+    buffer_index += 3U;
+
+    /* s_txn_string (TAG_UTF8STRING). */
+    memcpy(&p_tlv_data_buffer[buffer_index], tlv_txn_info_header_1, 2U);
+    buffer_index += 2U;
+    memcpy(&p_tlv_data_buffer[buffer_index], p_app_data->s_txn_string, 7U);
+    buffer_index += 7U;
+
+    /* txn_amount (TAG_INTEGER). */
+    memcpy(&p_tlv_data_buffer[buffer_index], tlv_txn_info_header_2, 1U);
+    buffer_index += 1U;
+    buffer_index += encode_integer_value(&p_tlv_data_buffer[buffer_index], (int64_t)p_app_data->txn_amount, 4U);
+
+    /* txn_type (TAG_CONT_SPCF_UINT_8). */
+    memcpy(&p_tlv_data_buffer[buffer_index], tlv_txn_info_header_3, 4U);
+    buffer_index += 4U;
+    memcpy(&p_tlv_data_buffer[buffer_index], &p_app_data->txn_type, 1U);
+    buffer_index += 1U;
+
+    /* txn_currency_code (TAG_CONT_SPCF_UINT_16). */
+    memcpy(&p_tlv_data_buffer[buffer_index], tlv_txn_info_header_4, 4U);
+    buffer_index += 4U;
+    memcpy(&p_tlv_data_buffer[buffer_index], &p_app_data->txn_currency_code, 2U);
+    buffer_index += 2U;
+
+    /* End of contents octets. */
+    p_tlv_data_buffer[buffer_index++] = (uint8_t)TAG_END_OF_CONTENT;
+    p_tlv_data_buffer[buffer_index++] = (uint8_t)TAG_END_OF_CONTENT;
+
+    *p_encoded_length = buffer_index;
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Function to decode the TLV data buffer into txn_data_t, TLV objects are expected in the schema order. */
+uint32_t tlv_txn_info_decode(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, txn_data_t * p_app_data)
+{
+    uint32_t buffer_index = 0U;
+    uint32_t value_length = 0U;
+    uint32_t length_octets = 0U;
+
+    /* TAG_APP_TXN_INFO container. */
+    if (((buffer_index + 3U) > buffer_length) || memcmp(&p_tlv_data_buffer[buffer_index], tlv_txn_info_header_0, 3U))
+    {
+        return TLV_BAD_TAG;
+    }
+    buffer_index += 3U;
+
+    /* s_txn_string (TAG_UTF8STRING). */
+    if (((buffer_index + 1U) > buffer_length) || memcmp(&p_tlv_data_buffer[buffer_index], tlv_txn_info_header_1, 1U))
+    {
+        return TLV_BAD_TAG;
+    }
+    buffer_index += 1U;
+    length_octets = decode_length_octets(&p_tlv_data_buffer[buffer_index], (buffer_length - buffer_index), &value_length);
+    if ((!length_octets) || (value_length > 7U) || ((buffer_index + length_octets + value_length) > buffer_length))
+    {
+        return TLV_BAD_DATA_SIZE;
+    }
+    buffer_index += length_octets;
+    memset(p_app_data->s_txn_string, 0, 8U);
+    memcpy(p_app_data->s_txn_string, &p_tlv_data_buffer[buffer_index], value_length);
+    buffer_index += value_length;
+
+    /* txn_amount (TAG_INTEGER). */
+    if (((buffer_index + 2U) > buffer_length) || memcmp(&p_tlv_data_buffer[buffer_index], tlv_txn_info_header_2, 1U))
+    {
+        return TLV_BAD_TAG;
+    }
+    buffer_index += 1U;
+    value_length = p_tlv_data_buffer[buffer_index++];
+    if ((!value_length) || (value_length > 4U) || ((buffer_index + value_length) > buffer_length))
+    {
+        return TLV_BAD_DATA_SIZE;
+    }
+    p_app_data->txn_amount = (int32_t)decode_integer_value(&p_tlv_data_buffer[buffer_index], value_length);
+    buffer_index += value_length;
+
+    /* txn_type (TAG_CONT_SPCF_UINT_8). */
+    if (((buffer_index + 3U) > buffer_length) || memcmp(&p_tlv_data_buffer[buffer_index], tlv_txn_info_header_3, 3U))
+    {
+        return TLV_BAD_TAG;
+    }
+    buffer_index += 3U;
+    length_octets = decode_length_octets(&p_tlv_data_buffer[buffer_index], (buffer_length - buffer_index), &value_length);
+    if ((!length_octets) || (value_length > 1U) || ((buffer_index + length_octets + value_length) > buffer_length))
+    {
+        return TLV_BAD_DATA_SIZE;
+    }
+    buffer_index += length_octets;
+    memset(&p_app_data->txn_type, 0, 1U);
+    memcpy(&p_app_data->txn_type, &p_tlv_data_buffer[buffer_index], value_length);
+    buffer_index += value_length;
+
+    /* txn_currency_code (TAG_CONT_SPCF_UINT_16). */
+    if (((buffer_index + 3U) > buffer_length) || memcmp(&p_tlv_data_buffer[buffer_index], tlv_txn_info_header_4, 3U))
+    {
+        return TLV_BAD_TAG;
+    }
+    buffer_index += 3U;
+    length_octets = decode_length_octets(&p_tlv_data_buffer[buffer_index], (buffer_length - buffer_index), &value_length);
+    if ((!length_octets) || (value_length > 2U) || ((buffer_index + length_octets + value_length) > buffer_length))
+    {
+        return TLV_BAD_DATA_SIZE;
+    }
+    buffer_index += length_octets;
+    memset(&p_app_data->txn_currency_code, 0, 2U);
+    memcpy(&p_app_data->txn_currency_code, &p_tlv_data_buffer[buffer_index], value_length);
+    buffer_index += value_length;
+
+    /* End of contents octets. */
+    if (((buffer_index + 2U) > buffer_length) || p_tlv_data_buffer[buffer_index] || p_tlv_data_buffer[buffer_index + 1U])
+    {
+        return TLV_BAD_TAG;
+    }
+    buffer_index += 2U;
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
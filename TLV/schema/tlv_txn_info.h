@@ -0,0 +1,31 @@
+/*
+ * Name: tlv_txn_info.h
+ *
+ * Description:
+ * TLV encode and decode functions of txn_data_t, generated by tlv_schema_compiler from the TLV schema. Do not edit.
+ *
+ */
+
+#ifndef __TLV_TXN_INFO_H__
+#define __TLV_TXN_INFO_H__
+
+#include "tlv_port.h"
+#include "tlv_tag_numbers.h"
+#include "tlv_txn_data.h"
+
+/* Maximum length (number of octets) of the TLV encoded txn_data_t. */
+#define TLV_TXN_INFO_MAX_ENCODED_LENGTH    31U
+
+/*
+ * - Function to encode txn_data_t into the TLV data buffer (tag and length octets are precomputed).
+ * - Returns TLV_BAD_BUFFER_LENGTH if the buffer size is less than TLV_TXN_INFO_MAX_ENCODED_LENGTH.
+ */
+uint32_t tlv_txn_info_encode(const txn_data_t * p_app_data, uint8_t * p_tlv_data_buffer, uint32_t buffer_size, uint32_t * p_encoded_length);
+
+/*
+ * - Function to decode the TLV data buffer into txn_data_t, TLV objects are expected in the schema order.
+ * - Returns TLV_BAD_TAG if a tag is not as in the schema, TLV_BAD_DATA_SIZE if a value is too long.
+ */
+uint32_t tlv_txn_info_decode(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, txn_data_t * p_app_data);
+
+#endif /* __TLV_TXN_INFO_H__ */
@@ -10,6 +10,8 @@
 
 #define TLV_OBJECT_SOURCE_CODE
 
+#include <string.h>
+
 #include "tlv_api.h"
 #include "tlv.h"
 #include "tlv_universal_class.h"
@@ -17,6 +19,50 @@
 #include "tlv_object_parser.h"
 #include "tlv_definition.h"
 
+/* Container TLV object being searched by tlv_search_tag(), its next child TLV object to search and the index of the TLV data buffer to search it from. */
+typedef struct tlv_search_frame
+{
+    tlv_object_t        * p_container_tlv_object;
+    tlv_object_t        * p_child_tlv_object;
+    uint32_t              child_index;
+    uint32_t              buffer_index;
+} tlv_search_frame_t;
+
+/* Container TLV object being measured or written, its next child TLV object and the encoded length of its child TLV objects. */
+typedef struct tlv_encode_frame
+{
+    tlv_object_t        * p_container_tlv_object;
+    tlv_object_t        * p_child_tlv_object;
+    uint32_t              remaining_child_count;
+    uint32_t              contents_length;
+} tlv_encode_frame_t;
+
+/* Search the first TLV object matching the tag in the TLV data buffer and update it (child TLV objects are not searched). */
+static uint32_t search_tlv_object(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tag, bool_t b_recursive,
+    tlv_object_t * p_tlv_object, uint32_t * p_buffer_index);
+
+/* Push the searched container TLV object to the search stack, its child TLV objects are searched next. */
+static uint32_t push_tlv_search_frame(tlv_search_frame_t * p_search_stack, uint32_t * p_depth, tlv_object_t * p_container_tlv_object,
+    uint32_t buffer_index);
+
+/* Find the first child TLV object with the tag in the container TLV object (depth first, without recursive calls). */
+static uint32_t find_child_tlv_object(tlv_object_t * p_container_tlv_object, uint32_t tlv_tag, tlv_object_t ** pp_child_tlv_object);
+
+/* Write the value to the TLV object with value. */
+static uint32_t write_tlv_object_value(tlv_object_t * p_tlv_object, const uint8_t * p_tlv_value, uint32_t value_length);
+
+/*
+ * Measure the encoded length of the TLV object and its child TLV objects, the length octets of definite length containers are encoded
+ * (without recursive calls, up to TLV_PARSER_MAX_CONTAINER_DEPTH containers).
+ */
+static uint32_t measure_tlv_object(tlv_object_t * p_tlv_object, uint32_t * p_encoded_length);
+
+/* Encoded length of the measured container TLV object with the encoded length of its child TLV objects (contents length). */
+static uint32_t measure_tlv_container(tlv_object_t * p_container_tlv_object, uint32_t contents_length);
+
+/* Write the measured TLV object and its child TLV objects into the TLV data buffer, returns the number of written octets. */
+static uint32_t write_tlv_object(tlv_object_t * p_tlv_object, uint8_t * p_tlv_data_buffer);
+
 /*
  * Function to create TLV object
  * - if buffer_length == 0; indefinite buffer length
@@ -26,19 +72,29 @@
  * Note: Universal class tags that can be encoded as "both" (primitive and constructed) are encoded as primitive.
  */
 uint32_t create_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_value, uint32_t value_length)
+{
+    /* TLV encoded buffer is allocated from heap. */
+    return create_tlv_object_in_arena(NULL, p_tlv_object, tlv_tag, p_tlv_value, value_length);
+}
+
+/* Function to create TLV object, the TLV encoded buffer is allocated from the TLV arena. */
+uint32_t create_tlv_object_in_arena(tlv_arena_t * p_tlv_arena, tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_value, uint32_t value_length)
 {
     TLV_STATUS status = TLV_FAIL;
 
-    /* Check if it is a universal tag number */
-    if (tlv_tag <= TAG_MAX_UNIVERSAL)
+    /* Save the TLV arena to allocate the TLV encoded buffer from. */
+    p_tlv_object->p_tlv_arena = p_tlv_arena;
+
+    /* Create the TLV object with the TLV codec of the tag number. */
+    const tlv_codec_t * p_tlv_codec = get_tlv_codec(tlv_tag);
+    if (p_tlv_codec)
     {
-        /* Create universal class TLV object. */
-        status = create_universal_tlv_object(p_tlv_object, tlv_tag, p_tlv_value, value_length);
+        status = p_tlv_codec->p_create(p_tlv_object, tlv_tag, p_tlv_value, value_length);
     }
     else
     {
-        /* It is a application tag, create application class TLV object. */
-        status = create_application_tlv_object(p_tlv_object, tlv_tag, p_tlv_value, value_length);
+        /* No TLV codec for the tag number. */
+        status = TLV_TAG_NOT_SUPPORTED;
     }
 
     return status;
@@ -98,64 +154,20 @@ uint32_t add_data_to_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, c
     /* Check the TLV object tag. */
     if (p_tlv_object->tlv_object_tag_number == tlv_tag)
     {
-        /* If tag match, Check TLV object is a container and data value length is less than or equal to max value
-        length of the TLV object */
-        if ((FALSE == p_tlv_object->b_tlv_container_object) && (p_tlv_object->tlv_max_object_value_length >= value_length))
-        {
-            /* Check if it is a universal tag number */
-            if (tlv_tag <= TAG_MAX_UNIVERSAL)
-            {
-                switch (tlv_tag)
-                {
-                    case TAG_INTEGER:
-                    {
-                        add_data_integer_tlv_object(p_tlv_object, p_tlv_value, value_length);
-                        status = TLV_SUCCESS;
-                    }
-                    break;
-                    case TAG_UTF8STRING:
-                    {
-                        add_data_universal_tlv_object(p_tlv_object, p_tlv_value, value_length);
-                        status = TLV_SUCCESS;
-                    }
-                    break;
-                    default:
-                    {
-                        /* do nothing */
-                    }
-                }
-            }
-            else
-            {
-                /* Application tag: application class or context specific class. */
-                add_data_to_definite_length_application_tlv_object(p_tlv_object, p_tlv_value, value_length);
-                status = TLV_SUCCESS;
-            }
-        }
-        else
-        {
-            /* Cannot write value to a container TLV object, value can be written to a child TLV object in the
-            container TLV object tag. */
-            status = TLV_CANNOT_WRITE_VALUE;
-        }
+        status = write_tlv_object_value(p_tlv_object, p_tlv_value, value_length);
     }
     else
     {
         /* Check if the TLV object is a container. */
         if ((TRUE == p_tlv_object->b_tlv_container_object) && (p_tlv_object->tlv_child_Count))
         {
-            /* Get the child TLV objects of the container TLV object. */
-            tlv_object_t * p_temp_tlv_Object = p_tlv_object->p_tlv_child_tlv_object_list;
-            do
+            /* Find the child TLV object with the tag (containers within the container are searched too) and write the value. */
+            tlv_object_t * p_child_tlv_object = NULL;
+            status = find_child_tlv_object(p_tlv_object, tlv_tag, &p_child_tlv_object);
+            if (TLV_SUCCESS == status)
             {
-                /* Check if the tag matches with each of the child TLV object. */
-                if (p_temp_tlv_Object->tlv_object_tag_number == tlv_tag)
-                {
-                    /* This is a recursive call, so take caution when modifying the function. */
-                    status = add_data_to_tlv_object(p_tlv_object, tlv_tag, p_tlv_value, value_length);
-                    break;
-                }
-            } while (p_temp_tlv_Object->p_child_tlv_object_next != p_tlv_object->p_tlv_child_tlv_object_list);
+                status = write_tlv_object_value(p_child_tlv_object, p_tlv_value, value_length);
+            }
         }
         else
         {
@@ -169,6 +181,63 @@ uint32_t add_data_to_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, c
     return status;
 }
 
+/*
+ * Function to create container TLV object of definite or indefinite length.
+ * Note: The length octets of a definite length container TLV object are encoded when the TLV object is measured or encoded.
+ */
+uint32_t create_tlv_container(tlv_object_t * p_tlv_object, uint32_t tlv_tag, bool_t b_length_definite)
+{
+    /* TLV encoded buffer is allocated from heap. */
+    return create_tlv_container_in_arena(NULL, p_tlv_object, tlv_tag, b_length_definite);
+}
+
+/* Function to create container TLV object of definite or indefinite length, the TLV encoded buffer is allocated from the TLV arena. */
+uint32_t create_tlv_container_in_arena(tlv_arena_t * p_tlv_arena, tlv_object_t * p_tlv_object, uint32_t tlv_tag, bool_t b_length_definite)
+{
+    /* Save the TLV arena to allocate the TLV encoded buffer from. */
+    p_tlv_object->p_tlv_arena = p_tlv_arena;
+
+    /* Only application class and context specific class tags are encoded as container TLV objects. */
+    return create_application_tlv_container(p_tlv_object, tlv_tag, b_length_definite);
+}
+
+/*
+ * Function to get the encoded length of the TLV object (includes the child TLV objects of a container TLV object).
+ * The contents of each definite length container TLV object are measured and its length octets are encoded.
+ */
+uint32_t get_tlv_object_encoded_length(tlv_object_t * p_tlv_object, uint32_t * p_encoded_length)
+{
+    /* Measure the TLV object. */
+    return measure_tlv_object(p_tlv_object, p_encoded_length);
+}
+
+/* Function to encode the TLV object (and the child TLV objects of a container TLV object) into the TLV data buffer. */
+uint32_t encode_tlv_object(tlv_object_t * p_tlv_object, uint8_t * p_tlv_data_buffer, uint32_t buffer_size, uint32_t * p_encoded_length)
+{
+    TLV_STATUS status = TLV_FAIL;
+    uint32_t encoded_length = 0U;
+
+    /* Measure the TLV object first, the length of each definite length container TLV object is known before it is written. */
+    status = measure_tlv_object(p_tlv_object, &encoded_length);
+
+    if (TLV_SUCCESS == status)
+    {
+        if (encoded_length <= buffer_size)
+        {
+            (void_t)write_tlv_object(p_tlv_object, p_tlv_data_buffer);
+            *p_encoded_length = encoded_length;
+        }
+        else
+        {
+            /* TLV data buffer is too small for the encoded TLV object. */
+            status = TLV_BAD_BUFFER_LENGTH;
+        }
+    }
+
+    /* Return status. */
+    return status;
+}
+
 /*
  * - Function to parse TLV data buffer (first found TLV object is parsed.)
  * - The parse_tlv_object() find the first valid tag and decodes the TLV encoded data, else returns error tag not found or bad TLV data buffer
@@ -179,10 +248,22 @@ uint32_t add_data_to_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, c
  * length with all its child TLV objects by calling tlv_search_tag() api.
  */
 uint32_t parse_tlv_object(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_t * p_tlv_object)
+{
+    /* TLV encoded buffer is allocated from heap. */
+    return parse_tlv_object_in_arena(NULL, p_tlv_data_buffer, buffer_length, p_tlv_object);
+}
+
+/* Function to parse TLV data buffer, the TLV encoded buffer is allocated from the TLV arena. */
+uint32_t parse_tlv_object_in_arena(tlv_arena_t * p_tlv_arena, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_t * p_tlv_object)
 {
     TLV_STATUS status = TLV_NO_TAG_FOUND;
 
-    for (uint32_t i = 0; i < buffer_length; i++)
+    /* Save the TLV arena to allocate the TLV encoded buffer from. */
+    p_tlv_object->p_tlv_arena = p_tlv_arena;
+
+    /* Only the octets that can be the first tag octet are parsed. */
+    for (uint32_t i = find_tlv_tag_octet(p_tlv_data_buffer, buffer_length, 0U); i < buffer_length;
+        i = find_tlv_tag_octet(p_tlv_data_buffer, buffer_length, (i + 1U)))
     {
         status = get_parsed_tlv_object(&p_tlv_data_buffer[i], (buffer_length - i), p_tlv_object);
 
@@ -202,8 +283,221 @@ uint32_t parse_tlv_object(const uint8_t * p_tlv_data_buffer, uint32_t buffer_len
     return status;
 }
 
-/* Function to search TLV encoded data object in the TLV data buffer. */
+/* Function to free the TLV encoded buffer of the TLV object allocated from heap with the TLV allocator. */
+uint32_t free_tlv_object_buffer(tlv_object_t * p_tlv_object)
+{
+    /* TLV encoded buffer allocated from the TLV arena is released on the TLV arena reset. */
+    free_tlv_memory(p_tlv_object->p_tlv_arena, p_tlv_object->p_tlv_object_encoded_buffer);
+
+    p_tlv_object->p_tlv_object_encoded_buffer = NULL;
+    p_tlv_object->p_tlv_value_buffer = NULL;
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/*
+ * Function to search TLV encoded data object in the TLV data buffer.
+ * If the searched TLV object is a container, its child TLV objects are searched in order after it (the status is of the last
+ * searched TLV object). The containers are not searched with recursive calls, the search stack has the containers being searched.
+ */
 uint32_t tlv_search_tag(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tag, bool_t b_recursive, tlv_object_t * p_tlv_object)
+{
+    TLV_STATUS status = TLV_NO_TAG_FOUND;
+    tlv_search_frame_t search_stack[TLV_PARSER_MAX_CONTAINER_DEPTH];
+    uint32_t depth = 0U;
+    uint32_t buffer_index = 0U;
+
+    status = search_tlv_object(p_tlv_data_buffer, buffer_length, tag, b_recursive, p_tlv_object, &buffer_index);
+    if ((buffer_index < buffer_length) && (TRUE == p_tlv_object->b_tlv_container_object))
+    {
+        /* Searched TLV object is a container, so decode and update all the child TLV objects. */
+        if (TLV_SUCCESS != push_tlv_search_frame(search_stack, &depth, p_tlv_object, buffer_index))
+        {
+            status = TLV_MAX_CONTAINER_DEPTH;
+        }
+    }
+
+    while (depth)
+    {
+        tlv_search_frame_t * p_search_frame = &search_stack[depth - 1U];
+
+        if (p_search_frame->buffer_index > buffer_length)
+        {
+            /* Searched TLV object is not within the TLV data buffer. */
+            p_search_frame->buffer_index = buffer_length;
+        }
+
+        if (p_search_frame->child_index == p_search_frame->p_container_tlv_object->tlv_child_Count)
+        {
+            /* All the child TLV objects are searched, the search of the parent continues after the end of contents octets. */
+            uint32_t container_end_index = skip_indefinite_length_tlv_object(p_tlv_data_buffer, buffer_length, p_search_frame->buffer_index);
+
+            depth--;
+            if (depth)
+            {
+                p_search_frame = &search_stack[depth - 1U];
+                p_search_frame->buffer_index = container_end_index;
+                p_search_frame->p_child_tlv_object = p_search_frame->p_child_tlv_object->p_child_tlv_object_next;
+                p_search_frame->child_index++;
+            }
+            continue;
+        }
+
+        /* Search the next child TLV object of the container. */
+        tlv_object_t * p_child_tlv_object = p_search_frame->p_child_tlv_object;
+        status = search_tlv_object(&p_tlv_data_buffer[p_search_frame->buffer_index], (buffer_length - p_search_frame->buffer_index),
+            p_child_tlv_object->tlv_object_tag_number, b_recursive, p_child_tlv_object, &buffer_index);
+
+        if (buffer_index < (buffer_length - p_search_frame->buffer_index))
+        {
+            buffer_index += p_search_frame->buffer_index;
+
+            if (TRUE == p_child_tlv_object->b_tlv_container_object)
+            {
+                /* Child TLV object is a container, search its child TLV objects first. */
+                if (TLV_SUCCESS != push_tlv_search_frame(search_stack, &depth, p_child_tlv_object, buffer_index))
+                {
+                    status = TLV_MAX_CONTAINER_DEPTH;
+                    break;
+                }
+                continue;
+            }
+
+            /* Move to the next child in the TLV data buffer. */
+            p_search_frame->buffer_index = buffer_index + p_child_tlv_object->tlv_curr_encoded_object_length;
+        }
+
+        p_search_frame->p_child_tlv_object = p_child_tlv_object->p_child_tlv_object_next;
+        p_search_frame->child_index++;
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*
+ * - Function to parse TLV data buffer into a TLV object view (first found TLV object is parsed.)
+ * - Same as parse_tlv_object(), but the TLV object view points into the TLV data buffer (no memory allocation and no copy).
+ */
+uint32_t parse_tlv_object_view(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_view_t * p_tlv_object_view)
+{
+    TLV_STATUS status = TLV_NO_TAG_FOUND;
+    tlv_object_t work_tlv_object;
+
+    /* Only the octets that can be the first tag octet are parsed. */
+    for (uint32_t i = find_tlv_tag_octet(p_tlv_data_buffer, buffer_length, 0U); i < buffer_length;
+        i = find_tlv_tag_octet(p_tlv_data_buffer, buffer_length, (i + 1U)))
+    {
+        status = get_parsed_tlv_object(&p_tlv_data_buffer[i], (buffer_length - i), &work_tlv_object);
+
+        if (TLV_SUCCESS == status)
+        {
+            /* First TLV object parsed successfully, update the TLV object view. */
+            status = update_parsed_tlv_object_view(&p_tlv_data_buffer[i], (buffer_length - i), &work_tlv_object, p_tlv_object_view);
+            /* If successfully updated, exit the search for tags. */
+            if (TLV_SUCCESS == status)
+            {
+                break;
+            }
+        }
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to search TLV encoded data object in the TLV data buffer and parse it into a TLV object view. */
+uint32_t tlv_search_tag_view(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tag, bool_t b_recursive, tlv_object_view_t * p_tlv_object_view)
+{
+    TLV_STATUS status = TLV_NO_TAG_FOUND;
+    tlv_object_t work_tlv_object;
+    uint32_t buffer_index = 0;
+
+    /* Loop through the buffer to search the tag. */
+    while (buffer_index < buffer_length)
+    {
+        status = get_parsed_tlv_object(&p_tlv_data_buffer[buffer_index], (buffer_length - buffer_index), &work_tlv_object);
+
+        if (TLV_SUCCESS == status)
+        {
+            if (work_tlv_object.tlv_object_tag_number == tag)
+            {
+                /* Match found, update the TLV object view. */
+                status = update_parsed_tlv_object_view(&p_tlv_data_buffer[buffer_index], (buffer_length - buffer_index), &work_tlv_object, p_tlv_object_view);
+                if (TLV_SUCCESS == status)
+                {
+                    break;
+                }
+                buffer_index++;
+            }
+            else if ((TRUE == work_tlv_object.b_tlv_container_object) && (FALSE == b_recursive))
+            {
+                /* Not matching, skip the container TLV object with all its child TLV objects. */
+                buffer_index = skip_indefinite_length_tlv_object(p_tlv_data_buffer, buffer_length,
+                    (buffer_index + work_tlv_object.tlv_curr_encoded_object_length));
+            }
+            else
+            {
+                /* Not matching, jump to next TLV encoded object (the first child TLV object for a container). */
+                buffer_index += work_tlv_object.tlv_curr_encoded_object_length;
+            }
+
+            /* Tag is not found yet. */
+            status = TLV_NO_TAG_FOUND;
+        }
+        else
+        {
+            /* Point to next octet in the TLV data buffer that can be the first tag octet. */
+            buffer_index = find_tlv_tag_octet(p_tlv_data_buffer, buffer_length, (buffer_index + 1U));
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/* Get index of the TLV data buffer after the end of contents octets of the indefinite length container TLV object. */
+uint32_t skip_indefinite_length_tlv_object(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t buffer_index)
+{
+    tlv_object_t work_tlv_object;
+    uint32_t depth = 1U;
+
+    /* Skip the child TLV objects, containers within the container are skipped with their own end of contents octets. */
+    while ((depth) && (buffer_index < buffer_length))
+    {
+        if ((p_tlv_data_buffer[buffer_index] == (uint8_t)TAG_END_OF_CONTENT) && ((buffer_index + 1U) < buffer_length) &&
+            (p_tlv_data_buffer[buffer_index + 1U] == (uint8_t)TAG_END_OF_CONTENT))
+        {
+            /* End of contents of the container. */
+            buffer_index += 2U;
+            depth--;
+        }
+        else if (TLV_SUCCESS == get_parsed_tlv_object(&p_tlv_data_buffer[buffer_index], (buffer_length - buffer_index), &work_tlv_object))
+        {
+            buffer_index += work_tlv_object.tlv_curr_encoded_object_length;
+            if (TRUE == work_tlv_object.b_tlv_container_object)
+            {
+                depth++;
+            }
+        }
+        else
+        {
+            /* Point to next octet in the TLV data buffer (end of contents octets are not skipped). */
+            buffer_index++;
+        }
+    }
+
+    /* Return index after the container TLV object. */
+    return buffer_index;
+}
+
+/*
+ * Search the first TLV object matching the tag in the TLV data buffer and update it (child TLV objects are not searched).
+ * The index of the searched TLV object is returned (buffer length if not found).
+ */
+static uint32_t search_tlv_object(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tag, bool_t b_recursive,
+    tlv_object_t * p_tlv_object, uint32_t * p_buffer_index)
 {
     TLV_STATUS status = TLV_NO_TAG_FOUND;
     tlv_object_t work_tlv_object;
@@ -228,97 +522,299 @@ uint32_t tlv_search_tag(const uint8_t * p_tlv_data_buffer, uint32_t buffer_lengt
             {
                 p_tlv_object->tlv_curr_encoded_object_length = work_tlv_object.tlv_curr_encoded_object_length;
                 p_tlv_object->tlv_curr_object_value_length = work_tlv_object.tlv_curr_object_value_length;
+
+                /* Update the searched TLV object. */
+                status = update_searched_tlv_object(&p_tlv_data_buffer[buffer_index], (buffer_length - buffer_index), p_tlv_object);
+                break;
+            }
+
+            /*
+             * Not matching, so jump to next TLV encoded object in the TLV encoded buffer. Only indefinite length containers are
+             * parsed as container TLV objects (a definite length container is one TLV object with value).
+             */
+            if ((TRUE == work_tlv_object.b_tlv_container_object) && (FALSE == b_recursive))
+            {
+                buffer_index += work_tlv_object.tlv_curr_encoded_object_length;
+                buffer_index = find_end_of_contents_octets(p_tlv_data_buffer, buffer_length, buffer_index);
             }
             else
             {
-                /* Not matching, so jump to next TLV encoded object in the TLV encoded buffer. */
-                if (TRUE == work_tlv_object.b_tlv_container_object)
-                {
-                    if (b_recursive)
-                    {
-                        buffer_index += work_tlv_object.tlv_curr_encoded_object_length;
-                    }
-                    else
-                    {
-                        if (TRUE == work_tlv_object.b_tlv_object_length_definite)
-                        {
-                            buffer_index += (work_tlv_object.tlv_curr_encoded_object_length + work_tlv_object.tlv_curr_object_value_length);
-                        }
-                        else
-                        {
-                            buffer_index += work_tlv_object.tlv_curr_encoded_object_length;
-                            while (p_tlv_data_buffer[buffer_index] != (uint8_t)TAG_END_OF_CONTENT)
-                            {
-                                if (buffer_index < buffer_length)
-                                {
-                                    buffer_index++;
-                                }
-                                else
-                                {
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                }
-                else
-                {
-                    buffer_index += work_tlv_object.tlv_curr_encoded_object_length;
-                }
+                /* The first child TLV object for a container. */
+                buffer_index += work_tlv_object.tlv_curr_encoded_object_length;
+            }
+
+            /* Tag is not found yet. */
+            status = TLV_NO_TAG_FOUND;
+        }
+        else
+        {
+            /* Point to next octet in the TLV data buffer that can be the first tag octet. */
+            buffer_index = find_tlv_tag_octet(p_tlv_data_buffer, buffer_length, (buffer_index + 1U));
+        }
+    }
+
+    *p_buffer_index = (buffer_index < buffer_length) ? buffer_index : buffer_length;
+
+    /* Return status */
+    return status;
+}
+
+/*
+ * Push the searched container TLV object to the search stack, its child TLV objects are searched next (after the tag and length
+ * octets of the container). Returns TLV_MAX_CONTAINER_DEPTH if the search stack is full.
+ */
+static uint32_t push_tlv_search_frame(tlv_search_frame_t * p_search_stack, uint32_t * p_depth, tlv_object_t * p_container_tlv_object,
+    uint32_t buffer_index)
+{
+    if (TLV_PARSER_MAX_CONTAINER_DEPTH <= *p_depth)
+    {
+        return TLV_MAX_CONTAINER_DEPTH;
+    }
+
+    tlv_search_frame_t * p_search_frame = &p_search_stack[*p_depth];
+    p_search_frame->p_container_tlv_object = p_container_tlv_object;
+    p_search_frame->p_child_tlv_object = p_container_tlv_object->p_tlv_child_tlv_object_list;
+    p_search_frame->child_index = 0U;
+    p_search_frame->buffer_index = buffer_index + p_container_tlv_object->tlv_curr_encoded_object_length;
+    (*p_depth)++;
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
 
-                /* Tag is not found yet. */
-                status = TLV_NO_TAG_FOUND;
+/*
+ * Find the first child TLV object with the tag in the container TLV object, containers within the container are searched depth first.
+ * The containers are not searched with recursive calls, the next child TLV object of each container being searched is kept on a stack.
+ */
+static uint32_t find_child_tlv_object(tlv_object_t * p_container_tlv_object, uint32_t tlv_tag, tlv_object_t ** pp_child_tlv_object)
+{
+    TLV_STATUS status = TLV_CANNOT_WRITE_VALUE;
+    tlv_object_t * p_next_child_tlv_object[TLV_PARSER_MAX_CONTAINER_DEPTH];
+    uint32_t remaining_child_count[TLV_PARSER_MAX_CONTAINER_DEPTH];
+    uint32_t depth = 1U;
+
+    p_next_child_tlv_object[0] = p_container_tlv_object->p_tlv_child_tlv_object_list;
+    remaining_child_count[0] = p_container_tlv_object->tlv_child_Count;
+
+    while (depth)
+    {
+        if (!remaining_child_count[depth - 1U])
+        {
+            /* All the child TLV objects of the container are searched. */
+            depth--;
+            continue;
+        }
+
+        tlv_object_t * p_child_tlv_object = p_next_child_tlv_object[depth - 1U];
+        p_next_child_tlv_object[depth - 1U] = p_child_tlv_object->p_child_tlv_object_next;
+        remaining_child_count[depth - 1U]--;
+
+        /* Check if the tag matches with the child TLV object. */
+        if (p_child_tlv_object->tlv_object_tag_number == tlv_tag)
+        {
+            *pp_child_tlv_object = p_child_tlv_object;
+            status = TLV_SUCCESS;
+            break;
+        }
+
+        if ((TRUE == p_child_tlv_object->b_tlv_container_object) && (p_child_tlv_object->tlv_child_Count))
+        {
+            if (TLV_PARSER_MAX_CONTAINER_DEPTH <= depth)
+            {
+                status = TLV_MAX_CONTAINER_DEPTH;
+                break;
             }
+
+            /* Search the child TLV objects of the container first. */
+            p_next_child_tlv_object[depth] = p_child_tlv_object->p_tlv_child_tlv_object_list;
+            remaining_child_count[depth] = p_child_tlv_object->tlv_child_Count;
+            depth++;
+        }
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Write the value to the TLV object with value, the value length should be within the max value length of the TLV object. */
+static uint32_t write_tlv_object_value(tlv_object_t * p_tlv_object, const uint8_t * p_tlv_value, uint32_t value_length)
+{
+    TLV_STATUS status = TLV_FAIL;
+
+    /* Check TLV object is a container and data value length is less than or equal to max value length of the TLV object */
+    if ((FALSE == p_tlv_object->b_tlv_container_object) && (p_tlv_object->tlv_max_object_value_length >= value_length))
+    {
+        /* Encode the value with the TLV codec of the tag number. */
+        const tlv_codec_t * p_tlv_codec = get_tlv_codec(p_tlv_object->tlv_object_tag_number);
+        if (p_tlv_codec)
+        {
+            p_tlv_codec->p_add_data(p_tlv_object, p_tlv_value, value_length);
+            status = TLV_SUCCESS;
+        }
+    }
+    else
+    {
+        /* Cannot write value to a container TLV object, value can be written to a child TLV object in the
+        container TLV object tag. */
+        status = TLV_CANNOT_WRITE_VALUE;
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/*
+ * Measure the encoded length of the TLV object and its child TLV objects, the length octets of definite length containers are encoded.
+ * The containers are not measured with recursive calls, the containers being measured and their next child TLV object are kept on a stack.
+ */
+static uint32_t measure_tlv_object(tlv_object_t * p_tlv_object, uint32_t * p_encoded_length)
+{
+    TLV_STATUS status = TLV_SUCCESS;
+    tlv_encode_frame_t encode_stack[TLV_PARSER_MAX_CONTAINER_DEPTH];
+    uint32_t depth = 0U;
+    uint32_t encoded_length = 0U;
+
+    while (TLV_SUCCESS == status)
+    {
+        if (FALSE == p_tlv_object->b_tlv_container_object)
+        {
+            /* Encoded length of the TLV object with value is known. */
+            encoded_length = p_tlv_object->tlv_curr_encoded_object_length;
+        }
+        else if (TLV_PARSER_MAX_CONTAINER_DEPTH <= depth)
+        {
+            /* Containers are nested too deep. */
+            status = TLV_MAX_CONTAINER_DEPTH;
+            break;
         }
         else
         {
-            /* Point to next octet in the TLV data buffer. */
-            buffer_index++;
+            /* Measure the child TLV objects of the container first. */
+            encode_stack[depth].p_container_tlv_object = p_tlv_object;
+            encode_stack[depth].p_child_tlv_object = p_tlv_object->p_tlv_child_tlv_object_list;
+            encode_stack[depth].remaining_child_count = p_tlv_object->tlv_child_Count;
+            encode_stack[depth].contents_length = 0U;
+            depth++;
+            encoded_length = 0U;
         }
 
-        if (TLV_SUCCESS == status)
+        /* Add the measured TLV object to the contents of its container, the containers with all child TLV objects measured are closed. */
+        while (depth)
         {
-            /* Update the searched TLV object. */
-            status = update_searched_tlv_object(&p_tlv_data_buffer[buffer_index], (buffer_length - buffer_index), p_tlv_object);
+            tlv_encode_frame_t * p_encode_frame = &encode_stack[depth - 1U];
 
-            if (TRUE == p_tlv_object->b_tlv_container_object)
+            p_encode_frame->contents_length += encoded_length;
+            if (p_encode_frame->contents_length > APP_TAG_MAX_VALUE_LENGTH)
             {
-                /* Searched TLV object is a container, so decode and update all the child TLV objects. */
-                buffer_index += p_tlv_object->tlv_curr_encoded_object_length;
+                /* Contents are too long for the length octets. */
+                status = TLV_BAD_DATA_SIZE;
+                break;
+            }
 
-                tlv_object_t * p_search_tlv_child_object = p_tlv_object->p_tlv_child_tlv_object_list;
-                for (uint32_t y = 0; y < p_tlv_object->tlv_child_Count; y++)
-                {
-                    /* This is a recursive call, please take care of depth and when modifying. */
-                    status = tlv_search_tag(&p_tlv_data_buffer[buffer_index], (buffer_length - buffer_index), p_search_tlv_child_object->tlv_object_tag_number, b_recursive, p_search_tlv_child_object);
-
-                    /* Move to the next child in the TLV data buffer. */
-                    if (p_search_tlv_child_object->b_tlv_container_object)
-                    {
-                        tlv_object_t * p_temp_tlv_child_of_child_object = p_search_tlv_child_object->p_tlv_child_tlv_object_list;
-                        uint32_t temp_buffer_index = p_search_tlv_child_object->tlv_curr_encoded_object_length;
-
-                        for (uint32_t k = 0; k < p_search_tlv_child_object->tlv_child_Count; k++)
-                        {
-                            temp_buffer_index += p_temp_tlv_child_of_child_object->tlv_curr_encoded_object_length;
-                            p_temp_tlv_child_of_child_object = p_temp_tlv_child_of_child_object->p_child_tlv_object_next;
-                        }
-
-                        buffer_index += temp_buffer_index;
-                    }
-                    else
-                    {
-                        buffer_index += p_search_tlv_child_object->tlv_curr_encoded_object_length;
-                    }
-                    p_search_tlv_child_object = p_search_tlv_child_object->p_child_tlv_object_next;
-                }
+            if (p_encode_frame->remaining_child_count)
+            {
+                break;
             }
-            /* Tag searched and TLV object updated. */
+
+            encoded_length = measure_tlv_container(p_encode_frame->p_container_tlv_object, p_encode_frame->contents_length);
+            depth--;
+        }
+
+        if ((TLV_SUCCESS != status) || (!depth))
+        {
+            /* Error, or the TLV object and all its child TLV objects are measured. */
             break;
         }
+
+        /* Measure the next child TLV object of the container. */
+        p_tlv_object = encode_stack[depth - 1U].p_child_tlv_object;
+        encode_stack[depth - 1U].p_child_tlv_object = p_tlv_object->p_child_tlv_object_next;
+        encode_stack[depth - 1U].remaining_child_count--;
     }
 
-    /* Return status */
+    if (TLV_SUCCESS == status)
+    {
+        *p_encoded_length = encoded_length;
+    }
+
+    /* Return status. */
     return status;
 }
 
+/* Encoded length of the measured container TLV object with the encoded length of its child TLV objects (contents length). */
+static uint32_t measure_tlv_container(tlv_object_t * p_container_tlv_object, uint32_t contents_length)
+{
+    uint32_t encoded_length = 0U;
+
+    if (TRUE == p_container_tlv_object->b_tlv_object_length_definite)
+    {
+        /* Encode the exact length of the contents, the container TLV object can be skipped by its length. */
+        p_container_tlv_object->tlv_curr_encoded_object_length = p_container_tlv_object->tlv_tag_length +
+            encode_length_octets(&p_container_tlv_object->p_tlv_object_encoded_buffer[p_container_tlv_object->tlv_tag_length], contents_length);
+        p_container_tlv_object->tlv_curr_object_value_length = contents_length;
+
+        encoded_length = p_container_tlv_object->tlv_curr_encoded_object_length + contents_length;
+    }
+    else
+    {
+        /* Contents are followed by the end of contents octets. */
+        encoded_length = p_container_tlv_object->tlv_curr_encoded_object_length + contents_length + VALUE_LENGTH_2OCTET;
+    }
+
+    /* Return encoded length. */
+    return encoded_length;
+}
+
+/*
+ * Write the measured TLV object and its child TLV objects into the TLV data buffer, returns the number of written octets.
+ * The containers are written without recursive calls, the container depth is checked by measure_tlv_object().
+ */
+static uint32_t write_tlv_object(tlv_object_t * p_tlv_object, uint8_t * p_tlv_data_buffer)
+{
+    tlv_encode_frame_t encode_stack[TLV_PARSER_MAX_CONTAINER_DEPTH];
+    uint32_t depth = 0U;
+    uint32_t encoded_length = 0U;
+
+    while (TRUE)
+    {
+        /* Write the tag and length octets (and the value octets of a TLV object with value). */
+        memcpy(&p_tlv_data_buffer[encoded_length], p_tlv_object->p_tlv_object_encoded_buffer, p_tlv_object->tlv_curr_encoded_object_length);
+        encoded_length += p_tlv_object->tlv_curr_encoded_object_length;
+
+        if ((TRUE == p_tlv_object->b_tlv_container_object) && (TLV_PARSER_MAX_CONTAINER_DEPTH > depth))
+        {
+            /* Write the child TLV objects of the container next. */
+            encode_stack[depth].p_container_tlv_object = p_tlv_object;
+            encode_stack[depth].p_child_tlv_object = p_tlv_object->p_tlv_child_tlv_object_list;
+            encode_stack[depth].remaining_child_count = p_tlv_object->tlv_child_Count;
+            depth++;
+        }
+
+        /* Close the containers with all child TLV objects written. */
+        while ((depth) && (!encode_stack[depth - 1U].remaining_child_count))
+        {
+            if (FALSE == encode_stack[depth - 1U].p_container_tlv_object->b_tlv_object_length_definite)
+            {
+                /* Write the end of contents octets. */
+                p_tlv_data_buffer[encoded_length] = (uint8_t)TAG_END_OF_CONTENT;
+                p_tlv_data_buffer[encoded_length + 1U] = (uint8_t)TAG_END_OF_CONTENT;
+                encoded_length += VALUE_LENGTH_2OCTET;
+            }
+            depth--;
+        }
+
+        if (!depth)
+        {
+            /* The TLV object and all its child TLV objects are written. */
+            break;
+        }
+
+        /* Write the next child TLV object of the container. */
+        p_tlv_object = encode_stack[depth - 1U].p_child_tlv_object;
+        encode_stack[depth - 1U].p_child_tlv_object = p_tlv_object->p_child_tlv_object_next;
+        encode_stack[depth - 1U].remaining_child_count--;
+    }
+
+    /* Return number of written octets. */
+    return encoded_length;
+}
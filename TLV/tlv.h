@@ -49,6 +49,129 @@ uint32_t parse_tlv_object(const uint8_t * p_tlv_data_buffer, uint32_t buffer_len
 /* Function to search TLV encoded data object in the TLV data buffer. */
 uint32_t tlv_search_tag(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tag, bool_t b_recursive, tlv_object_t * p_tlv_object);
 
+/*
+ * - Function to parse TLV data buffer into a TLV object view (first found TLV object is parsed.)
+ * - Same as parse_tlv_object(), but the TLV object view points into the TLV data buffer (no memory allocation and no copy).
+ */
+uint32_t parse_tlv_object_view(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_view_t * p_tlv_object_view);
+
+/* Function to search TLV encoded data object in the TLV data buffer and parse it into a TLV object view. */
+uint32_t tlv_search_tag_view(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tag, bool_t b_recursive, tlv_object_view_t * p_tlv_object_view);
+
+/* Function to initialize the TLV stream parser. */
+uint32_t tlv_stream_parser_init(tlv_stream_parser_t * p_tlv_stream_parser, uint8_t * p_tlv_object_buffer, uint32_t tlv_object_buffer_size,
+    tlv_stream_callback_t p_callback, void_t * p_callback_data);
+
+/* Function to feed TLV data (a chunk of any length) to the TLV stream parser. */
+uint32_t tlv_stream_parser_feed(tlv_stream_parser_t * p_tlv_stream_parser, const uint8_t * p_tlv_data, uint32_t data_length);
+
+/* Function to reset the TLV stream parser, the partially parsed TLV object is discarded. */
+uint32_t tlv_stream_parser_reset(tlv_stream_parser_t * p_tlv_stream_parser);
+
+/* Function to set the value callback of the TLV stream parser (NULL to clear). */
+uint32_t tlv_stream_parser_set_value_callback(tlv_stream_parser_t * p_tlv_stream_parser, tlv_stream_value_callback_t p_value_callback);
+
+/* Function to initialize the TLV writer to encode TLV objects into the TLV data buffer. */
+uint32_t tlv_writer_init(tlv_writer_t * p_tlv_writer, uint8_t * p_tlv_data_buffer, uint32_t buffer_size);
+
+/* Function to encode an integer TLV object. */
+uint32_t tlv_writer_add_integer(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_value, uint32_t value_length);
+
+/* Function to encode an array of integer TLV objects of the tag. */
+uint32_t tlv_writer_add_integer_array(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_values, uint32_t value_size,
+    uint32_t value_count);
+
+/* Function to decode the integer TLV objects of the tag in the TLV data buffer into an array of application variables. */
+uint32_t tlv_decode_integer_array(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tlv_tag, uint8_t * p_values,
+    uint32_t value_size, uint32_t max_value_count, uint32_t * p_value_count);
+
+/* Function to encode a TLV object with the value octets. */
+uint32_t tlv_writer_add_value(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_value, uint32_t value_length);
+
+/* Function to open a container TLV object. */
+uint32_t tlv_writer_open_container(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, bool_t b_length_definite);
+
+/* Function to close the last opened container TLV object. */
+uint32_t tlv_writer_close_container(tlv_writer_t * p_tlv_writer);
+
+/* Function to get the number of encoded octets in the TLV data buffer. */
+uint32_t tlv_writer_finish(tlv_writer_t * p_tlv_writer, uint32_t * p_encoded_length);
+
+/* Function to initialize the TLV arena on the application provided memory. */
+uint32_t tlv_arena_init(tlv_arena_t * p_tlv_arena, uint8_t * p_arena_buffer, uint32_t arena_size);
+
+/* Function to reset the TLV arena, all the memory allocated from the TLV arena is released at once. */
+uint32_t tlv_arena_reset(tlv_arena_t * p_tlv_arena);
+
+/* Function to create TLV object, the TLV encoded buffer is allocated from the TLV arena. */
+uint32_t create_tlv_object_in_arena(tlv_arena_t * p_tlv_arena, tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_value, uint32_t value_length);
+
+/* Function to parse TLV data buffer, the TLV encoded buffer is allocated from the TLV arena. */
+uint32_t parse_tlv_object_in_arena(tlv_arena_t * p_tlv_arena, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_t * p_tlv_object);
+
+/* Function to build the TLV index, the TLV data buffer is parsed once into the TLV index nodes. */
+uint32_t tlv_index_build(tlv_index_t * p_tlv_index, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length,
+    tlv_index_node_t * p_tlv_index_nodes, uint32_t max_node_count);
+
+/* Function to search the first TLV object with the tag in the TLV index. */
+uint32_t tlv_index_search_tag(const tlv_index_t * p_tlv_index, uint32_t tag, uint32_t * p_node_index);
+
+/* Function to find the child TLV object with the tag in the container node. */
+uint32_t tlv_index_find_child(const tlv_index_t * p_tlv_index, uint32_t container_node_index, uint32_t tag, uint32_t * p_node_index);
+
+/* Function to get the TLV object view of the TLV index node. */
+uint32_t tlv_index_get_view(const tlv_index_t * p_tlv_index, uint32_t node_index, tlv_object_view_t * p_tlv_object_view);
+
+/* Function to create the TLV batch pool with the worker threads. */
+uint32_t tlv_batch_pool_create(uint32_t worker_thread_count, tlv_batch_pool_t ** pp_tlv_batch_pool);
+
+/* Function to decode a batch of messages with the TLV batch pool. */
+uint32_t tlv_batch_decode(tlv_batch_pool_t * p_tlv_batch_pool, tlv_batch_message_t * p_tlv_batch_messages, uint32_t message_count,
+    tlv_batch_callback_t p_callback, void_t * p_callback_data);
+
+/* Function to destroy the TLV batch pool. */
+uint32_t tlv_batch_pool_destroy(tlv_batch_pool_t * p_tlv_batch_pool);
+
+/* Function to register the TLV codec of a tag number. */
+uint32_t tlv_codec_register(uint32_t tlv_tag, const tlv_codec_t * p_tlv_codec);
+
+/* Function to create container TLV object of definite or indefinite length. */
+uint32_t create_tlv_container(tlv_object_t * p_tlv_object, uint32_t tlv_tag, bool_t b_length_definite);
+
+/* Function to create container TLV object of definite or indefinite length, the TLV encoded buffer is allocated from the TLV arena. */
+uint32_t create_tlv_container_in_arena(tlv_arena_t * p_tlv_arena, tlv_object_t * p_tlv_object, uint32_t tlv_tag, bool_t b_length_definite);
+
+/* Function to get the encoded length of the TLV object (includes the child TLV objects). */
+uint32_t get_tlv_object_encoded_length(tlv_object_t * p_tlv_object, uint32_t * p_encoded_length);
+
+/* Function to encode the TLV object (and the child TLV objects) into the TLV data buffer. */
+uint32_t encode_tlv_object(tlv_object_t * p_tlv_object, uint8_t * p_tlv_data_buffer, uint32_t buffer_size, uint32_t * p_encoded_length);
+
+/* Function to initialize the TLV frame reader. */
+uint32_t tlv_frame_reader_init(tlv_frame_reader_t * p_tlv_frame_reader, uint32_t max_message_length);
+
+/* Function to check if a complete top level TLV message is received in the TLV data segments. */
+uint32_t tlv_frame_reader_check(tlv_frame_reader_t * p_tlv_frame_reader, const tlv_data_segment_t * p_tlv_data_segments, uint32_t segment_count,
+    uint32_t * p_message_length);
+
+/* Function to reset the TLV frame reader. */
+uint32_t tlv_frame_reader_reset(tlv_frame_reader_t * p_tlv_frame_reader);
+
+/* Function to free the TLV encoded buffer of the TLV object allocated from heap. */
+uint32_t free_tlv_object_buffer(tlv_object_t * p_tlv_object);
+
+/* Function to set the TLV allocator. */
+uint32_t tlv_set_allocator(const tlv_allocator_t * p_tlv_allocator);
+
+/* Function to get the TLV allocator. */
+const tlv_allocator_t * tlv_get_allocator(void_t);
+
+/* Function to initialize the TLV counting allocator. */
+uint32_t tlv_counting_allocator_init(tlv_counting_allocator_t * p_tlv_counting_allocator, const tlv_allocator_t * p_backing_allocator);
+
+/* Function to reset the counts of the TLV counting allocator. */
+uint32_t tlv_counting_allocator_reset(tlv_counting_allocator_t * p_tlv_counting_allocator);
+
 
 
 /* Error check for create TLV object function. */
@@ -66,4 +189,121 @@ uint32_t parse_tlv_object_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_
 /* Error check for search TLV encoded data object in the TLV data buffer function. */
 uint32_t tlv_search_tag_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tag, bool_t b_recursive, tlv_object_t * p_tlv_object);
 
+/* Error check for parse TLV data buffer into a TLV object view function. */
+uint32_t parse_tlv_object_view_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_view_t * p_tlv_object_view);
+
+/* Error check for search TLV encoded data object in the TLV data buffer into a TLV object view function. */
+uint32_t tlv_search_tag_view_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tag, bool_t b_recursive, tlv_object_view_t * p_tlv_object_view);
+
+/* Error check for initialize the TLV stream parser function. */
+uint32_t tlv_stream_parser_init_ec(tlv_stream_parser_t * p_tlv_stream_parser, uint8_t * p_tlv_object_buffer, uint32_t tlv_object_buffer_size,
+    tlv_stream_callback_t p_callback, void_t * p_callback_data);
+
+/* Error check for feed TLV data to the TLV stream parser function. */
+uint32_t tlv_stream_parser_feed_ec(tlv_stream_parser_t * p_tlv_stream_parser, const uint8_t * p_tlv_data, uint32_t data_length);
+
+/* Error check for reset the TLV stream parser function. */
+uint32_t tlv_stream_parser_reset_ec(tlv_stream_parser_t * p_tlv_stream_parser);
+
+/* Error check for set the value callback of the TLV stream parser function. */
+uint32_t tlv_stream_parser_set_value_callback_ec(tlv_stream_parser_t * p_tlv_stream_parser, tlv_stream_value_callback_t p_value_callback);
+
+/* Error check for initialize the TLV writer function. */
+uint32_t tlv_writer_init_ec(tlv_writer_t * p_tlv_writer, uint8_t * p_tlv_data_buffer, uint32_t buffer_size);
+
+/* Error check for encode an integer TLV object function. */
+uint32_t tlv_writer_add_integer_ec(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_value, uint32_t value_length);
+
+/* Error check for encode an array of integer TLV objects function. */
+uint32_t tlv_writer_add_integer_array_ec(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_values, uint32_t value_size,
+    uint32_t value_count);
+
+/* Error check for decode the integer TLV objects into an array function. */
+uint32_t tlv_decode_integer_array_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tlv_tag, uint8_t * p_values,
+    uint32_t value_size, uint32_t max_value_count, uint32_t * p_value_count);
+
+/* Error check for encode a TLV object with the value octets function. */
+uint32_t tlv_writer_add_value_ec(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_value, uint32_t value_length);
+
+/* Error check for open a container TLV object function. */
+uint32_t tlv_writer_open_container_ec(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, bool_t b_length_definite);
+
+/* Error check for close the last opened container TLV object function. */
+uint32_t tlv_writer_close_container_ec(tlv_writer_t * p_tlv_writer);
+
+/* Error check for get the number of encoded octets function. */
+uint32_t tlv_writer_finish_ec(tlv_writer_t * p_tlv_writer, uint32_t * p_encoded_length);
+
+/* Error check for initialize the TLV arena function. */
+uint32_t tlv_arena_init_ec(tlv_arena_t * p_tlv_arena, uint8_t * p_arena_buffer, uint32_t arena_size);
+
+/* Error check for reset the TLV arena function. */
+uint32_t tlv_arena_reset_ec(tlv_arena_t * p_tlv_arena);
+
+/* Error check for create TLV object in the TLV arena function. */
+uint32_t create_tlv_object_in_arena_ec(tlv_arena_t * p_tlv_arena, tlv_object_t * p_tlv_object, uint32_t tlv_tag, uint8_t * p_tlv_value, uint32_t value_length);
+
+/* Error check for parse TLV data buffer in the TLV arena function. */
+uint32_t parse_tlv_object_in_arena_ec(tlv_arena_t * p_tlv_arena, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_t * p_tlv_object);
+
+/* Error check for build the TLV index function. */
+uint32_t tlv_index_build_ec(tlv_index_t * p_tlv_index, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length,
+    tlv_index_node_t * p_tlv_index_nodes, uint32_t max_node_count);
+
+/* Error check for search the first TLV object with the tag in the TLV index function. */
+uint32_t tlv_index_search_tag_ec(const tlv_index_t * p_tlv_index, uint32_t tag, uint32_t * p_node_index);
+
+/* Error check for find the child TLV object with the tag in the container node function. */
+uint32_t tlv_index_find_child_ec(const tlv_index_t * p_tlv_index, uint32_t container_node_index, uint32_t tag, uint32_t * p_node_index);
+
+/* Error check for get the TLV object view of the TLV index node function. */
+uint32_t tlv_index_get_view_ec(const tlv_index_t * p_tlv_index, uint32_t node_index, tlv_object_view_t * p_tlv_object_view);
+
+/* Error check for create the TLV batch pool function. */
+uint32_t tlv_batch_pool_create_ec(uint32_t worker_thread_count, tlv_batch_pool_t ** pp_tlv_batch_pool);
+
+/* Error check for decode a batch of messages function. */
+uint32_t tlv_batch_decode_ec(tlv_batch_pool_t * p_tlv_batch_pool, tlv_batch_message_t * p_tlv_batch_messages, uint32_t message_count,
+    tlv_batch_callback_t p_callback, void_t * p_callback_data);
+
+/* Error check for destroy the TLV batch pool function. */
+uint32_t tlv_batch_pool_destroy_ec(tlv_batch_pool_t * p_tlv_batch_pool);
+
+/* Error check for register the TLV codec of a tag number function. */
+uint32_t tlv_codec_register_ec(uint32_t tlv_tag, const tlv_codec_t * p_tlv_codec);
+
+/* Error check for create container TLV object function. */
+uint32_t create_tlv_container_ec(tlv_object_t * p_tlv_object, uint32_t tlv_tag, bool_t b_length_definite);
+
+/* Error check for create container TLV object in the TLV arena function. */
+uint32_t create_tlv_container_in_arena_ec(tlv_arena_t * p_tlv_arena, tlv_object_t * p_tlv_object, uint32_t tlv_tag, bool_t b_length_definite);
+
+/* Error check for get the encoded length of the TLV object function. */
+uint32_t get_tlv_object_encoded_length_ec(tlv_object_t * p_tlv_object, uint32_t * p_encoded_length);
+
+/* Error check for encode the TLV object into the TLV data buffer function. */
+uint32_t encode_tlv_object_ec(tlv_object_t * p_tlv_object, uint8_t * p_tlv_data_buffer, uint32_t buffer_size, uint32_t * p_encoded_length);
+
+/* Error check for initialize the TLV frame reader function. */
+uint32_t tlv_frame_reader_init_ec(tlv_frame_reader_t * p_tlv_frame_reader, uint32_t max_message_length);
+
+/* Error check for check a complete top level TLV message is received function. */
+uint32_t tlv_frame_reader_check_ec(tlv_frame_reader_t * p_tlv_frame_reader, const tlv_data_segment_t * p_tlv_data_segments, uint32_t segment_count,
+    uint32_t * p_message_length);
+
+/* Error check for reset the TLV frame reader function. */
+uint32_t tlv_frame_reader_reset_ec(tlv_frame_reader_t * p_tlv_frame_reader);
+
+/* Error check for free the TLV encoded buffer of the TLV object function. */
+uint32_t free_tlv_object_buffer_ec(tlv_object_t * p_tlv_object);
+
+/* Error check for set the TLV allocator function. */
+uint32_t tlv_set_allocator_ec(const tlv_allocator_t * p_tlv_allocator);
+
+/* Error check for initialize the TLV counting allocator function. */
+uint32_t tlv_counting_allocator_init_ec(tlv_counting_allocator_t * p_tlv_counting_allocator, const tlv_allocator_t * p_backing_allocator);
+
+/* Error check for reset the counts of the TLV counting allocator function. */
+uint32_t tlv_counting_allocator_reset_ec(tlv_counting_allocator_t * p_tlv_counting_allocator);
+
 #endif /* __TLV_H__ */
@@ -0,0 +1,200 @@
+/*
+ * Name: tlv_allocator.c
+ *
+ * Description:
+ * All API definitions required for the TLV allocator (heap memory of the TLV module) and the TLV counting allocator.
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#define TLV_OBJECT_SOURCE_CODE
+
+#include "tlv_api.h"
+#include "tlv.h"
+#include "tlv_definition.h"
+
+/* Allocator functions of the default TLV allocator (malloc and free). */
+static void_t * heap_alloc(void_t * p_allocator_context, size_t size);
+static void_t heap_free(void_t * p_allocator_context, void_t * p_memory);
+static void_t * heap_realloc(void_t * p_allocator_context, void_t * p_memory, size_t size);
+
+/* Add to a count of the TLV counting allocator (relaxed, the counts are read after the counted operations). */
+#if (0 < TLV_ATOMIC_COUNTS)
+#define ADD_TLV_ALLOCATOR_COUNT(count, value)    (void_t)atomic_fetch_add_explicit(&(count), (uint64_t)(value), memory_order_relaxed)
+#else
+#define ADD_TLV_ALLOCATOR_COUNT(count, value)    ((count) += (uint64_t)(value))
+#endif /* TLV_ATOMIC_COUNTS */
+
+/* Subtract from a count of the TLV allocator. */
+#if (0 < TLV_ATOMIC_COUNTS)
+#define SUB_TLV_ALLOCATOR_COUNT(count, value)    (void_t)atomic_fetch_sub_explicit(&(count), (uint64_t)(value), memory_order_relaxed)
+#else
+#define SUB_TLV_ALLOCATOR_COUNT(count, value)    ((count) -= (uint64_t)(value))
+#endif /* TLV_ATOMIC_COUNTS */
+
+/* Allocator functions of the TLV counting allocator. */
+static void_t * counting_alloc(void_t * p_allocator_context, size_t size);
+static void_t counting_free(void_t * p_allocator_context, void_t * p_memory);
+static void_t * counting_realloc(void_t * p_allocator_context, void_t * p_memory, size_t size);
+static void_t * counting_aligned_alloc(void_t * p_allocator_context, size_t alignment, size_t size);
+
+/* Default TLV allocator (malloc and free). */
+static const tlv_allocator_t g_tlv_heap_allocator = { heap_alloc, heap_free, heap_realloc, NULL, NULL };
+
+/* TLV allocator of the TLV module heap memory. */
+static const tlv_allocator_t * gp_tlv_allocator = &g_tlv_heap_allocator;
+
+/* Heap memory allocated with the TLV allocator and not freed yet, the TLV allocator is not changed while the memory is allocated. */
+static tlv_allocator_count_t g_tlv_heap_memory_count = 0U;
+
+/* Function to set the TLV allocator of the TLV module heap memory. */
+uint32_t tlv_set_allocator(const tlv_allocator_t * p_tlv_allocator)
+{
+    TLV_STATUS status = TLV_SUCCESS;
+
+    /* NULL, restore the default TLV allocator. */
+    const tlv_allocator_t * p_new_tlv_allocator = (p_tlv_allocator) ? p_tlv_allocator : &g_tlv_heap_allocator;
+
+    if ((p_new_tlv_allocator != gp_tlv_allocator) && (g_tlv_heap_memory_count))
+    {
+        /* Allocated memory would be freed with another TLV allocator. */
+        status = TLV_ALLOCATOR_IN_USE;
+    }
+    else
+    {
+        gp_tlv_allocator = p_new_tlv_allocator;
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to get the TLV allocator. */
+const tlv_allocator_t * tlv_get_allocator(void_t)
+{
+    return gp_tlv_allocator;
+}
+
+/* Allocate memory from heap with the TLV allocator (not zero initialized), returns NULL if no memory. */
+void_t * allocate_tlv_heap_memory(uint32_t size)
+{
+    void_t * p_memory = gp_tlv_allocator->p_alloc(gp_tlv_allocator->p_allocator_context, size);
+
+    if (p_memory)
+    {
+        ADD_TLV_ALLOCATOR_COUNT(g_tlv_heap_memory_count, 1U);
+    }
+
+    /* Return allocated memory. */
+    return p_memory;
+}
+
+/* Free memory allocated with allocate_tlv_heap_memory(). */
+void_t free_tlv_heap_memory(void_t * p_memory)
+{
+    gp_tlv_allocator->p_free(gp_tlv_allocator->p_allocator_context, p_memory);
+    SUB_TLV_ALLOCATOR_COUNT(g_tlv_heap_memory_count, 1U);
+}
+
+/* Function to initialize the TLV counting allocator on the backing TLV allocator. */
+uint32_t tlv_counting_allocator_init(tlv_counting_allocator_t * p_tlv_counting_allocator, const tlv_allocator_t * p_backing_allocator)
+{
+    p_tlv_counting_allocator->p_backing_allocator = (p_backing_allocator) ? p_backing_allocator : &g_tlv_heap_allocator;
+
+    /* Optional functions are only set if the backing TLV allocator has them. */
+    p_tlv_counting_allocator->tlv_allocator.p_alloc = counting_alloc;
+    p_tlv_counting_allocator->tlv_allocator.p_free = counting_free;
+    p_tlv_counting_allocator->tlv_allocator.p_realloc = (p_tlv_counting_allocator->p_backing_allocator->p_realloc) ? counting_realloc : NULL;
+    p_tlv_counting_allocator->tlv_allocator.p_aligned_alloc =
+        (p_tlv_counting_allocator->p_backing_allocator->p_aligned_alloc) ? counting_aligned_alloc : NULL;
+    p_tlv_counting_allocator->tlv_allocator.p_allocator_context = p_tlv_counting_allocator;
+
+    return tlv_counting_allocator_reset(p_tlv_counting_allocator);
+}
+
+/* Function to reset the counts of the TLV counting allocator. */
+uint32_t tlv_counting_allocator_reset(tlv_counting_allocator_t * p_tlv_counting_allocator)
+{
+    p_tlv_counting_allocator->allocation_count = 0U;
+    p_tlv_counting_allocator->free_count = 0U;
+    p_tlv_counting_allocator->allocated_octets = 0U;
+    p_tlv_counting_allocator->reallocation_count = 0U;
+    p_tlv_counting_allocator->reallocated_octets = 0U;
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Default TLV allocator functions, the allocator context is not used. */
+static void_t * heap_alloc(void_t * p_allocator_context, size_t size)
+{
+    (void)p_allocator_context;
+    return malloc(size);
+}
+
+static void_t heap_free(void_t * p_allocator_context, void_t * p_memory)
+{
+    (void)p_allocator_context;
+    free(p_memory);
+}
+
+static void_t * heap_realloc(void_t * p_allocator_context, void_t * p_memory, size_t size)
+{
+    (void)p_allocator_context;
+    return realloc(p_memory, size);
+}
+
+/* TLV counting allocator functions, count and forward to the backing TLV allocator. */
+static void_t * counting_alloc(void_t * p_allocator_context, size_t size)
+{
+    tlv_counting_allocator_t * p_tlv_counting_allocator = (tlv_counting_allocator_t *)p_allocator_context;
+    const tlv_allocator_t * p_backing_allocator = p_tlv_counting_allocator->p_backing_allocator;
+
+    ADD_TLV_ALLOCATOR_COUNT(p_tlv_counting_allocator->allocation_count, 1U);
+    ADD_TLV_ALLOCATOR_COUNT(p_tlv_counting_allocator->allocated_octets, size);
+
+    return p_backing_allocator->p_alloc(p_backing_allocator->p_allocator_context, size);
+}
+
+static void_t counting_free(void_t * p_allocator_context, void_t * p_memory)
+{
+    tlv_counting_allocator_t * p_tlv_counting_allocator = (tlv_counting_allocator_t *)p_allocator_context;
+    const tlv_allocator_t * p_backing_allocator = p_tlv_counting_allocator->p_backing_allocator;
+
+    ADD_TLV_ALLOCATOR_COUNT(p_tlv_counting_allocator->free_count, 1U);
+
+    p_backing_allocator->p_free(p_backing_allocator->p_allocator_context, p_memory);
+}
+
+static void_t * counting_realloc(void_t * p_allocator_context, void_t * p_memory, size_t size)
+{
+    tlv_counting_allocator_t * p_tlv_counting_allocator = (tlv_counting_allocator_t *)p_allocator_context;
+    const tlv_allocator_t * p_backing_allocator = p_tlv_counting_allocator->p_backing_allocator;
+
+    if (!p_memory)
+    {
+        /* Realloc of NULL allocates new memory. */
+        ADD_TLV_ALLOCATOR_COUNT(p_tlv_counting_allocator->allocation_count, 1U);
+        ADD_TLV_ALLOCATOR_COUNT(p_tlv_counting_allocator->allocated_octets, size);
+    }
+    else
+    {
+        /* Resize of the allocated memory, not a new allocation. */
+        ADD_TLV_ALLOCATOR_COUNT(p_tlv_counting_allocator->reallocation_count, 1U);
+        ADD_TLV_ALLOCATOR_COUNT(p_tlv_counting_allocator->reallocated_octets, size);
+    }
+
+    return p_backing_allocator->p_realloc(p_backing_allocator->p_allocator_context, p_memory, size);
+}
+
+static void_t * counting_aligned_alloc(void_t * p_allocator_context, size_t alignment, size_t size)
+{
+    tlv_counting_allocator_t * p_tlv_counting_allocator = (tlv_counting_allocator_t *)p_allocator_context;
+    const tlv_allocator_t * p_backing_allocator = p_tlv_counting_allocator->p_backing_allocator;
+
+    ADD_TLV_ALLOCATOR_COUNT(p_tlv_counting_allocator->allocation_count, 1U);
+    ADD_TLV_ALLOCATOR_COUNT(p_tlv_counting_allocator->allocated_octets, size);
+
+    return p_backing_allocator->p_aligned_alloc(p_backing_allocator->p_allocator_context, alignment, size);
+}
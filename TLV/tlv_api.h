@@ -63,6 +63,8 @@
 #define TLV_TAG_NOT_CREATED        0x7U
 #define TLV_MAX_CHILD_COUNT        0x8U
 #define TLV_CHILD_NOT_FOUND        0x9U
+#define TLV_SEND_VECTOR_FULL       0x16U
+#define TLV_SEND_FAILED            0x17U
 */
 
 #define TLV_CHILD_HAS_PARENT       0xAU
@@ -75,6 +77,10 @@
 #define TLV_NO_TAG_FOUND           0x11U
 #define TLV_OBJECT_INVALID_PTR     0x12U
 #define TLV_BAD_TAG                0x13U
+#define TLV_CONTAINER_OPEN         0x14U
+#define TLV_MAX_CONTAINER_DEPTH    0x15U
+#define TLV_FRAME_INCOMPLETE       0x18U
+#define TLV_ALLOCATOR_IN_USE       0x19U
 
 
 
@@ -83,6 +89,54 @@
 #endif /* __TLV_APP_DATA_API_H__ */
 
 
+#ifndef __TLV_APP_DATA_API_H__
+/* Alignment (in octets) of the memory allocated from the TLV arena. */
+#define TLV_ARENA_ALIGNMENT        8U
+
+/*
+ * This is a TLV Arena, a bump allocator on the application provided memory. TLV objects and their TLV encoded buffers
+ * for one message can be allocated from the arena (no calloc per TLV object) and all are released together with a single
+ * tlv_arena_reset(). All members are internal to the TLV arena.
+ */
+typedef struct tlv_arena
+{
+    /* Arena memory, its size and the number of allocated octets. */
+    uint8_t             * p_arena_buffer;
+    uint32_t              arena_size;
+    uint32_t              arena_used_size;
+
+} tlv_arena_t;
+
+/*
+ * TLV data segment, received TLV data in place (e.g. the unread octets of a ring buffer up to the end of the buffer and the rolled
+ * over part at the start of the buffer).
+ */
+typedef struct tlv_data_segment
+{
+    const uint8_t       * p_tlv_data;
+    uint32_t              data_length;
+
+} tlv_data_segment_t;
+
+/*
+ * This is a TLV Frame Reader, it finds a complete top level TLV message at the start of the received TLV data (tag and definite
+ * length, or the end of contents octets of the indefinite length containers). The octets are checked in place, only the
+ * TLV objects received since the last check are parsed. All members are internal to the TLV frame reader.
+ */
+typedef struct tlv_frame_reader
+{
+    /* Octets of the TLV message checked (complete TLV objects) and the indefinite length containers open after them. */
+    uint32_t              checked_length;
+    uint32_t              container_depth;
+
+    /* Maximum length of a TLV message (e.g. the ring buffer size), a longer TLV message can never be received complete. */
+    uint32_t              max_message_length;
+
+} tlv_frame_reader_t;
+
+#endif /* __TLV_APP_DATA_API_H__ */
+
+
 /*
  * This is a TLV Object Data structure which can be used as container as well as child TLV Object.
  */
@@ -158,9 +212,266 @@ typedef struct tlv_object
     struct tlv_object   * p_child_tlv_object_next,
                         * p_child_tlv_object_previous;
 
+    /* TLV arena the TLV encoded buffer is allocated from (NULL if allocated from heap). */
+    tlv_arena_t         * p_tlv_arena;
+
 } tlv_object_t;
 
 
+/*
+ * This is a TLV Object View, a parsed TLV object that points into the caller's TLV data buffer.
+ * The TLV encoded octets are not copied and no memory is allocated, the view is valid as long as
+ * the TLV data buffer is valid and not modified.
+ */
+typedef struct tlv_object_view
+{
+    /* Tag number of the TLV object. */
+    uint32_t              tlv_object_tag_number;
+
+    /* Tag length in octets. */
+    uint32_t              tlv_tag_length;
+
+    /* TLV object is container of primitive TLV objects and/or constructed TLV objects.  */
+    bool_t                b_tlv_container_object;
+
+    /* Length of TLV Object is definite. */
+    bool_t                b_tlv_object_length_definite;
+
+    /*
+     * Length (number of octets) of the encoded TLV object (includes tag, length and value octets).
+     * Note: For a container TLV object of indefinite length only the tag and length octets are included.
+     */
+    uint32_t              tlv_encoded_object_length;
+
+    /* Length (number of value octet) of the primitive TLV object. */
+    uint32_t              tlv_object_value_length;
+
+    /* Start of the TLV object in the TLV data buffer. */
+    const uint8_t       * p_tlv_object_encoded_buffer;
+
+    /* Start of value octets in the TLV data buffer (NULL for a container TLV object). */
+    const uint8_t       * p_tlv_value_buffer;
+
+} tlv_object_view_t;
+
+
+/*
+ * TLV stream parser callback, called for each TLV object parsed from the fed TLV data.
+ * The TLV object view is valid only during the callback.
+ * Note: End of contents octets of a container TLV object of indefinite length are reported as TLV object with tag number TAG_END_OF_CONTENT.
+ */
+typedef void_t (*tlv_stream_callback_t)(const tlv_object_view_t * p_tlv_object_view, void_t * p_callback_data);
+
+/*
+ * TLV stream parser value callback, called for the value octets of a TLV object that is larger than the TLV object buffer.
+ * The value octets are reported in order as they are fed (value offset is the offset of the first reported octet in the value),
+ * the TLV object view has the tag and length of the TLV object and p_tlv_value_buffer is NULL.
+ */
+typedef void_t (*tlv_stream_value_callback_t)(const tlv_object_view_t * p_tlv_object_view, const uint8_t * p_value, uint32_t value_offset,
+    uint32_t value_length, void_t * p_callback_data);
+
+/*
+ * This is a TLV Stream Parser, it parses TLV data received in chunks of any length (partial tag, length and value octets
+ * are kept across the calls). All members are internal to the TLV stream parser.
+ */
+typedef struct tlv_stream_parser
+{
+    /* Parser state (tag, length, value, skip value or stream value octets). */
+    uint32_t              stream_state;
+
+    /* Tag number, tag length and the constructed bit of the TLV object being parsed. */
+    uint32_t              tlv_object_tag_number;
+    uint32_t              tlv_tag_length;
+    bool_t                b_tlv_constructed_object;
+
+    /* Length octets (including the first length octet) and remaining long form length octets of the TLV object being parsed. */
+    uint32_t              tlv_length_octets;
+    uint32_t              tlv_remaining_length_octets;
+
+    /* Value length and remaining value octets of the TLV object being parsed. */
+    uint32_t              tlv_object_value_length;
+    uint32_t              tlv_remaining_value_length;
+
+    /* TLV object buffer, keeps the octets of a TLV object that is split across the fed TLV data. */
+    uint8_t             * p_tlv_object_buffer;
+    uint32_t              tlv_object_buffer_size;
+    uint32_t              tlv_object_length;
+
+    /* Callback for the parsed TLV objects and the value callback (NULL if not set) for the TLV objects larger than the TLV object buffer. */
+    tlv_stream_callback_t p_callback;
+    tlv_stream_value_callback_t p_value_callback;
+    void_t              * p_callback_data;
+
+} tlv_stream_parser_t;
+
+
+/* Maximum depth of containers (container within a container) open in the TLV writer. */
+#define TLV_WRITER_MAX_CONTAINER_DEPTH    8U
+
+/*
+ * Maximum depth of containers (container within a container) parsed by tlv_search_tag(), add_data_to_tlv_object() and
+ * tlv_index_build(). Containers are parsed with an explicit stack of this depth (no recursive calls), a deeper container
+ * returns TLV_MAX_CONTAINER_DEPTH. Can be set at build time.
+ */
+#ifndef TLV_PARSER_MAX_CONTAINER_DEPTH
+#define TLV_PARSER_MAX_CONTAINER_DEPTH    32U
+#endif /* TLV_PARSER_MAX_CONTAINER_DEPTH */
+
+/*
+ * This is a TLV Writer, it encodes TLV objects directly into the application provided TLV data buffer in one pass
+ * (no TLV object and no memory allocation per TLV object). All members are internal to the TLV writer.
+ */
+typedef struct tlv_writer
+{
+    /* TLV data buffer, its size and the number of encoded octets. */
+    uint8_t             * p_tlv_data_buffer;
+    uint32_t              buffer_size;
+    uint32_t              encoded_length;
+
+    /* Open containers, start of the value octets and the length form of each open container. */
+    uint32_t              container_depth;
+    uint32_t              container_value_index[TLV_WRITER_MAX_CONTAINER_DEPTH];
+    bool_t                b_container_length_definite[TLV_WRITER_MAX_CONTAINER_DEPTH];
+
+} tlv_writer_t;
+
+
+/* TLV index node index for no node (no parent, no child or no sibling). */
+#define TLV_INDEX_NO_NODE                 0xFFFFFFFFU
+
+/* Tag class of the TLV index node. */
+#define TLV_TAG_CLASS_UNIVERSAL           0x00U
+#define TLV_TAG_CLASS_APPLICATION         0x40U
+#define TLV_TAG_CLASS_CONTEXT_SPECIFIC    0x80U
+
+/*
+ * TLV index node info, tag number, tag class, container and definite length flags and the length of the tag and length octets
+ * of the TLV object packed in one word. Tag number is up to 21 bits (3 extended tag octets) and the tag and length octets are
+ * up to 9 octets (4 tag octets and 5 length octets).
+ */
+#define TLV_INDEX_NODE_TAG_NUMBER_MASK    0x001FFFFFU
+#define TLV_INDEX_NODE_HEADER_LENGTH_MASK 0x0F000000U
+#define TLV_INDEX_NODE_CONTAINER          0x10000000U
+#define TLV_INDEX_NODE_LENGTH_DEFINITE    0x20000000U
+#define TLV_INDEX_NODE_TAG_CLASS_MASK     0xC0000000U
+#define TLV_INDEX_NODE_INFO_SHIFT         24U
+
+/* Get the tag number, tag class (TLV_TAG_CLASS_xxx), container and definite length flags of the TLV index node. */
+#define TLV_INDEX_NODE_TAG_NUMBER(p_node)           ((p_node)->tlv_node_info & TLV_INDEX_NODE_TAG_NUMBER_MASK)
+#define TLV_INDEX_NODE_TAG_CLASS(p_node)            (((p_node)->tlv_node_info & TLV_INDEX_NODE_TAG_CLASS_MASK) >> TLV_INDEX_NODE_INFO_SHIFT)
+#define TLV_INDEX_NODE_IS_CONTAINER(p_node)         (((p_node)->tlv_node_info & TLV_INDEX_NODE_CONTAINER) ? TRUE : FALSE)
+#define TLV_INDEX_NODE_IS_LENGTH_DEFINITE(p_node)   (((p_node)->tlv_node_info & TLV_INDEX_NODE_LENGTH_DEFINITE) ? TRUE : FALSE)
+
+/*
+ * Get the length of the tag and length octets, the offset of the value octets (contents of a container) and the length of the
+ * encoded TLV object (includes tag, length, value and end of contents octets) of the TLV index node.
+ */
+#define TLV_INDEX_NODE_HEADER_LENGTH(p_node)        \
+    (((p_node)->tlv_node_info & TLV_INDEX_NODE_HEADER_LENGTH_MASK) >> TLV_INDEX_NODE_INFO_SHIFT)
+#define TLV_INDEX_NODE_VALUE_OFFSET(p_node)         ((p_node)->tlv_header_offset + TLV_INDEX_NODE_HEADER_LENGTH(p_node))
+#define TLV_INDEX_NODE_ENCODED_LENGTH(p_node)       \
+    (TLV_INDEX_NODE_HEADER_LENGTH(p_node) + (p_node)->tlv_object_value_length + (TLV_INDEX_NODE_IS_LENGTH_DEFINITE(p_node) ? 0U : 2U))
+
+/*
+ * This is a TLV Index Node, one parsed TLV object in the TLV index (24 octets, the nodes of a message are in a few cache lines).
+ * Offsets are from the start of the indexed TLV data buffer, the TLV object is not copied. Child TLV objects of a container are
+ * linked by the first child and the next sibling node index. Use the TLV_INDEX_NODE_xxx() macros to get the packed node info.
+ * Note: Same as the TLV object parser, a container is a TLV object of indefinite length. A definite length TLV object is indexed
+ * with its value octets (application class tags are always encoded with the constructed bit).
+ */
+typedef struct tlv_index_node
+{
+    /* Tag number, tag class, container and definite length flags and length of the tag and length octets (packed). */
+    uint32_t              tlv_node_info;
+
+    /* Offset of the tag octets of the TLV object. */
+    uint32_t              tlv_header_offset;
+
+    /* Length of the value octets (contents of a container, without end of contents octets). */
+    uint32_t              tlv_object_value_length;
+
+    /* Parent, first child and next sibling node index (TLV_INDEX_NO_NODE if none). */
+    uint32_t              parent_node_index;
+    uint32_t              first_child_node_index;
+    uint32_t              next_sibling_node_index;
+
+} tlv_index_node_t;
+
+/*
+ * This is a TLV Index, the TLV data buffer parsed once into an application provided array of TLV index nodes
+ * (in the order of the TLV objects in the TLV data buffer, node 0 is the first TLV object).
+ */
+typedef struct tlv_index
+{
+    /* Indexed TLV data buffer. */
+    const uint8_t       * p_tlv_data_buffer;
+    uint32_t              buffer_length;
+
+    /* TLV index nodes, max and used number of nodes. */
+    tlv_index_node_t    * p_tlv_index_nodes;
+    uint32_t              max_node_count;
+    uint32_t              node_count;
+
+    /* First node index of each tag number (TLV_INDEX_NO_NODE if tag is not in the TLV data buffer). */
+    uint32_t              tag_first_node_index[TAG_MAX + 1U];
+
+} tlv_index_t;
+
+
+/* Maximum number of worker threads in the TLV batch pool. */
+#define TLV_BATCH_MAX_WORKER_THREADS      64U
+
+/*
+ * This is a TLV Batch Message, one TLV encoded message of the batch and its decode result (output slot of the message).
+ * The message is decoded into its own TLV index, the messages of a batch can be decoded in parallel.
+ */
+typedef struct tlv_batch_message
+{
+    /* TLV encoded message (input). */
+    const uint8_t       * p_tlv_data_buffer;
+    uint32_t              buffer_length;
+
+    /* Application provided TLV index nodes for the message (input). */
+    tlv_index_node_t    * p_tlv_index_nodes;
+    uint32_t              max_node_count;
+
+    /* TLV index of the message and status of the decode (output). */
+    tlv_index_t           tlv_index;
+    uint32_t              decode_status;
+
+} tlv_batch_message_t;
+
+/*
+ * TLV batch callback, called for each message after the message is decoded (decode status is set).
+ * Note: The callback is called from the worker threads, messages of the batch are reported in any order.
+ */
+typedef void_t (*tlv_batch_callback_t)(tlv_batch_message_t * p_tlv_batch_message, void_t * p_callback_data);
+
+/* This is a TLV Batch Pool, the worker threads that decode a batch of messages. All members are internal to the TLV batch. */
+typedef struct tlv_batch_pool tlv_batch_pool_t;
+
+
+/*
+ * This is a TLV Codec, the encode, decode, validate and size bound of the TLV objects of a tag number. TLV objects are
+ * created, written and checked through the TLV codec of the tag (looked up by the tag number, no switch per tag).
+ * - p_create: create the TLV object and encode the value (value length 0 creates a container TLV object, if allowed).
+ * - p_add_data: encode a new value into the TLV object (value length is within the max value length of the TLV object).
+ * - p_decode: check the parsed TLV object (tag and length decoded), NULL if no check.
+ * - p_validate: check the value before it is encoded, NULL if no check other than the value length bound.
+ * - min_value_length, max_value_length: value length bound checked by the error checking (0 is a container TLV object).
+ */
+typedef struct tlv_codec
+{
+    uint32_t            (*p_create)(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_value, uint32_t value_length);
+    void_t              (*p_add_data)(tlv_object_t * p_tlv_object, const uint8_t * p_tlv_value, uint32_t value_length);
+    uint32_t            (*p_decode)(const tlv_object_t * p_tlv_object);
+    uint32_t            (*p_validate)(uint32_t tlv_tag, const uint8_t * p_tlv_value, uint32_t value_length);
+    uint32_t              min_value_length;
+    uint32_t              max_value_length;
+
+} tlv_codec_t;
+
+
 /*
  * Defines the TLV api mapping based on error checking selected by the user.
  * This section is only applicable to the application that is using the TLV api.
@@ -184,6 +495,44 @@ typedef struct tlv_object
 #define add_data_to_tlv_object                  add_data_to_tlv_object
 #define parse_tlv_object                        parse_tlv_object
 #define tlv_search_tag                          tlv_search_tag
+#define parse_tlv_object_view                   parse_tlv_object_view
+#define tlv_search_tag_view                     tlv_search_tag_view
+#define tlv_stream_parser_init                  tlv_stream_parser_init
+#define tlv_stream_parser_feed                  tlv_stream_parser_feed
+#define tlv_stream_parser_reset                 tlv_stream_parser_reset
+#define tlv_stream_parser_set_value_callback    tlv_stream_parser_set_value_callback
+#define tlv_writer_init                         tlv_writer_init
+#define tlv_writer_add_integer                  tlv_writer_add_integer
+#define tlv_writer_add_integer_array            tlv_writer_add_integer_array
+#define tlv_decode_integer_array                tlv_decode_integer_array
+#define tlv_writer_add_value                    tlv_writer_add_value
+#define tlv_writer_open_container               tlv_writer_open_container
+#define tlv_writer_close_container              tlv_writer_close_container
+#define tlv_writer_finish                       tlv_writer_finish
+#define tlv_arena_init                          tlv_arena_init
+#define tlv_arena_reset                         tlv_arena_reset
+#define create_tlv_object_in_arena              create_tlv_object_in_arena
+#define parse_tlv_object_in_arena               parse_tlv_object_in_arena
+#define tlv_index_build                         tlv_index_build
+#define tlv_index_search_tag                    tlv_index_search_tag
+#define tlv_index_find_child                    tlv_index_find_child
+#define tlv_index_get_view                      tlv_index_get_view
+#define tlv_batch_pool_create                   tlv_batch_pool_create
+#define tlv_batch_decode                        tlv_batch_decode
+#define tlv_batch_pool_destroy                  tlv_batch_pool_destroy
+#define tlv_codec_register                      tlv_codec_register
+#define create_tlv_container                    create_tlv_container
+#define create_tlv_container_in_arena           create_tlv_container_in_arena
+#define get_tlv_object_encoded_length           get_tlv_object_encoded_length
+#define encode_tlv_object                       encode_tlv_object
+#define tlv_frame_reader_init                   tlv_frame_reader_init
+#define tlv_frame_reader_check                  tlv_frame_reader_check
+#define tlv_frame_reader_reset                  tlv_frame_reader_reset
+#define free_tlv_object_buffer                  free_tlv_object_buffer
+#define tlv_set_allocator                       tlv_set_allocator
+#define tlv_get_allocator                       tlv_get_allocator
+#define tlv_counting_allocator_init             tlv_counting_allocator_init
+#define tlv_counting_allocator_reset            tlv_counting_allocator_reset
 
 #else
 
@@ -194,6 +543,44 @@ typedef struct tlv_object
 #define add_data_to_tlv_object                  add_data_to_tlv_object_ec
 #define parse_tlv_object                        parse_tlv_object_ec
 #define tlv_search_tag                          tlv_search_tag_ec
+#define parse_tlv_object_view                   parse_tlv_object_view_ec
+#define tlv_search_tag_view                     tlv_search_tag_view_ec
+#define tlv_stream_parser_init                  tlv_stream_parser_init_ec
+#define tlv_stream_parser_feed                  tlv_stream_parser_feed_ec
+#define tlv_stream_parser_reset                 tlv_stream_parser_reset_ec
+#define tlv_stream_parser_set_value_callback    tlv_stream_parser_set_value_callback_ec
+#define tlv_writer_init                         tlv_writer_init_ec
+#define tlv_writer_add_integer                  tlv_writer_add_integer_ec
+#define tlv_writer_add_integer_array            tlv_writer_add_integer_array_ec
+#define tlv_decode_integer_array                tlv_decode_integer_array_ec
+#define tlv_writer_add_value                    tlv_writer_add_value_ec
+#define tlv_writer_open_container               tlv_writer_open_container_ec
+#define tlv_writer_close_container              tlv_writer_close_container_ec
+#define tlv_writer_finish                       tlv_writer_finish_ec
+#define tlv_arena_init                          tlv_arena_init_ec
+#define tlv_arena_reset                         tlv_arena_reset_ec
+#define create_tlv_object_in_arena              create_tlv_object_in_arena_ec
+#define parse_tlv_object_in_arena               parse_tlv_object_in_arena_ec
+#define tlv_index_build                         tlv_index_build_ec
+#define tlv_index_search_tag                    tlv_index_search_tag_ec
+#define tlv_index_find_child                    tlv_index_find_child_ec
+#define tlv_index_get_view                      tlv_index_get_view_ec
+#define tlv_batch_pool_create                   tlv_batch_pool_create_ec
+#define tlv_batch_decode                        tlv_batch_decode_ec
+#define tlv_batch_pool_destroy                  tlv_batch_pool_destroy_ec
+#define tlv_codec_register                      tlv_codec_register_ec
+#define create_tlv_container                    create_tlv_container_ec
+#define create_tlv_container_in_arena           create_tlv_container_in_arena_ec
+#define get_tlv_object_encoded_length           get_tlv_object_encoded_length_ec
+#define encode_tlv_object                       encode_tlv_object_ec
+#define tlv_frame_reader_init                   tlv_frame_reader_init_ec
+#define tlv_frame_reader_check                  tlv_frame_reader_check_ec
+#define tlv_frame_reader_reset                  tlv_frame_reader_reset_ec
+#define free_tlv_object_buffer                  free_tlv_object_buffer_ec
+#define tlv_set_allocator                       tlv_set_allocator_ec
+#define tlv_get_allocator                       tlv_get_allocator
+#define tlv_counting_allocator_init             tlv_counting_allocator_init_ec
+#define tlv_counting_allocator_reset            tlv_counting_allocator_reset_ec
 
 #endif /* DISABLE_ERROR_CHECK */
 
@@ -219,6 +606,8 @@ TLV_STATUS add_tlv_object_to_tlv_container(tlv_object_t * p_container_tlv_object
 /*
  * - Function to add data to TLV object.
  * - The container TLV object can be of type primitive or constructed container.
+ * - For a container TLV object the data is added to the first child TLV object with the tag (containers within the container are
+ * searched depth first, up to TLV_PARSER_MAX_CONTAINER_DEPTH).
  */
 TLV_STATUS add_data_to_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_value, uint32_t value_length);
 
@@ -233,9 +622,249 @@ TLV_STATUS add_data_to_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag,
  */
 TLV_STATUS parse_tlv_object(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_t * p_tlv_object);
 
-/* Function to search TLV encoded data object in the TLV data buffer. */
+/*
+ * - Function to search TLV encoded data object in the TLV data buffer.
+ * - If the searched TLV object is a container, its child TLV objects are searched in order after it. Containers are searched
+ * without recursive calls (explicit stack of TLV_PARSER_MAX_CONTAINER_DEPTH containers), a deeper container returns TLV_MAX_CONTAINER_DEPTH.
+ */
 TLV_STATUS tlv_search_tag(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tag, bool_t b_recursive, tlv_object_t * p_tlv_object);
 
+/*
+ * - Function to parse TLV data buffer into a TLV object view (first found TLV object is parsed.)
+ * - Same as parse_tlv_object(), but the TLV object view points into the TLV data buffer (no memory allocation and no copy).
+ *
+ * NOTE: If the tag found is of indefinite length (container type), then the caller gets the container TLV object view and the caller application
+ * should call tlv_search_tag_view() api (on the TLV data buffer after the container tag and length octets) to parse the child TLV objects.
+ */
+TLV_STATUS parse_tlv_object_view(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_view_t * p_tlv_object_view);
+
+/*
+ * - Function to search TLV encoded data object in the TLV data buffer and parse it into a TLV object view (no memory allocation and no copy).
+ * - If recursive is set to TRUE the child TLV objects of containers are searched, else containers are skipped.
+ */
+TLV_STATUS tlv_search_tag_view(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tag, bool_t b_recursive, tlv_object_view_t * p_tlv_object_view);
+
+/*
+ * - Function to initialize the TLV stream parser.
+ * - The TLV object buffer keeps a TLV object that is split across the fed TLV data, the TLV object buffer size limits
+ * the length of the encoded TLV object (includes tag, length and value octets) that can be parsed.
+ */
+TLV_STATUS tlv_stream_parser_init(tlv_stream_parser_t * p_tlv_stream_parser, uint8_t * p_tlv_object_buffer, uint32_t tlv_object_buffer_size,
+    tlv_stream_callback_t p_callback, void_t * p_callback_data);
+
+/*
+ * - Function to feed TLV data (a chunk of any length) to the TLV stream parser.
+ * - The callback is called for each TLV object as soon as it is parsed. TLV object that is completely in the fed TLV data is not copied
+ * (TLV object view points into the fed TLV data).
+ * - Octets that are not a valid TLV object are skipped, the error status is returned after all the fed TLV data is parsed.
+ */
+TLV_STATUS tlv_stream_parser_feed(tlv_stream_parser_t * p_tlv_stream_parser, const uint8_t * p_tlv_data, uint32_t data_length);
+
+/* Function to reset the TLV stream parser, the partially parsed TLV object is discarded. */
+TLV_STATUS tlv_stream_parser_reset(tlv_stream_parser_t * p_tlv_stream_parser);
+
+/*
+ * - Function to set the value callback of the TLV stream parser (NULL to clear).
+ * - Value octets of a TLV object larger than the TLV object buffer are reported to the value callback as they are fed (the value is not kept
+ * in the TLV object buffer), else the value octets of such TLV object are skipped and TLV_BAD_DATA_SIZE is returned.
+ */
+TLV_STATUS tlv_stream_parser_set_value_callback(tlv_stream_parser_t * p_tlv_stream_parser, tlv_stream_value_callback_t p_value_callback);
+
+/* Function to initialize the TLV writer to encode TLV objects into the TLV data buffer. */
+TLV_STATUS tlv_writer_init(tlv_writer_t * p_tlv_writer, uint8_t * p_tlv_data_buffer, uint32_t buffer_size);
+
+/*
+ * - Function to encode an integer TLV object (the integer value is in the application variable, p_value is the
+ * variable address and value_length is the variable size).
+ * - The integer is encoded with the same octets as the TLV object encoder.
+ */
+TLV_STATUS tlv_writer_add_integer(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_value, uint32_t value_length);
+
+/*
+ * - Function to encode an array of integer TLV objects of the tag (e.g. the child TLV objects of a SEQUENCE OF INTEGER
+ * container), p_values is the array address, value_size is the array element size and value_count the number of elements.
+ * - The tag octets are encoded once for the array, each integer is encoded with the same octets as tlv_writer_add_integer().
+ * - If the TLV data buffer is full, TLV_BAD_BUFFER_LENGTH is returned and the integers encoded so far are kept.
+ */
+TLV_STATUS tlv_writer_add_integer_array(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_values, uint32_t value_size,
+    uint32_t value_count);
+
+/*
+ * - Function to decode the integer TLV objects of the tag in the TLV data buffer (e.g. the value octets of a SEQUENCE OF INTEGER
+ * container) into an array of application variables (value_size octets each, up to max_value_count elements).
+ * - Decoding stops at the end of the TLV data buffer or at the end of contents octets, the number of decoded integers is returned
+ * in p_value_count. Returns TLV_NO_TAG_FOUND for a TLV object of another tag, TLV_BAD_DATA_SIZE if an integer does not fit in
+ * the array element and TLV_BAD_BUFFER_LENGTH if the array is full.
+ */
+TLV_STATUS tlv_decode_integer_array(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tlv_tag, uint8_t * p_values,
+    uint32_t value_size, uint32_t max_value_count, uint32_t * p_value_count);
+
+/* Function to encode a TLV object with the value octets (eg: UTF8 string, application tag value). */
+TLV_STATUS tlv_writer_add_value(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_value, uint32_t value_length);
+
+/*
+ * - Function to open a container TLV object (application class or context specific class tag), the TLV objects
+ * encoded after this call are the child TLV objects of the container until it is closed.
+ * - If length definite is set to TRUE, the length is encoded when the container is closed, else the container is
+ * encoded with indefinite length and end of contents octets.
+ */
+TLV_STATUS tlv_writer_open_container(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, bool_t b_length_definite);
+
+/* Function to close the last opened container TLV object. */
+TLV_STATUS tlv_writer_close_container(tlv_writer_t * p_tlv_writer);
+
+/*
+ * - Function to get the number of encoded octets in the TLV data buffer, all containers should be closed.
+ * - The TLV data buffer can then be sent or written to a ring buffer with one block write.
+ */
+TLV_STATUS tlv_writer_finish(tlv_writer_t * p_tlv_writer, uint32_t * p_encoded_length);
+
+/* Function to initialize the TLV arena on the application provided memory. */
+TLV_STATUS tlv_arena_init(tlv_arena_t * p_tlv_arena, uint8_t * p_arena_buffer, uint32_t arena_size);
+
+/*
+ * - Function to reset the TLV arena, all the memory allocated from the TLV arena is released at once.
+ * - TLV objects created or parsed in the TLV arena must not be used after the reset.
+ */
+TLV_STATUS tlv_arena_reset(tlv_arena_t * p_tlv_arena);
+
+/*
+ * - Function to create TLV object in the TLV arena, same as create_tlv_object() but the TLV encoded buffer is allocated
+ * from the TLV arena (if the TLV arena is NULL the TLV encoded buffer is allocated from heap).
+ * - Returns TLV_NO_MEMORY if the TLV arena is full.
+ */
+TLV_STATUS create_tlv_object_in_arena(tlv_arena_t * p_tlv_arena, tlv_object_t * p_tlv_object, uint32_t tlv_tag, uint8_t * p_tlv_value, uint32_t value_length);
+
+/*
+ * - Function to parse TLV data buffer in the TLV arena, same as parse_tlv_object() but the TLV encoded buffer is allocated
+ * from the TLV arena (if the TLV arena is NULL the TLV encoded buffer is allocated from heap).
+ */
+TLV_STATUS parse_tlv_object_in_arena(tlv_arena_t * p_tlv_arena, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_t * p_tlv_object);
+
+/*
+ * - Function to build the TLV index, the TLV data buffer is parsed once (in one pass) into the TLV index nodes.
+ * - Containers (indefinite length TLV objects) are indexed with their child TLV objects. Same as the TLV object parser, a definite
+ * length TLV object is indexed as one TLV index node with its value octets (its value octets are not parsed as child TLV objects).
+ * - Returns TLV_NO_MEMORY if there are more TLV objects than the TLV index nodes.
+ * NOTE: The TLV index points into the TLV data buffer, it is valid as long as the TLV data buffer is valid and not modified.
+ */
+TLV_STATUS tlv_index_build(tlv_index_t * p_tlv_index, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length,
+    tlv_index_node_t * p_tlv_index_nodes, uint32_t max_node_count);
+
+/* Function to search the first TLV object with the tag in the TLV index (O(1) for tag numbers up to TAG_MAX, no parsing). */
+TLV_STATUS tlv_index_search_tag(const tlv_index_t * p_tlv_index, uint32_t tag, uint32_t * p_node_index);
+
+/*
+ * - Function to find the child TLV object with the tag in the container node (only the children are searched).
+ * - If the container node index is TLV_INDEX_NO_NODE, the top level TLV objects are searched.
+ */
+TLV_STATUS tlv_index_find_child(const tlv_index_t * p_tlv_index, uint32_t container_node_index, uint32_t tag, uint32_t * p_node_index);
+
+/* Function to get the TLV object view of the TLV index node. */
+TLV_STATUS tlv_index_get_view(const tlv_index_t * p_tlv_index, uint32_t node_index, tlv_object_view_t * p_tlv_object_view);
+
+/*
+ * - Function to create the TLV batch pool with the worker threads (the calling thread of tlv_batch_decode() also decodes).
+ * - Worker thread count 0 decodes the batch in the calling thread only.
+ */
+TLV_STATUS tlv_batch_pool_create(uint32_t worker_thread_count, tlv_batch_pool_t ** pp_tlv_batch_pool);
+
+/*
+ * - Function to decode a batch of messages, each message is decoded into its TLV index by the worker threads and the
+ * calling thread. Returns after all the messages of the batch are decoded.
+ * - Callback (optional, can be NULL) is called for each decoded message from the thread that decoded the message.
+ * - Returns TLV_FAIL if any message is not decoded, decode status of each message is in the message.
+ */
+TLV_STATUS tlv_batch_decode(tlv_batch_pool_t * p_tlv_batch_pool, tlv_batch_message_t * p_tlv_batch_messages, uint32_t message_count,
+    tlv_batch_callback_t p_callback, void_t * p_callback_data);
+
+/* Function to destroy the TLV batch pool, worker threads are stopped and joined. */
+TLV_STATUS tlv_batch_pool_destroy(tlv_batch_pool_t * p_tlv_batch_pool);
+
+/*
+ * - Function to register the TLV codec of a tag number (up to TAG_MAX), replaces the TLV codec of the tag (the TLV codec is copied).
+ * - For an application tag p_create and p_add_data can be NULL, the default application class or context specific class encode is used
+ * (e.g. to register only a validate or decode check of the tag).
+ * - The TLV codec NULL removes the registered TLV codec, universal tags are then not supported and application tags use the
+ * default application class or context specific class TLV codec.
+ * NOTE: Register the TLV codecs before the TLV objects are created or parsed, the registration is not thread safe.
+ */
+TLV_STATUS tlv_codec_register(uint32_t tlv_tag, const tlv_codec_t * p_tlv_codec);
+
+/*
+ * - Function to create container TLV object of definite or indefinite length (application class and context specific class tags).
+ * - A definite length container TLV object is encoded with the exact length of its contents (no end of contents octets), a receiver
+ * can skip the container TLV object by its length. The length octets are encoded when the TLV object is measured or encoded.
+ * - create_tlv_object() with value length 0 creates a container TLV object of indefinite length.
+ * NOTE: Only a container TLV object of indefinite length is parsed, searched and indexed with its child TLV objects. A receiver
+ * (parse_tlv_object(), tlv_search_tag(), tlv_search_tag_view(), tlv_index_build()) gets a definite length container TLV object
+ * as one TLV object with value (the encoded child TLV objects), the value can be parsed again to get the child TLV objects.
+ */
+TLV_STATUS create_tlv_container(tlv_object_t * p_tlv_object, uint32_t tlv_tag, bool_t b_length_definite);
+
+/* Function to create container TLV object in the TLV arena, same as create_tlv_container() but the TLV encoded buffer is allocated from the TLV arena. */
+TLV_STATUS create_tlv_container_in_arena(tlv_arena_t * p_tlv_arena, tlv_object_t * p_tlv_object, uint32_t tlv_tag, bool_t b_length_definite);
+
+/*
+ * - Function to get the encoded length of the TLV object, includes the child TLV objects of a container TLV object and the end of
+ * contents octets of indefinite length containers (measure pass, nothing is written).
+ * - Application can allocate a TLV data buffer of the exact encoded length for encode_tlv_object().
+ * - Returns TLV_MAX_CONTAINER_DEPTH if the containers are nested deeper than TLV_PARSER_MAX_CONTAINER_DEPTH.
+ */
+TLV_STATUS get_tlv_object_encoded_length(tlv_object_t * p_tlv_object, uint32_t * p_encoded_length);
+
+/*
+ * - Function to encode the TLV object (and the child TLV objects of a container TLV object) into the TLV data buffer.
+ * - Returns TLV_BAD_BUFFER_LENGTH if the TLV data buffer is smaller than the encoded length of the TLV object, or
+ * TLV_MAX_CONTAINER_DEPTH if the containers are nested deeper than TLV_PARSER_MAX_CONTAINER_DEPTH.
+ */
+TLV_STATUS encode_tlv_object(tlv_object_t * p_tlv_object, uint8_t * p_tlv_data_buffer, uint32_t buffer_size, uint32_t * p_encoded_length);
+
+/* Function to initialize the TLV frame reader, TLV messages longer than max message length (e.g. the ring buffer size) are not valid. */
+TLV_STATUS tlv_frame_reader_init(tlv_frame_reader_t * p_tlv_frame_reader, uint32_t max_message_length);
+
+/*
+ * - Function to check if a complete top level TLV message is received, the TLV data segments are the received TLV data in place
+ * (e.g. the unread octets of a ring buffer, up to two segments) and start with the TLV message.
+ * - Returns TLV_SUCCESS and the TLV message length if the TLV message is complete, the TLV frame reader is reset for the next TLV message.
+ * A TLV message within the first TLV data segment can be parsed in place (tlv_parse_app_data(), parse_tlv_object_view(), tlv_index_build()),
+ * a TLV message split across the TLV data segments can be fed to the TLV stream parser one segment at a time (no copy to a message buffer).
+ * - Returns TLV_FRAME_INCOMPLETE if more TLV data is required, check again with the same TLV data and the TLV data received after it.
+ * The TLV objects already checked are not parsed again.
+ * - Returns TLV_BAD_TAG, TLV_BAD_BUFFER_LENGTH, TLV_BAD_DATA_SIZE (longer than max message length) or TLV_MAX_CONTAINER_DEPTH if the
+ * TLV data does not start with a valid TLV message, the TLV frame reader is reset (application can skip the first octet and check again).
+ */
+TLV_STATUS tlv_frame_reader_check(tlv_frame_reader_t * p_tlv_frame_reader, const tlv_data_segment_t * p_tlv_data_segments, uint32_t segment_count,
+    uint32_t * p_message_length);
+
+/* Function to reset the TLV frame reader, the partially checked TLV message is discarded. */
+TLV_STATUS tlv_frame_reader_reset(tlv_frame_reader_t * p_tlv_frame_reader);
+
+/*
+ * Function to free the TLV encoded buffer of the TLV object allocated from heap with the TLV allocator (create_tlv_object(),
+ * parse_tlv_object()). TLV encoded buffers allocated from a TLV arena are released with tlv_arena_reset().
+ */
+TLV_STATUS free_tlv_object_buffer(tlv_object_t * p_tlv_object);
+
+/*
+ * Function to set the TLV allocator of the TLV module heap memory (NULL, malloc and free). Memory is freed with the TLV allocator
+ * set when it is freed, set the TLV allocator before any TLV object or app data is allocated from heap (not thread safe).
+ * Returns TLV_ALLOCATOR_IN_USE if heap memory allocated with the current TLV allocator is not freed yet.
+ */
+TLV_STATUS tlv_set_allocator(const tlv_allocator_t * p_tlv_allocator);
+
+/* Function to get the TLV allocator set with tlv_set_allocator() (malloc and free by default). */
+const tlv_allocator_t * tlv_get_allocator(void_t);
+
+/*
+ * Function to initialize the TLV counting allocator on the backing TLV allocator (NULL, malloc and free), set
+ * &tlv_counting_allocator.tlv_allocator with tlv_set_allocator() to count the allocations and allocated octets per operation.
+ */
+TLV_STATUS tlv_counting_allocator_init(tlv_counting_allocator_t * p_tlv_counting_allocator, const tlv_allocator_t * p_backing_allocator);
+
+/* Function to reset the counts of the TLV counting allocator. */
+TLV_STATUS tlv_counting_allocator_reset(tlv_counting_allocator_t * p_tlv_counting_allocator);
+
 #endif /* TLV_OBJECT_SOURCE_CODE */
 
 #endif /* __TLV_API_H__*/
@@ -39,6 +39,19 @@ typedef struct tlv_app_data
                   * p_parent_app_data;
 
     tlv_object_t  * p_tlv_object;
+
+    /*
+     * App data is changed and not encoded yet (dirty), a container is dirty if any of its child app data is dirty.
+     * Only dirty app data is encoded again, the TLV object of a clean app data keeps its encoded octets.
+     */
+    bool_t          b_dirty;
+
+    /*
+     * Lazy decode, the parsed TLV object is kept as a view into the TLV data buffer (header and value location) and the
+     * value is decoded into the application variable on the first access (tlv_decode_app_data()).
+     */
+    bool_t              b_decode_pending;
+    tlv_object_view_t   tlv_pending_object_view;
 }tlv_app_data_t;
 
 /* 
@@ -89,6 +102,102 @@ uint32_t tlv_search_parse_app_data(const uint8_t * p_tlv_data_buffer, uint32_t b
 /* Function to delete a TLV object and removes the mapping between the TLV object and the app data. */
 uint32_t tlv_delete_app_data(uint32_t tag);
 
+/* Function to initialize the app data arena on the application provided memory. */
+uint32_t tlv_app_data_arena_init(uint8_t * p_arena_buffer, uint32_t arena_size);
+
+/* Function to reset the app data arena, all the app data (and TLV objects) of the message are released at once. */
+uint32_t tlv_app_data_arena_reset(void_t);
+
+/* Function to mark the app data changed (dirty), the app data is encoded with the next tlv_encode_dirty_app_data(). */
+uint32_t tlv_mark_app_data_dirty(uint32_t app_data_tag);
+
+/* Function to mark the child app data of the container changed (dirty). */
+uint32_t tlv_mark_child_app_data_dirty(uint32_t container_app_data_tag, uint32_t child_app_data_tag);
+
+/* Function to set the value of the app data (copied to the application variable) and mark the app data dirty. */
+uint32_t tlv_set_app_data(uint32_t app_data_tag, const uint8_t * p_value, uint32_t value_size);
+
+/* Function to encode the dirty app data of the tag (and dirty child app data of a container), clean app data is not encoded again. */
+uint32_t tlv_encode_dirty_app_data(uint32_t app_data_tag);
+
+/* Function to set the lazy decode of the parsed app data (value decoded on the first access). */
+uint32_t tlv_set_lazy_decode(bool_t b_lazy_decode);
+
+/* Function to decode the parsed app data (and the child app data of a container) not decoded yet into the application variable. */
+uint32_t tlv_decode_app_data(uint32_t app_data_tag);
+
+/* Function to build the send vector of the app data (send vector entries point at the encoded octets of the TLV objects). */
+uint32_t tlv_app_data_build_send_vector(uint32_t tag, tlv_send_vector_t * p_send_vector, uint32_t max_vector_count, uint32_t * p_vector_count);
+
+/* Function to send the app data to the file descriptor with writev(). */
+uint32_t tlv_app_data_send_fd(uint32_t tag, int32_t fd, uint32_t * p_sent_length);
+
+/* Initialize the TLV context (tag to app data map of the context is cleared). */
+void_t tlv_context_initialize(tlv_context_t * p_tlv_context);
+
+/* Function to initialize and create TLV object of the app data with definite size in the TLV context. */
+uint32_t tlv_init_and_create_app_data_in_context(tlv_context_t * p_tlv_context, uint8_t * p_app_data_buffer, uint32_t app_data_size, uint32_t app_data_tag);
+
+/* Function to create constructed container TLV object of the app data with indefinite size in the TLV context. */
+uint32_t tlv_create_container_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag);
+
+/* Function to create TLV object of the app data and add to container (parent) TLV object as a child in the TLV context. */
+uint32_t tlv_add_child_to_container_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint8_t * p_app_data_buffer,
+    uint32_t app_data_size, uint32_t child_app_data_tag);
+
+/* Function to add created child TLV object to container (parent) TLV object in the TLV context. */
+uint32_t tlv_add_child_tag_to_container_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag);
+
+/* Function to add data to TLV objects with definite size in the TLV context. */
+uint32_t tlv_add_data_to_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag);
+
+/* Function to add data to constructed container TLV objects with indefinite size in the TLV context. */
+uint32_t tlv_add_data_to_container_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag);
+
+/* Function to send application data of the TLV context. */
+uint32_t tlv_app_data_send_in_context(tlv_context_t * p_tlv_context, uint32_t tag);
+
+/* Function to parse app data of the TLV context from TLV data buffer (first found TLV object is parsed.) */
+uint32_t tlv_parse_app_data_in_context(tlv_context_t * p_tlv_context, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t * p_parsed_tag);
+
+/* Function to search tag and parse the TLV data buffer into the app data of the TLV context. */
+uint32_t tlv_search_parse_app_data_in_context(tlv_context_t * p_tlv_context, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length,
+    uint32_t search_parse_tag, bool_t b_recursive);
+
+/* Function to delete a TLV object and removes the mapping between the TLV object and the app data in the TLV context. */
+uint32_t tlv_delete_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t tag);
+
+/* Function to initialize the app data arena of the TLV context on the application provided memory. */
+uint32_t tlv_app_data_arena_init_in_context(tlv_context_t * p_tlv_context, uint8_t * p_arena_buffer, uint32_t arena_size);
+
+/* Function to reset the app data arena of the TLV context. */
+uint32_t tlv_app_data_arena_reset_in_context(tlv_context_t * p_tlv_context);
+
+/* Function to mark the app data of the TLV context changed (dirty). */
+uint32_t tlv_mark_app_data_dirty_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag);
+
+/* Function to mark the child app data of the container in the TLV context changed (dirty). */
+uint32_t tlv_mark_child_app_data_dirty_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag);
+
+/* Function to set the value of the app data of the TLV context and mark the app data dirty. */
+uint32_t tlv_set_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag, const uint8_t * p_value, uint32_t value_size);
+
+/* Function to encode the dirty app data of the tag in the TLV context. */
+uint32_t tlv_encode_dirty_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag);
+
+/* Function to set the lazy decode of the parsed app data of the TLV context. */
+uint32_t tlv_set_lazy_decode_in_context(tlv_context_t * p_tlv_context, bool_t b_lazy_decode);
+
+/* Function to decode the parsed app data of the TLV context not decoded yet into the application variable. */
+uint32_t tlv_decode_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag);
+
+/* Function to build the send vector of the app data of the TLV context. */
+uint32_t tlv_app_data_build_send_vector_in_context(tlv_context_t * p_tlv_context, uint32_t tag, tlv_send_vector_t * p_send_vector,
+    uint32_t max_vector_count, uint32_t * p_vector_count);
+
+/* Function to send the app data of the TLV context to the file descriptor with writev(). */
+uint32_t tlv_app_data_send_fd_in_context(tlv_context_t * p_tlv_context, uint32_t tag, int32_t fd, uint32_t * p_sent_length);
+
 
 /* Error check for function to initialize and create TLV object of the app data with definite size. */
 uint32_t tlv_init_and_create_app_data_ec(uint8_t * p_app_data_buffer, uint32_t app_data_size, uint32_t app_data_tag);
@@ -120,4 +229,97 @@ uint32_t tlv_search_parse_app_data_ec(const uint8_t * p_tlv_data_buffer, uint32_
 /* Error check for function to delete a TLV object. */
 uint32_t tlv_delete_app_data_ec(uint32_t tag);
 
+/* Error check for function to initialize the app data arena. */
+uint32_t tlv_app_data_arena_init_ec(uint8_t * p_arena_buffer, uint32_t arena_size);
+
+/* Error check for function to reset the app data arena. */
+uint32_t tlv_app_data_arena_reset_ec(void_t);
+
+/* Error check for function to initialize and create TLV object of the app data with definite size in the TLV context. */
+uint32_t tlv_init_and_create_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint8_t * p_app_data_buffer, uint32_t app_data_size, uint32_t app_data_tag);
+
+/* Error check for function to create constructed container TLV object of the app data with indefinite size in the TLV context. */
+uint32_t tlv_create_container_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag);
+
+/* Error check for function to create TLV object of the app data and add to container (parent) TLV object as a child in the TLV context. */
+uint32_t tlv_add_child_to_container_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint8_t * p_app_data_buffer,
+    uint32_t app_data_size, uint32_t child_app_data_tag);
+
+/* Error check for function to add created child TLV object to container (parent) TLV object in the TLV context. */
+uint32_t tlv_add_child_tag_to_container_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag);
+
+/* Error check for function to add data to TLV objects with definite size in the TLV context. */
+uint32_t tlv_add_data_to_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t app_data_tag);
+
+/* Error check for function to add data to constructed container TLV objects with indefinite size in the TLV context. */
+uint32_t tlv_add_data_to_container_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag);
+
+/* Error check for function to send application data of the TLV context. */
+uint32_t tlv_app_data_send_in_context_ec(tlv_context_t * p_tlv_context, uint32_t tag);
+
+/* Error check for function to parse app data of the TLV context from TLV data buffer. */
+uint32_t tlv_parse_app_data_in_context_ec(tlv_context_t * p_tlv_context, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t * p_parsed_tag);
+
+/* Error check for function to search tag and parse the TLV data buffer into the app data of the TLV context. */
+uint32_t tlv_search_parse_app_data_in_context_ec(tlv_context_t * p_tlv_context, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length,
+    uint32_t search_parse_tag, bool_t b_recursive);
+
+/* Error check for function to delete a TLV object in the TLV context. */
+uint32_t tlv_delete_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t tag);
+
+/* Error check for function to initialize the app data arena of the TLV context. */
+uint32_t tlv_app_data_arena_init_in_context_ec(tlv_context_t * p_tlv_context, uint8_t * p_arena_buffer, uint32_t arena_size);
+
+/* Error check for function to reset the app data arena of the TLV context. */
+uint32_t tlv_app_data_arena_reset_in_context_ec(tlv_context_t * p_tlv_context);
+
+/* Error check for function to mark the app data changed (dirty). */
+uint32_t tlv_mark_app_data_dirty_ec(uint32_t app_data_tag);
+
+/* Error check for function to mark the child app data of the container changed (dirty). */
+uint32_t tlv_mark_child_app_data_dirty_ec(uint32_t container_app_data_tag, uint32_t child_app_data_tag);
+
+/* Error check for function to set the value of the app data. */
+uint32_t tlv_set_app_data_ec(uint32_t app_data_tag, const uint8_t * p_value, uint32_t value_size);
+
+/* Error check for function to encode the dirty app data. */
+uint32_t tlv_encode_dirty_app_data_ec(uint32_t app_data_tag);
+
+/* Error check for function to set the lazy decode of the parsed app data. */
+uint32_t tlv_set_lazy_decode_ec(bool_t b_lazy_decode);
+
+/* Error check for function to decode the parsed app data not decoded yet. */
+uint32_t tlv_decode_app_data_ec(uint32_t app_data_tag);
+
+/* Error check for function to mark the app data of the TLV context changed (dirty). */
+uint32_t tlv_mark_app_data_dirty_in_context_ec(tlv_context_t * p_tlv_context, uint32_t app_data_tag);
+
+/* Error check for function to mark the child app data of the container in the TLV context changed (dirty). */
+uint32_t tlv_mark_child_app_data_dirty_in_context_ec(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag);
+
+/* Error check for function to set the value of the app data of the TLV context. */
+uint32_t tlv_set_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t app_data_tag, const uint8_t * p_value, uint32_t value_size);
+
+/* Error check for function to encode the dirty app data of the TLV context. */
+uint32_t tlv_encode_dirty_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t app_data_tag);
+
+/* Error check for function to set the lazy decode of the parsed app data of the TLV context. */
+uint32_t tlv_set_lazy_decode_in_context_ec(tlv_context_t * p_tlv_context, bool_t b_lazy_decode);
+
+/* Error check for function to decode the parsed app data of the TLV context not decoded yet. */
+uint32_t tlv_decode_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t app_data_tag);
+
+/* Error check for function to build the send vector of the app data. */
+uint32_t tlv_app_data_build_send_vector_ec(uint32_t tag, tlv_send_vector_t * p_send_vector, uint32_t max_vector_count, uint32_t * p_vector_count);
+
+/* Error check for function to send the app data to the file descriptor. */
+uint32_t tlv_app_data_send_fd_ec(uint32_t tag, int32_t fd, uint32_t * p_sent_length);
+
+/* Error check for function to build the send vector of the app data of the TLV context. */
+uint32_t tlv_app_data_build_send_vector_in_context_ec(tlv_context_t * p_tlv_context, uint32_t tag, tlv_send_vector_t * p_send_vector,
+    uint32_t max_vector_count, uint32_t * p_vector_count);
+
+/* Error check for function to send the app data of the TLV context to the file descriptor. */
+uint32_t tlv_app_data_send_fd_in_context_ec(tlv_context_t * p_tlv_context, uint32_t tag, int32_t fd, uint32_t * p_sent_length);
+
 #endif /* __TLV_APP_DATA_H__ */
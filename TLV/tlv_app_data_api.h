@@ -70,11 +70,89 @@ typedef uint32_t                  TLV_STATUS;
 #define TLV_NO_TAG_FOUND           0x11U
 #define TLV_OBJECT_INVALID_PTR     0x12U
 #define TLV_BAD_TAG                0x13U
+#define TLV_CONTAINER_OPEN         0x14U
+#define TLV_MAX_CONTAINER_DEPTH    0x15U
+#define TLV_SEND_VECTOR_FULL       0x16U
+#define TLV_SEND_FAILED            0x17U
+#define TLV_FRAME_INCOMPLETE       0x18U
+#define TLV_ALLOCATOR_IN_USE       0x19U
 
 
 #define TLV_FAIL                   0xFFFFFFFFU
 
 
+#ifndef __TLV_API_H__
+/* Alignment (in octets) of the memory allocated from the TLV arena. */
+#define TLV_ARENA_ALIGNMENT        8U
+
+/* This is a TLV Arena (same as tlv_api.h), the app data arena of the TLV context. All members are internal to the TLV arena. */
+typedef struct tlv_arena
+{
+    /* Arena memory, its size and the number of allocated octets. */
+    uint8_t             * p_arena_buffer;
+    uint32_t              arena_size;
+    uint32_t              arena_used_size;
+
+} tlv_arena_t;
+
+/* TLV data segment and TLV frame reader (same as tlv_api.h), the TLV frame reader finds a complete TLV message in the received TLV data. */
+typedef struct tlv_data_segment
+{
+    const uint8_t       * p_tlv_data;
+    uint32_t              data_length;
+
+} tlv_data_segment_t;
+
+typedef struct tlv_frame_reader
+{
+    uint32_t              checked_length;
+    uint32_t              container_depth;
+    uint32_t              max_message_length;
+
+} tlv_frame_reader_t;
+#endif /* __TLV_API_H__ */
+
+/*
+ * This is a TLV Context, it owns the tag to app data map and the app data arena of the app data layer.
+ * Each thread (or each message schema instance) can use its own TLV context, app data functions of different
+ * TLV contexts can be called in parallel without locks. All members are internal to the app data layer.
+ */
+typedef struct tlv_context
+{
+    /* A simple tag to app data map using array (no hashing) and map initialized. */
+    struct tlv_app_data * tag_to_app_data_map[TAG_MAX];
+    bool_t                b_tlv_app_data_map_initialized;
+
+    /* App data arena, if initialized app data and TLV objects are allocated from the arena (NULL, allocated from heap). */
+    tlv_arena_t           tlv_app_data_arena;
+    tlv_arena_t         * p_tlv_app_data_arena;
+
+    /* Lazy decode, parsed app data is decoded into the application variable on the first access. */
+    bool_t                b_lazy_decode;
+
+} tlv_context_t;
+
+/*
+ * Send vector entry, points at the encoded octets of an app data TLV object (no copy). The send vector entries are struct iovec
+ * of writev() if TLV_SEND_WRITEV is set in tlv_port.h.
+ */
+#if (0 < TLV_SEND_WRITEV)
+typedef struct iovec tlv_send_vector_t;
+#else
+typedef struct tlv_send_vector
+{
+    void_t              * iov_base;
+    size_t                iov_len;
+
+} tlv_send_vector_t;
+#endif /* TLV_SEND_WRITEV */
+
+/* Maximum send vector entries of one tlv_app_data_send_fd() (a container takes an entry for the header and the end of contents octets). */
+#ifndef TLV_SEND_MAX_VECTOR_COUNT
+#define TLV_SEND_MAX_VECTOR_COUNT  64U
+#endif /* TLV_SEND_MAX_VECTOR_COUNT */
+
+
 /*
  * Defines the TLV app data api mapping based on error checking selected by the user.
  * This section is only applicable to the application that is using the TLV app data api.
@@ -104,6 +182,44 @@ typedef uint32_t                  TLV_STATUS;
 #define tlv_parse_app_data                      tlv_parse_app_data
 #define tlv_search_parse_app_data               tlv_search_parse_app_data
 #define tlv_delete_app_data                     tlv_delete_app_data
+#define tlv_app_data_arena_init                 tlv_app_data_arena_init
+#define tlv_app_data_arena_reset                tlv_app_data_arena_reset
+#define tlv_context_initialize                  tlv_context_initialize
+#define tlv_init_and_create_app_data_in_context tlv_init_and_create_app_data_in_context
+#define tlv_create_container_app_data_in_context tlv_create_container_app_data_in_context
+#define tlv_add_child_to_container_app_data_in_context tlv_add_child_to_container_app_data_in_context
+#define tlv_add_data_to_app_data_in_context     tlv_add_data_to_app_data_in_context
+#define tlv_add_data_to_container_app_data_in_context tlv_add_data_to_container_app_data_in_context
+#define tlv_add_child_tag_to_container_app_data_in_context tlv_add_child_tag_to_container_app_data_in_context
+#define tlv_app_data_send_in_context            tlv_app_data_send_in_context
+#define tlv_parse_app_data_in_context           tlv_parse_app_data_in_context
+#define tlv_search_parse_app_data_in_context    tlv_search_parse_app_data_in_context
+#define tlv_delete_app_data_in_context          tlv_delete_app_data_in_context
+#define tlv_app_data_arena_init_in_context      tlv_app_data_arena_init_in_context
+#define tlv_app_data_arena_reset_in_context     tlv_app_data_arena_reset_in_context
+#define tlv_mark_app_data_dirty                 tlv_mark_app_data_dirty
+#define tlv_mark_child_app_data_dirty           tlv_mark_child_app_data_dirty
+#define tlv_set_app_data                        tlv_set_app_data
+#define tlv_encode_dirty_app_data               tlv_encode_dirty_app_data
+#define tlv_set_lazy_decode                     tlv_set_lazy_decode
+#define tlv_decode_app_data                     tlv_decode_app_data
+#define tlv_mark_app_data_dirty_in_context      tlv_mark_app_data_dirty_in_context
+#define tlv_mark_child_app_data_dirty_in_context tlv_mark_child_app_data_dirty_in_context
+#define tlv_set_app_data_in_context             tlv_set_app_data_in_context
+#define tlv_encode_dirty_app_data_in_context    tlv_encode_dirty_app_data_in_context
+#define tlv_set_lazy_decode_in_context          tlv_set_lazy_decode_in_context
+#define tlv_decode_app_data_in_context          tlv_decode_app_data_in_context
+#define tlv_app_data_build_send_vector          tlv_app_data_build_send_vector
+#define tlv_app_data_send_fd                    tlv_app_data_send_fd
+#define tlv_app_data_build_send_vector_in_context tlv_app_data_build_send_vector_in_context
+#define tlv_app_data_send_fd_in_context         tlv_app_data_send_fd_in_context
+#define tlv_frame_reader_init                   tlv_frame_reader_init
+#define tlv_frame_reader_check                  tlv_frame_reader_check
+#define tlv_frame_reader_reset                  tlv_frame_reader_reset
+#define tlv_set_allocator                       tlv_set_allocator
+#define tlv_get_allocator                       tlv_get_allocator
+#define tlv_counting_allocator_init             tlv_counting_allocator_init
+#define tlv_counting_allocator_reset            tlv_counting_allocator_reset
 
 #else
 
@@ -120,6 +236,44 @@ typedef uint32_t                  TLV_STATUS;
 #define tlv_parse_app_data                      tlv_parse_app_data_ec
 #define tlv_search_parse_app_data               tlv_search_parse_app_data_ec
 #define tlv_delete_app_data                     tlv_delete_app_data_ec
+#define tlv_app_data_arena_init                 tlv_app_data_arena_init_ec
+#define tlv_app_data_arena_reset                tlv_app_data_arena_reset_ec
+#define tlv_context_initialize                  tlv_context_initialize
+#define tlv_init_and_create_app_data_in_context tlv_init_and_create_app_data_in_context_ec
+#define tlv_create_container_app_data_in_context tlv_create_container_app_data_in_context_ec
+#define tlv_add_child_to_container_app_data_in_context tlv_add_child_to_container_app_data_in_context_ec
+#define tlv_add_data_to_app_data_in_context     tlv_add_data_to_app_data_in_context_ec
+#define tlv_add_data_to_container_app_data_in_context tlv_add_data_to_container_app_data_in_context_ec
+#define tlv_add_child_tag_to_container_app_data_in_context tlv_add_child_tag_to_container_app_data_in_context_ec
+#define tlv_app_data_send_in_context            tlv_app_data_send_in_context_ec
+#define tlv_parse_app_data_in_context           tlv_parse_app_data_in_context_ec
+#define tlv_search_parse_app_data_in_context    tlv_search_parse_app_data_in_context_ec
+#define tlv_delete_app_data_in_context          tlv_delete_app_data_in_context_ec
+#define tlv_app_data_arena_init_in_context      tlv_app_data_arena_init_in_context_ec
+#define tlv_app_data_arena_reset_in_context     tlv_app_data_arena_reset_in_context_ec
+#define tlv_mark_app_data_dirty                 tlv_mark_app_data_dirty_ec
+#define tlv_mark_child_app_data_dirty           tlv_mark_child_app_data_dirty_ec
+#define tlv_set_app_data                        tlv_set_app_data_ec
+#define tlv_encode_dirty_app_data               tlv_encode_dirty_app_data_ec
+#define tlv_set_lazy_decode                     tlv_set_lazy_decode_ec
+#define tlv_decode_app_data                     tlv_decode_app_data_ec
+#define tlv_mark_app_data_dirty_in_context      tlv_mark_app_data_dirty_in_context_ec
+#define tlv_mark_child_app_data_dirty_in_context tlv_mark_child_app_data_dirty_in_context_ec
+#define tlv_set_app_data_in_context             tlv_set_app_data_in_context_ec
+#define tlv_encode_dirty_app_data_in_context    tlv_encode_dirty_app_data_in_context_ec
+#define tlv_set_lazy_decode_in_context          tlv_set_lazy_decode_in_context_ec
+#define tlv_decode_app_data_in_context          tlv_decode_app_data_in_context_ec
+#define tlv_app_data_build_send_vector          tlv_app_data_build_send_vector_ec
+#define tlv_app_data_send_fd                    tlv_app_data_send_fd_ec
+#define tlv_app_data_build_send_vector_in_context tlv_app_data_build_send_vector_in_context_ec
+#define tlv_app_data_send_fd_in_context         tlv_app_data_send_fd_in_context_ec
+#define tlv_frame_reader_init                   tlv_frame_reader_init_ec
+#define tlv_frame_reader_check                  tlv_frame_reader_check_ec
+#define tlv_frame_reader_reset                  tlv_frame_reader_reset_ec
+#define tlv_set_allocator                       tlv_set_allocator_ec
+#define tlv_get_allocator                       tlv_get_allocator
+#define tlv_counting_allocator_init             tlv_counting_allocator_init_ec
+#define tlv_counting_allocator_reset            tlv_counting_allocator_reset_ec
 
 #endif /* DISABLE_ERROR_CHECK */
 
@@ -165,6 +319,8 @@ uint32_t tlv_parse_app_data(const uint8_t * p_tlv_data_buffer, uint32_t buffer_l
 /* 
  * - Function to search tag and parse the TLV data buffer (if recursive set to true, then search for child).
  * - The searched and parsed TLV object data will be auto updated to the application variables.
+ * - An integer TLV object with 0 value octets or more value octets than the application variable (or MAX_INTEGER_BYTES) returns
+ *   TLV_BAD_DATA_SIZE, such a child integer TLV object of a container is not decoded (0 in the application variable).
  */
 uint32_t tlv_search_parse_app_data(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t search_parse_tag, bool_t b_recursive);
 
@@ -176,6 +332,205 @@ uint32_t tlv_search_parse_app_data(const uint8_t * p_tlv_data_buffer, uint32_t b
  */
 uint32_t tlv_delete_app_data(uint32_t tag);
 
+/*
+ * - Function to initialize the app data arena on the application provided memory (optional).
+ * - App data and TLV objects created after this call are allocated from the app data arena instead of calloc per app data.
+ * - If the app data arena is full the create app data functions return TLV_NO_MEMORY.
+ * - Returns TLV_TAG_CREATED if app data is created already, app data allocated from heap is not released by the app data arena reset
+ * (initialize the app data arena before the app data is created, or use another TLV context).
+ */
+uint32_t tlv_app_data_arena_init(uint8_t * p_arena_buffer, uint32_t arena_size);
+
+/*
+ * - Function to reset the app data arena, all the app data (and TLV objects) of the message are released at once.
+ * - The app data map is cleared, the application creates the app data again for the next message.
+ * - Returns TLV_NOT_INITIALIZED if the app data arena is not initialized.
+ */
+uint32_t tlv_app_data_arena_reset(void_t);
+
+/*
+ * - Function to mark the app data changed (dirty) after the application variable is written, the container app data of the
+ * app data are marked dirty too.
+ * - The dirty app data is encoded with the next tlv_encode_dirty_app_data() or tlv_app_data_send() of its container.
+ */
+uint32_t tlv_mark_app_data_dirty(uint32_t app_data_tag);
+
+/*
+ * - Function to mark the child app data of the container changed (dirty), used for the child app data added with
+ * tlv_add_child_to_container_app_data() (all the child app data of the tag in the container are marked).
+ */
+uint32_t tlv_mark_child_app_data_dirty(uint32_t container_app_data_tag, uint32_t child_app_data_tag);
+
+/*
+ * - Function to set the value of the app data, the value is copied to the application variable (value size up to the app data size)
+ * and the app data is marked dirty.
+ * NOTE: Only the app data in the app data map (created with tlv_init_and_create_app_data() or tlv_create_container_app_data()) can be set.
+ * The child app data added with tlv_add_child_to_container_app_data() is not in the app data map (its universal tag can be of more than
+ * one child) and returns TLV_TAG_NOT_CREATED, the application writes the child application variable and calls tlv_mark_child_app_data_dirty().
+ */
+uint32_t tlv_set_app_data(uint32_t app_data_tag, const uint8_t * p_value, uint32_t value_size);
+
+/*
+ * - Function to encode the dirty app data of the tag, a container app data encodes only its dirty child app data.
+ * - Clean app data keeps its encoded TLV object, encoding a message with few changed fields costs only the changed fields.
+ * - tlv_app_data_send() encodes the dirty app data of the sent tag first.
+ */
+uint32_t tlv_encode_dirty_app_data(uint32_t app_data_tag);
+
+/*
+ * - Function to set the lazy decode of the parsed app data (default FALSE, the parsed value is decoded into the application
+ * variable by tlv_parse_app_data() and tlv_search_parse_app_data()).
+ * - With lazy decode the parse keeps only the tag, length and value location of the TLV object. The value is decoded (integer
+ * sign extension, value octets copy) on the first tlv_decode_app_data() of the tag, app data never accessed is not decoded.
+ * - A container found by tlv_search_parse_app_data() keeps the location of each of its child TLV objects (searched in order, same as
+ * without lazy decode), tlv_decode_app_data() of the container decodes them.
+ * - Note: With lazy decode the TLV data buffer must be valid and not modified until the parsed app data is decoded.
+ */
+uint32_t tlv_set_lazy_decode(bool_t b_lazy_decode);
+
+/*
+ * - Function to decode the parsed app data into the application variable, call before reading the application variable
+ * with lazy decode. A container app data decodes all its child app data.
+ * - App data already decoded is not decoded again (and not overwritten).
+ */
+uint32_t tlv_decode_app_data(uint32_t app_data_tag);
+
+/*
+ * - Function to build the send vector of the app data, the send vector entries point at the encoded octets of the TLV objects
+ * (tag and length octets of the containers, each child TLV object and the end of contents octets) without a copy.
+ * - The dirty app data is encoded first. The send vector is valid until the app data is encoded again or deleted.
+ * - Returns TLV_SEND_VECTOR_FULL if the app data needs more than max_vector_count send vector entries.
+ */
+uint32_t tlv_app_data_build_send_vector(uint32_t tag, tlv_send_vector_t * p_send_vector, uint32_t max_vector_count, uint32_t * p_vector_count);
+
+/*
+ * - Function to send the app data to the file descriptor (socket, pipe or file), the send vector of the app data is written with
+ * writev() (one system call for the message, the encoded TLV objects are not copied into a message buffer).
+ * - A partial write is continued until the message is written, returns TLV_SEND_FAILED if writev() fails.
+ * - p_sent_length is the number of octets written, on TLV_SEND_FAILED the octets of the message already written (e.g. writev()
+ * of a non-blocking file descriptor fails with EAGAIN after a partial write), the rest of the message is not sent.
+ */
+uint32_t tlv_app_data_send_fd(uint32_t tag, int32_t fd, uint32_t * p_sent_length);
+
+/*
+ * TLV context app data functions, same as the app data functions above but on the application provided TLV context
+ * (the app data functions above use the default TLV context).
+ * - Each thread can encode and decode with its own TLV context in parallel, no lock is taken.
+ * - App data of a TLV context must not be used with another TLV context.
+ */
+
+/*
+ * Initialize the TLV context, application must call this function before accessing any other app data API with the TLV context.
+ * The app data arena of the TLV context (optional) is initialized after the TLV context.
+ */
+void_t tlv_context_initialize(tlv_context_t * p_tlv_context);
+
+/* Function to initialize and create TLV object of the app data with definite size in the TLV context. */
+uint32_t tlv_init_and_create_app_data_in_context(tlv_context_t * p_tlv_context, uint8_t * p_app_data_buffer, uint32_t app_data_size, uint32_t app_data_tag);
+
+/* Function to create constructed container TLV object of the app data with indefinite size in the TLV context. */
+uint32_t tlv_create_container_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag);
+
+/* Function to create TLV object of the app data and add to container (parent) TLV object as a child in the TLV context. */
+uint32_t tlv_add_child_to_container_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint8_t * p_app_data_buffer,
+    uint32_t app_data_size, uint32_t child_app_data_tag);
+
+/* Function to add created child TLV object to container (parent) TLV object in the TLV context. */
+uint32_t tlv_add_child_tag_to_container_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag);
+
+/* Function to add data to constructed and primitive TLV objects with definite size in the TLV context. */
+uint32_t tlv_add_data_to_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag);
+
+/* Function to add data to constructed container TLV objects with indefinite size in the TLV context. */
+uint32_t tlv_add_data_to_container_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag);
+
+/* Function to send application data of the TLV context. */
+uint32_t tlv_app_data_send_in_context(tlv_context_t * p_tlv_context, uint32_t tag);
+
+/* Function to parse app data of the TLV context from TLV data buffer (first found TLV object is parsed.) */
+uint32_t tlv_parse_app_data_in_context(tlv_context_t * p_tlv_context, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t * p_parsed_tag);
+
+/* Function to search tag and parse the TLV data buffer into the app data of the TLV context (if recursive set to true, then search for child). */
+uint32_t tlv_search_parse_app_data_in_context(tlv_context_t * p_tlv_context, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length,
+    uint32_t search_parse_tag, bool_t b_recursive);
+
+/* Function to delete a TLV object and removes the mapping between the TLV object and the app data in the TLV context. */
+uint32_t tlv_delete_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t tag);
+
+/* Function to initialize the app data arena of the TLV context on the application provided memory (optional). */
+uint32_t tlv_app_data_arena_init_in_context(tlv_context_t * p_tlv_context, uint8_t * p_arena_buffer, uint32_t arena_size);
+
+/* Function to reset the app data arena of the TLV context, the app data map of the TLV context is cleared. */
+uint32_t tlv_app_data_arena_reset_in_context(tlv_context_t * p_tlv_context);
+
+/* Function to mark the app data of the TLV context changed (dirty). */
+uint32_t tlv_mark_app_data_dirty_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag);
+
+/* Function to mark the child app data of the container in the TLV context changed (dirty). */
+uint32_t tlv_mark_child_app_data_dirty_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag);
+
+/* Function to set the value of the app data of the TLV context and mark the app data dirty. */
+uint32_t tlv_set_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag, const uint8_t * p_value, uint32_t value_size);
+
+/* Function to encode the dirty app data of the tag in the TLV context. */
+uint32_t tlv_encode_dirty_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag);
+
+/* Function to set the lazy decode of the parsed app data of the TLV context. */
+uint32_t tlv_set_lazy_decode_in_context(tlv_context_t * p_tlv_context, bool_t b_lazy_decode);
+
+/* Function to decode the parsed app data of the TLV context not decoded yet into the application variable. */
+uint32_t tlv_decode_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag);
+
+/* Function to build the send vector of the app data of the TLV context. */
+uint32_t tlv_app_data_build_send_vector_in_context(tlv_context_t * p_tlv_context, uint32_t tag, tlv_send_vector_t * p_send_vector,
+    uint32_t max_vector_count, uint32_t * p_vector_count);
+
+/* Function to send the app data of the TLV context to the file descriptor with writev(). */
+uint32_t tlv_app_data_send_fd_in_context(tlv_context_t * p_tlv_context, uint32_t tag, int32_t fd, uint32_t * p_sent_length);
+
+/*
+ * TLV frame reader functions (same as tlv_api.h), to find a complete TLV message in the received TLV data (e.g. the unread octets
+ * of a ring buffer) before it is parsed with tlv_parse_app_data() or tlv_search_parse_app_data().
+ */
+
+/* Function to initialize the TLV frame reader, TLV messages longer than max message length (e.g. the ring buffer size) are not valid. */
+uint32_t tlv_frame_reader_init(tlv_frame_reader_t * p_tlv_frame_reader, uint32_t max_message_length);
+
+/*
+ * - Function to check if a complete top level TLV message is received, the TLV data segments are the received TLV data in place
+ * (e.g. the unread octets of a ring buffer, up to two segments) and start with the TLV message.
+ * - Returns TLV_SUCCESS and the TLV message length if the TLV message is complete, TLV_FRAME_INCOMPLETE if more TLV data is required
+ * (check again with the same TLV data and the TLV data received after it) or an error if the TLV data does not start with a valid TLV message.
+ */
+uint32_t tlv_frame_reader_check(tlv_frame_reader_t * p_tlv_frame_reader, const tlv_data_segment_t * p_tlv_data_segments, uint32_t segment_count,
+    uint32_t * p_message_length);
+
+/* Function to reset the TLV frame reader, the partially checked TLV message is discarded. */
+uint32_t tlv_frame_reader_reset(tlv_frame_reader_t * p_tlv_frame_reader);
+
+/*
+ * TLV allocator functions (same as tlv_api.h), the app data and TLV objects not allocated from the app data arena are
+ * allocated and freed with the TLV allocator.
+ */
+
+/*
+ * Function to set the TLV allocator of the TLV module heap memory (NULL, calloc and free). Memory is freed with the TLV allocator
+ * it is allocated with, set the TLV allocator before any TLV object or app data is allocated from heap (not thread safe).
+ */
+uint32_t tlv_set_allocator(const tlv_allocator_t * p_tlv_allocator);
+
+/* Function to get the TLV allocator set with tlv_set_allocator() (calloc and free by default). */
+const tlv_allocator_t * tlv_get_allocator(void_t);
+
+/*
+ * Function to initialize the TLV counting allocator on the backing TLV allocator (NULL, calloc and free), set
+ * &tlv_counting_allocator.tlv_allocator with tlv_set_allocator() to count the allocations and allocated octets per operation.
+ */
+uint32_t tlv_counting_allocator_init(tlv_counting_allocator_t * p_tlv_counting_allocator, const tlv_allocator_t * p_backing_allocator);
+
+/* Function to reset the counts of the TLV counting allocator. */
+uint32_t tlv_counting_allocator_reset(tlv_counting_allocator_t * p_tlv_counting_allocator);
+
 #endif /* TLV_SOURCE_CODE */
 
 #endif /* __TLV_APP_DATA_API_H__ */
@@ -15,15 +15,105 @@
 #include "tlv_app_data_tag_check.h"
 #include "error_assert.h"
 
-extern tlv_app_data_t * tag_to_app_data_map[TAG_MAX];
-extern bool_t b_tlv_app_data_map_initialized;
+extern tlv_context_t tlv_default_context;
 
 /* Error check for function to initialize and create TLV object of the app data with definite size. */
 uint32_t tlv_init_and_create_app_data_ec(uint8_t * p_app_data_buffer, uint32_t app_data_size, uint32_t app_data_tag)
 {
+    return tlv_init_and_create_app_data_in_context_ec(&tlv_default_context, p_app_data_buffer, app_data_size, app_data_tag);
+}
+
+/* Error check for function to create constructed container TLV object of the app data with indefinite size. */
+uint32_t tlv_create_container_app_data_ec(uint32_t container_app_data_tag)
+{
+    return tlv_create_container_app_data_in_context_ec(&tlv_default_context, container_app_data_tag);
+}
+
+/* Error check for function to create TLV object of the app data and add to container (parent) TLV object as a child. */
+uint32_t tlv_add_child_to_container_app_data_ec(uint32_t container_app_data_tag, uint8_t * p_app_data_buffer, uint32_t app_data_size, uint32_t child_app_data_tag)
+{
+    return tlv_add_child_to_container_app_data_in_context_ec(&tlv_default_context, container_app_data_tag, p_app_data_buffer, app_data_size, child_app_data_tag);
+}
+
+/* Error Check for function to add child app data tag to container (parent) app data. */
+uint32_t tlv_add_child_tag_to_container_app_data_ec(uint32_t container_app_data_tag, uint32_t child_app_data_tag)
+{
+    return tlv_add_child_tag_to_container_app_data_in_context_ec(&tlv_default_context, container_app_data_tag, child_app_data_tag);
+}
+
+/* Error check for function to add data to TLV objects with definite size. */
+uint32_t tlv_add_data_to_app_data_ec(uint32_t app_data_tag)
+{
+    return tlv_add_data_to_app_data_in_context_ec(&tlv_default_context, app_data_tag);
+}
+
+/* Error check for function to add data to constructed container TLV objects with indefinite size. */
+uint32_t tlv_add_data_to_container_app_data_ec(uint32_t container_app_data_tag, uint32_t child_app_data_tag)
+{
+    return tlv_add_data_to_container_app_data_in_context_ec(&tlv_default_context, container_app_data_tag, child_app_data_tag);
+}
+
+/* Error check for function to send application data. */
+uint32_t tlv_app_data_send_ec(uint32_t tag)
+{
+    return tlv_app_data_send_in_context_ec(&tlv_default_context, tag);
+}
+
+/* Error check for function to build the send vector of the app data. */
+uint32_t tlv_app_data_build_send_vector_ec(uint32_t tag, tlv_send_vector_t * p_send_vector, uint32_t max_vector_count, uint32_t * p_vector_count)
+{
+    return tlv_app_data_build_send_vector_in_context_ec(&tlv_default_context, tag, p_send_vector, max_vector_count, p_vector_count);
+}
+
+/* Error check for function to send the app data to the file descriptor. */
+uint32_t tlv_app_data_send_fd_ec(uint32_t tag, int32_t fd, uint32_t * p_sent_length)
+{
+    return tlv_app_data_send_fd_in_context_ec(&tlv_default_context, tag, fd, p_sent_length);
+}
+
+/* Error check for function to parse app data from TLV data buffer (first found TLV object is parsed.) */
+uint32_t tlv_parse_app_data_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t * p_parsed_tag)
+{
+    return tlv_parse_app_data_in_context_ec(&tlv_default_context, p_tlv_data_buffer, buffer_length, p_parsed_tag);
+}
+
+/* Error check for function to search tag and parse the TLV data buffer (if recursive set to true, then search for child). */
+uint32_t tlv_search_parse_app_data_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t search_parse_tag, bool_t b_recursive)
+{
+    return tlv_search_parse_app_data_in_context_ec(&tlv_default_context, p_tlv_data_buffer, buffer_length, search_parse_tag, b_recursive);
+}
+
+/* Error check for function to delete a TLV object. */
+uint32_t tlv_delete_app_data_ec(uint32_t tag)
+{
+    return tlv_delete_app_data_in_context_ec(&tlv_default_context, tag);
+}
+
+/* Error check for function to initialize the app data arena. */
+uint32_t tlv_app_data_arena_init_ec(uint8_t * p_arena_buffer, uint32_t arena_size)
+{
+    return tlv_app_data_arena_init_in_context_ec(&tlv_default_context, p_arena_buffer, arena_size);
+}
+
+/* Error check for function to reset the app data arena. */
+uint32_t tlv_app_data_arena_reset_ec(void_t)
+{
+    return tlv_app_data_arena_reset_in_context_ec(&tlv_default_context);
+}
+
+/* Error check for function to initialize and create TLV object of the app data with definite size in the TLV context. */
+uint32_t tlv_init_and_create_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint8_t * p_app_data_buffer, uint32_t app_data_size, uint32_t app_data_tag)
+{
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
     /* Check if initialized before use. */
-    assert(!b_tlv_app_data_map_initialized);
-    if (!b_tlv_app_data_map_initialized)
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
     {
         return TLV_NOT_INITIALIZED;
     }
@@ -36,8 +126,8 @@ uint32_t tlv_init_and_create_app_data_ec(uint8_t * p_app_data_buffer, uint32_t a
     }
 
     /* Check if the TLV tag is created already. */
-    assert(tag_to_app_data_map[app_data_tag] != NULL);
-    if (tag_to_app_data_map[app_data_tag] != NULL)
+    assert(p_tlv_context->tag_to_app_data_map[app_data_tag] != NULL);
+    if (p_tlv_context->tag_to_app_data_map[app_data_tag] != NULL)
     {
         return TLV_TAG_CREATED;
     }
@@ -47,26 +137,33 @@ uint32_t tlv_init_and_create_app_data_ec(uint8_t * p_app_data_buffer, uint32_t a
     status = check_tag(app_data_tag, app_data_size);
     if (TLV_SUCCESS == status)
     {
-        status = tlv_init_and_create_app_data(p_app_data_buffer, app_data_size, app_data_tag);
+        status = tlv_init_and_create_app_data_in_context(p_tlv_context, p_app_data_buffer, app_data_size, app_data_tag);
     }
 
     /* Return status. */
     return status;
 }
 
-/* Error check for function to create TLV object of the app data and add to container (parent) TLV object as a child. */
-uint32_t tlv_create_container_app_data_ec(uint32_t container_app_data_tag)
+/* Error check for function to create TLV object of the app data and add to container (parent) TLV object as a child in the TLV context. */
+uint32_t tlv_create_container_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag)
 {
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
     /* Check if initialized before use. */
-    assert(!b_tlv_app_data_map_initialized);
-    if (!b_tlv_app_data_map_initialized)
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
     {
         return TLV_NOT_INITIALIZED;
     }
 
     /* Check if the TLV tag is created already. */
-    assert(tag_to_app_data_map[container_app_data_tag] != NULL);
-    if (tag_to_app_data_map[container_app_data_tag] != NULL)
+    assert(p_tlv_context->tag_to_app_data_map[container_app_data_tag] != NULL);
+    if (p_tlv_context->tag_to_app_data_map[container_app_data_tag] != NULL)
     {
         return TLV_TAG_CREATED;
     }
@@ -76,33 +173,41 @@ uint32_t tlv_create_container_app_data_ec(uint32_t container_app_data_tag)
     status = check_tag(container_app_data_tag, 0);
     if (TLV_SUCCESS == status)
     {
-        status = tlv_create_container_app_data(container_app_data_tag);
+        status = tlv_create_container_app_data_in_context(p_tlv_context, container_app_data_tag);
     }
 
     /* Return status. */
     return status;
 }
 
-/* Error check for function to add created child TLV object to container (parent) TLV object. */
-uint32_t tlv_add_child_to_container_app_data_ec(uint32_t container_app_data_tag, uint8_t * p_app_data_buffer, uint32_t app_data_size, uint32_t child_app_data_tag)
+/* Error check for function to add created child TLV object to container (parent) TLV object in the TLV context. */
+uint32_t tlv_add_child_to_container_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint8_t * p_app_data_buffer,
+    uint32_t app_data_size, uint32_t child_app_data_tag)
 {
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
     /* Check if initialized before use. */
-    assert(!b_tlv_app_data_map_initialized);
-    if (!b_tlv_app_data_map_initialized)
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
     {
         return TLV_NOT_INITIALIZED;
     }
 
     /* Check if the TLV container tag is not created already. */
-    assert(NULL == tag_to_app_data_map[container_app_data_tag]);
-    if (NULL == tag_to_app_data_map[container_app_data_tag])
+    assert(NULL == p_tlv_context->tag_to_app_data_map[container_app_data_tag]);
+    if (NULL == p_tlv_context->tag_to_app_data_map[container_app_data_tag])
     {
         return TLV_TAG_NOT_CREATED;
     }
 
     /* Check the tag is container type. */
-    assert(FALSE == (tag_to_app_data_map[container_app_data_tag])->b_container);
-    if(FALSE == (tag_to_app_data_map[container_app_data_tag])->b_container)
+    assert(FALSE == (p_tlv_context->tag_to_app_data_map[container_app_data_tag])->b_container);
+    if(FALSE == (p_tlv_context->tag_to_app_data_map[container_app_data_tag])->b_container)
     {
         return TLV_NOT_A_CONTAINER;
     }
@@ -115,7 +220,7 @@ uint32_t tlv_add_child_to_container_app_data_ec(uint32_t container_app_data_tag,
     }
 
     /* Check if container has max number of child added already. */
-    tlv_app_data_t * p_container_app_data = tag_to_app_data_map[container_app_data_tag];
+    tlv_app_data_t * p_container_app_data = p_tlv_context->tag_to_app_data_map[container_app_data_tag];
     assert(MAX_CONTAINER_CHILD_COUNT == p_container_app_data->u_size.child_count);
     if (MAX_CONTAINER_CHILD_COUNT == p_container_app_data->u_size.child_count)
     {
@@ -134,56 +239,63 @@ uint32_t tlv_add_child_to_container_app_data_ec(uint32_t container_app_data_tag,
     status = check_tag(child_app_data_tag, app_data_size);
     if (TLV_SUCCESS == status)
     {
-        status = tlv_add_child_to_container_app_data(container_app_data_tag, p_app_data_buffer, app_data_size, child_app_data_tag);
+        status = tlv_add_child_to_container_app_data_in_context(p_tlv_context, container_app_data_tag, p_app_data_buffer, app_data_size, child_app_data_tag);
     }
 
     /* Return status. */
     return status;
 }
 
-/* Error Check for function to add child app data tag to container (parent) app data. */
-uint32_t tlv_add_child_tag_to_container_app_data_ec(uint32_t container_app_data_tag, uint32_t child_app_data_tag)
+/* Error Check for function to add child app data tag to container (parent) app data in the TLV context. */
+uint32_t tlv_add_child_tag_to_container_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag)
 {
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
     /* Check if initialized before use. */
-    assert(!b_tlv_app_data_map_initialized);
-    if (!b_tlv_app_data_map_initialized)
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
     {
         return TLV_NOT_INITIALIZED;
     }
 
     /* Check if the TLV container tag is not created already. */
-    assert(NULL == tag_to_app_data_map[container_app_data_tag]);
-    if (NULL == tag_to_app_data_map[container_app_data_tag])
+    assert(NULL == p_tlv_context->tag_to_app_data_map[container_app_data_tag]);
+    if (NULL == p_tlv_context->tag_to_app_data_map[container_app_data_tag])
     {
         return TLV_TAG_NOT_CREATED;
     }
 
     /* Check the tag is container type. */
-    assert(FALSE == (tag_to_app_data_map[container_app_data_tag])->b_container);
-    if(FALSE == (tag_to_app_data_map[container_app_data_tag])->b_container)
+    assert(FALSE == (p_tlv_context->tag_to_app_data_map[container_app_data_tag])->b_container);
+    if(FALSE == (p_tlv_context->tag_to_app_data_map[container_app_data_tag])->b_container)
     {
         return TLV_NOT_A_CONTAINER;
     }
 
     /* Check if the TLV child tag is not created already. */
-    assert(NULL == tag_to_app_data_map[child_app_data_tag]);
-    if (NULL == tag_to_app_data_map[child_app_data_tag])
+    assert(NULL == p_tlv_context->tag_to_app_data_map[child_app_data_tag]);
+    if (NULL == p_tlv_context->tag_to_app_data_map[child_app_data_tag])
     {
         return TLV_TAG_NOT_CREATED;
     }
 
     /* Check is child already belongs to a container. */
-    assert(TRUE == (tag_to_app_data_map[child_app_data_tag])->b_has_parent);
-    if (TRUE == (tag_to_app_data_map[child_app_data_tag])->b_has_parent)
+    assert(TRUE == (p_tlv_context->tag_to_app_data_map[child_app_data_tag])->b_has_parent);
+    if (TRUE == (p_tlv_context->tag_to_app_data_map[child_app_data_tag])->b_has_parent)
     {
         return TLV_CHILD_HAS_PARENT;
     }
 
     /* Container (parent) cannot be added to its child. */
-    if (TRUE == (tag_to_app_data_map[container_app_data_tag])->b_has_parent)
+    if (TRUE == (p_tlv_context->tag_to_app_data_map[container_app_data_tag])->b_has_parent)
     {
-        assert(((tag_to_app_data_map[container_app_data_tag])->p_parent_app_data)->tag_number == child_app_data_tag);
-        if (((tag_to_app_data_map[container_app_data_tag])->p_parent_app_data)->tag_number == child_app_data_tag)
+        assert(((p_tlv_context->tag_to_app_data_map[container_app_data_tag])->p_parent_app_data)->tag_number == child_app_data_tag);
+        if (((p_tlv_context->tag_to_app_data_map[container_app_data_tag])->p_parent_app_data)->tag_number == child_app_data_tag)
         {
             return TLV_PARENT_AS_CHILD;
         }
@@ -198,87 +310,115 @@ uint32_t tlv_add_child_tag_to_container_app_data_ec(uint32_t container_app_data_
     }
 
     TLV_STATUS status = TLV_FAIL;
-    status = tlv_add_child_tag_to_container_app_data(container_app_data_tag, child_app_data_tag);
+    status = tlv_add_child_tag_to_container_app_data_in_context(p_tlv_context, container_app_data_tag, child_app_data_tag);
 
     /* Return status. */
     return status;
 }
 
-/* Error check for function to add data to TLV objects with definite size. */
-uint32_t tlv_add_data_to_app_data_ec(uint32_t app_data_tag)
+/* Error check for function to add data to TLV objects with definite size in the TLV context. */
+uint32_t tlv_add_data_to_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t app_data_tag)
 {
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
     /* Check if initialized before use. */
-    assert(!b_tlv_app_data_map_initialized);
-    if (!b_tlv_app_data_map_initialized)
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
     {
         return TLV_NOT_INITIALIZED;
     }
 
     /* Check if the TLV tag is not created already or is of container type. */
-    assert((NULL == tag_to_app_data_map[app_data_tag]) && (FALSE == (tag_to_app_data_map[app_data_tag])->b_container));
-    if ((NULL == tag_to_app_data_map[app_data_tag]) && (FALSE == (tag_to_app_data_map[app_data_tag])->b_container))
+    assert((NULL == p_tlv_context->tag_to_app_data_map[app_data_tag]) && (FALSE == (p_tlv_context->tag_to_app_data_map[app_data_tag])->b_container));
+    if ((NULL == p_tlv_context->tag_to_app_data_map[app_data_tag]) && (FALSE == (p_tlv_context->tag_to_app_data_map[app_data_tag])->b_container))
     {
         return TLV_CANNOT_WRITE_VALUE;
     }
 
     TLV_STATUS status = TLV_FAIL;
-    status = tlv_add_data_to_app_data(app_data_tag);
+    status = tlv_add_data_to_app_data_in_context(p_tlv_context, app_data_tag);
 
     /* Return status. */
     return status;
 }
 
-/* Error check for function to add data to constructed container TLV objects with indefinite size. */
-uint32_t tlv_add_data_to_container_app_data_ec(uint32_t container_app_data_tag, uint32_t child_app_data_tag)
+/* Error check for function to add data to constructed container TLV objects with indefinite size in the TLV context. */
+uint32_t tlv_add_data_to_container_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag)
 {
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
     /* Check if initialized before use. */
-    assert(!b_tlv_app_data_map_initialized);
-    if (!b_tlv_app_data_map_initialized)
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
     {
         return TLV_NOT_INITIALIZED;
     }
 
     /* Check if the TLV tag is not created already or its not setup as container. */
-    assert((NULL == tag_to_app_data_map[container_app_data_tag]) || (FALSE == (tag_to_app_data_map[container_app_data_tag])->b_container));
-    if ((NULL == tag_to_app_data_map[container_app_data_tag]) || (FALSE == (tag_to_app_data_map[container_app_data_tag])->b_container))
+    assert((NULL == p_tlv_context->tag_to_app_data_map[container_app_data_tag]) || (FALSE == (p_tlv_context->tag_to_app_data_map[container_app_data_tag])->b_container));
+    if ((NULL == p_tlv_context->tag_to_app_data_map[container_app_data_tag]) || (FALSE == (p_tlv_context->tag_to_app_data_map[container_app_data_tag])->b_container))
     {
         return TLV_TAG_NOT_CREATED;
     }
 
     TLV_STATUS status = TLV_FAIL;
-    status = tlv_add_data_to_container_app_data(container_app_data_tag, child_app_data_tag);
+    status = tlv_add_data_to_container_app_data_in_context(p_tlv_context, container_app_data_tag, child_app_data_tag);
 
     /* Return status. */
     return status;
 }
 
-/* Error check for function to send application data. */
-uint32_t tlv_app_data_send_ec(uint32_t tag)
+/* Error check for function to send application data of the TLV context. */
+uint32_t tlv_app_data_send_in_context_ec(tlv_context_t * p_tlv_context, uint32_t tag)
 {
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
     /* Check if initialized before use. */
-    assert(!b_tlv_app_data_map_initialized);
-    if (!b_tlv_app_data_map_initialized)
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
     {
         return TLV_NOT_INITIALIZED;
     }
 
     /* Check if the TLV tag is not created already. */
-    assert(NULL == tag_to_app_data_map[tag]);
-    if (NULL == tag_to_app_data_map[tag])
+    assert(NULL == p_tlv_context->tag_to_app_data_map[tag]);
+    if (NULL == p_tlv_context->tag_to_app_data_map[tag])
     {
         return TLV_TAG_NOT_CREATED;
     }
 
     TLV_STATUS status = TLV_FAIL;
-    status = tlv_app_data_send(tag);
+    status = tlv_app_data_send_in_context(p_tlv_context, tag);
 
     /* Return status. */
     return status;
 }
 
-/* Error check for function to parse app data from TLV data buffer (first found TLV object is parsed.) */
-uint32_t tlv_parse_app_data_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t * p_parsed_tag)
+/* Error check for function to parse app data of the TLV context from TLV data buffer (first found TLV object is parsed.) */
+uint32_t tlv_parse_app_data_in_context_ec(tlv_context_t * p_tlv_context, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t * p_parsed_tag)
 {
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
     /* Check if the TLV data buffer pointer is valid. */
     assert(!p_tlv_data_buffer);
     if(!p_tlv_data_buffer)
@@ -301,15 +441,23 @@ uint32_t tlv_parse_app_data_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffe
     }
 
     TLV_STATUS status = TLV_FAIL;
-    status = tlv_parse_app_data(p_tlv_data_buffer, buffer_length, p_parsed_tag);
+    status = tlv_parse_app_data_in_context(p_tlv_context, p_tlv_data_buffer, buffer_length, p_parsed_tag);
 
     /* Return status. */
     return status;
 }
 
-/* Error check for function to search tag and parse the TLV data buffer (if recursive set to true, then search for child).*/
-uint32_t tlv_search_parse_app_data_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t search_parse_tag, bool_t b_recursive)
+/* Error check for function to search tag and parse the TLV data buffer into the app data of the TLV context (if recursive set to true, then search for child). */
+uint32_t tlv_search_parse_app_data_in_context_ec(tlv_context_t * p_tlv_context, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length,
+    uint32_t search_parse_tag, bool_t b_recursive)
 {
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
     /* Check if the TLV data buffer pointer is valid. */
     assert(!p_tlv_data_buffer);
     if (!p_tlv_data_buffer)
@@ -325,31 +473,426 @@ uint32_t tlv_search_parse_app_data_ec(const uint8_t * p_tlv_data_buffer, uint32_
     }
 
     /* Check if the TLV tag is not created already. */
-    assert(NULL == tag_to_app_data_map[search_parse_tag]);
-    if (NULL == tag_to_app_data_map[search_parse_tag])
+    assert(NULL == p_tlv_context->tag_to_app_data_map[search_parse_tag]);
+    if (NULL == p_tlv_context->tag_to_app_data_map[search_parse_tag])
     {
         return TLV_TAG_NOT_CREATED;
     }
 
     TLV_STATUS status = TLV_FAIL;
-    status = tlv_search_parse_app_data(p_tlv_data_buffer, buffer_length, search_parse_tag, b_recursive);
+    status = tlv_search_parse_app_data_in_context(p_tlv_context, p_tlv_data_buffer, buffer_length, search_parse_tag, b_recursive);
 
     /* Return status. */
     return status;
 }
 
-/* Error check for function to delete a TLV object. */
-uint32_t tlv_delete_app_data_ec(uint32_t tag)
+/* Error check for function to delete a TLV object in the TLV context. */
+uint32_t tlv_delete_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t tag)
 {
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
     /* Check if the TLV tag is not created already. */
-    assert(NULL == tag_to_app_data_map[tag]);
-    if (NULL == tag_to_app_data_map[tag])
+    assert(NULL == p_tlv_context->tag_to_app_data_map[tag]);
+    if (NULL == p_tlv_context->tag_to_app_data_map[tag])
     {
         return TLV_TAG_NOT_CREATED;
     }
 
     TLV_STATUS status = TLV_FAIL;
-    status = tlv_delete_app_data(tag);
+    status = tlv_delete_app_data_in_context(p_tlv_context, tag);
 
     return status;
 }
+
+/* Error check for function to initialize the app data arena of the TLV context. */
+uint32_t tlv_app_data_arena_init_in_context_ec(tlv_context_t * p_tlv_context, uint8_t * p_arena_buffer, uint32_t arena_size)
+{
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check if initialized before use. */
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
+    {
+        return TLV_NOT_INITIALIZED;
+    }
+
+    /* Check if arena memory is valid. */
+    assert(!p_arena_buffer);
+    if (!p_arena_buffer)
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    assert(!arena_size);
+    if (!arena_size)
+    {
+        return TLV_BAD_BUFFER_LENGTH;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_app_data_arena_init_in_context(p_tlv_context, p_arena_buffer, arena_size);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for function to reset the app data arena of the TLV context. */
+uint32_t tlv_app_data_arena_reset_in_context_ec(tlv_context_t * p_tlv_context)
+{
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check if initialized before use. */
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
+    {
+        return TLV_NOT_INITIALIZED;
+    }
+
+    /* Check if the app data arena is initialized, app data allocated from heap is deleted (not reset). */
+    assert(!p_tlv_context->p_tlv_app_data_arena);
+    if (!p_tlv_context->p_tlv_app_data_arena)
+    {
+        return TLV_NOT_INITIALIZED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_app_data_arena_reset_in_context(p_tlv_context);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for function to mark the app data changed (dirty). */
+uint32_t tlv_mark_app_data_dirty_ec(uint32_t app_data_tag)
+{
+    return tlv_mark_app_data_dirty_in_context_ec(&tlv_default_context, app_data_tag);
+}
+
+/* Error check for function to mark the child app data of the container changed (dirty). */
+uint32_t tlv_mark_child_app_data_dirty_ec(uint32_t container_app_data_tag, uint32_t child_app_data_tag)
+{
+    return tlv_mark_child_app_data_dirty_in_context_ec(&tlv_default_context, container_app_data_tag, child_app_data_tag);
+}
+
+/* Error check for function to set the value of the app data. */
+uint32_t tlv_set_app_data_ec(uint32_t app_data_tag, const uint8_t * p_value, uint32_t value_size)
+{
+    return tlv_set_app_data_in_context_ec(&tlv_default_context, app_data_tag, p_value, value_size);
+}
+
+/* Error check for function to encode the dirty app data. */
+uint32_t tlv_encode_dirty_app_data_ec(uint32_t app_data_tag)
+{
+    return tlv_encode_dirty_app_data_in_context_ec(&tlv_default_context, app_data_tag);
+}
+
+/* Error check for function to mark the app data of the TLV context changed (dirty). */
+uint32_t tlv_mark_app_data_dirty_in_context_ec(tlv_context_t * p_tlv_context, uint32_t app_data_tag)
+{
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check if initialized before use. */
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
+    {
+        return TLV_NOT_INITIALIZED;
+    }
+
+    /* Check if the TLV tag is not created already. */
+    assert(NULL == p_tlv_context->tag_to_app_data_map[app_data_tag]);
+    if (NULL == p_tlv_context->tag_to_app_data_map[app_data_tag])
+    {
+        return TLV_TAG_NOT_CREATED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_mark_app_data_dirty_in_context(p_tlv_context, app_data_tag);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for function to mark the child app data of the container in the TLV context changed (dirty). */
+uint32_t tlv_mark_child_app_data_dirty_in_context_ec(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag)
+{
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check if initialized before use. */
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
+    {
+        return TLV_NOT_INITIALIZED;
+    }
+
+    /* Check if the TLV container tag is not created already. */
+    assert(NULL == p_tlv_context->tag_to_app_data_map[container_app_data_tag]);
+    if (NULL == p_tlv_context->tag_to_app_data_map[container_app_data_tag])
+    {
+        return TLV_TAG_NOT_CREATED;
+    }
+
+    /* Check the tag is container type. */
+    assert(FALSE == (p_tlv_context->tag_to_app_data_map[container_app_data_tag])->b_container);
+    if (FALSE == (p_tlv_context->tag_to_app_data_map[container_app_data_tag])->b_container)
+    {
+        return TLV_NOT_A_CONTAINER;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_mark_child_app_data_dirty_in_context(p_tlv_context, container_app_data_tag, child_app_data_tag);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for function to set the value of the app data of the TLV context. */
+uint32_t tlv_set_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t app_data_tag, const uint8_t * p_value, uint32_t value_size)
+{
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check if initialized before use. */
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
+    {
+        return TLV_NOT_INITIALIZED;
+    }
+
+    /* Check if the TLV tag is not created already. */
+    assert(NULL == p_tlv_context->tag_to_app_data_map[app_data_tag]);
+    if (NULL == p_tlv_context->tag_to_app_data_map[app_data_tag])
+    {
+        return TLV_TAG_NOT_CREATED;
+    }
+
+    /* Check the tag is not container type. */
+    assert(TRUE == (p_tlv_context->tag_to_app_data_map[app_data_tag])->b_container);
+    if (TRUE == (p_tlv_context->tag_to_app_data_map[app_data_tag])->b_container)
+    {
+        return TLV_CANNOT_WRITE_VALUE;
+    }
+
+    /* Check if value is valid. */
+    assert(!p_value);
+    if (!p_value)
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    /* Check the value fits the application variable. */
+    assert(value_size > (p_tlv_context->tag_to_app_data_map[app_data_tag])->u_size.data_size);
+    if (value_size > (p_tlv_context->tag_to_app_data_map[app_data_tag])->u_size.data_size)
+    {
+        return TLV_BAD_DATA_SIZE;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_set_app_data_in_context(p_tlv_context, app_data_tag, p_value, value_size);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for function to encode the dirty app data of the TLV context. */
+uint32_t tlv_encode_dirty_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t app_data_tag)
+{
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check if initialized before use. */
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
+    {
+        return TLV_NOT_INITIALIZED;
+    }
+
+    /* Check if the TLV tag is not created already. */
+    assert(NULL == p_tlv_context->tag_to_app_data_map[app_data_tag]);
+    if (NULL == p_tlv_context->tag_to_app_data_map[app_data_tag])
+    {
+        return TLV_TAG_NOT_CREATED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_encode_dirty_app_data_in_context(p_tlv_context, app_data_tag);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for function to set the lazy decode of the parsed app data. */
+uint32_t tlv_set_lazy_decode_ec(bool_t b_lazy_decode)
+{
+    return tlv_set_lazy_decode_in_context_ec(&tlv_default_context, b_lazy_decode);
+}
+
+/* Error check for function to decode the parsed app data not decoded yet. */
+uint32_t tlv_decode_app_data_ec(uint32_t app_data_tag)
+{
+    return tlv_decode_app_data_in_context_ec(&tlv_default_context, app_data_tag);
+}
+
+/* Error check for function to set the lazy decode of the parsed app data of the TLV context. */
+uint32_t tlv_set_lazy_decode_in_context_ec(tlv_context_t * p_tlv_context, bool_t b_lazy_decode)
+{
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check if initialized before use. */
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
+    {
+        return TLV_NOT_INITIALIZED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_set_lazy_decode_in_context(p_tlv_context, b_lazy_decode);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for function to decode the parsed app data of the TLV context not decoded yet. */
+uint32_t tlv_decode_app_data_in_context_ec(tlv_context_t * p_tlv_context, uint32_t app_data_tag)
+{
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check if initialized before use. */
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
+    {
+        return TLV_NOT_INITIALIZED;
+    }
+
+    /* Check if the TLV tag is not created already. */
+    assert(NULL == p_tlv_context->tag_to_app_data_map[app_data_tag]);
+    if (NULL == p_tlv_context->tag_to_app_data_map[app_data_tag])
+    {
+        return TLV_TAG_NOT_CREATED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_decode_app_data_in_context(p_tlv_context, app_data_tag);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for function to build the send vector of the app data of the TLV context. */
+uint32_t tlv_app_data_build_send_vector_in_context_ec(tlv_context_t * p_tlv_context, uint32_t tag, tlv_send_vector_t * p_send_vector,
+    uint32_t max_vector_count, uint32_t * p_vector_count)
+{
+    /* Check TLV context pointer is valid. */
+    assert(!p_tlv_context);
+    if (!p_tlv_context)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check send vector pointers are valid. */
+    assert((!p_send_vector) || (!p_vector_count));
+    if ((!p_send_vector) || (!p_vector_count))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check if initialized before use. */
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
+    {
+        return TLV_NOT_INITIALIZED;
+    }
+
+    /* Check if the TLV tag is not created already. */
+    assert(NULL == p_tlv_context->tag_to_app_data_map[tag]);
+    if (NULL == p_tlv_context->tag_to_app_data_map[tag])
+    {
+        return TLV_TAG_NOT_CREATED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_app_data_build_send_vector_in_context(p_tlv_context, tag, p_send_vector, max_vector_count, p_vector_count);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for function to send the app data of the TLV context to the file descriptor. */
+uint32_t tlv_app_data_send_fd_in_context_ec(tlv_context_t * p_tlv_context, uint32_t tag, int32_t fd, uint32_t * p_sent_length)
+{
+    /* Check TLV context and sent length pointers are valid. */
+    assert((!p_tlv_context) || (!p_sent_length));
+    if ((!p_tlv_context) || (!p_sent_length))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check the file descriptor is valid. */
+    assert(0 > fd);
+    if (0 > fd)
+    {
+        return TLV_SEND_FAILED;
+    }
+
+    /* Check if initialized before use. */
+    assert(!p_tlv_context->b_tlv_app_data_map_initialized);
+    if (!p_tlv_context->b_tlv_app_data_map_initialized)
+    {
+        return TLV_NOT_INITIALIZED;
+    }
+
+    /* Check if the TLV tag is not created already. */
+    assert(NULL == p_tlv_context->tag_to_app_data_map[tag]);
+    if (NULL == p_tlv_context->tag_to_app_data_map[tag])
+    {
+        return TLV_TAG_NOT_CREATED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_app_data_send_fd_in_context(p_tlv_context, tag, fd, p_sent_length);
+
+    /* Return status. */
+    return status;
+}
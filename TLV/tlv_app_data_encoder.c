@@ -9,15 +9,52 @@
  */
 #define TLV_APP_DATA_SOURCE_CODE
 
+#include <string.h>
+
 #include "tlv_app_data_api.h"
 #include "tlv_api.h"
 #include "tlv_app_data.h"
+#include "tlv_definition.h"
+
+#if (0 < TLV_SEND_WRITEV)
+#include <errno.h>
+#include <unistd.h>
+#endif /* TLV_SEND_WRITEV */
 
-/* 
- * A simple tag to app data map using array (no hashing). Can be optimized by use map structure and hashing of index. 
+/*
+ * Default TLV context, used by the app data functions without a TLV context.
+ * The tag to app data map is a simple array (no hashing). Can be optimized by use map structure and hashing of index.
  */
-tlv_app_data_t * tag_to_app_data_map[TAG_MAX];
-bool_t b_tlv_app_data_map_initialized = FALSE;
+tlv_context_t tlv_default_context;
+
+/* Clear the tag to app data map of the TLV context. */
+static void_t clear_app_data_map(tlv_context_t * p_tlv_context);
+
+/* Check if no app data is created in the TLV context (app data to tags map is empty). */
+static bool_t is_app_data_map_empty(const tlv_context_t * p_tlv_context);
+
+/* Allocate zero initialized memory for app data and TLV object from the app data arena of the TLV context or heap. */
+static void_t * allocate_app_data_memory(tlv_context_t * p_tlv_context, uint32_t size);
+
+/* Free memory of app data and TLV object allocated from heap (memory allocated from the app data arena is released on reset). */
+static void_t free_app_data_memory(tlv_context_t * p_tlv_context, void_t * p_memory);
+
+/* Mark the app data and its container (parent) app data dirty. */
+static void_t mark_app_data_dirty(tlv_app_data_t * p_tlv_app_data);
+
+/* Encode the dirty app data (and the dirty child app data of a container), this is a recursive call for the child containers. */
+static uint32_t encode_dirty_app_data(tlv_app_data_t * p_tlv_app_data);
+
+/* Add the encoded TLV objects of the app data to the send vector, this is a recursive call for the child containers. */
+static uint32_t add_app_data_send_vector(const tlv_app_data_t * p_tlv_app_data, tlv_send_vector_t * p_send_vector, uint32_t max_vector_count,
+    uint32_t * p_vector_count);
+
+/* Add the octets to the send vector, octets following the last send vector entry in memory extend the last send vector entry. */
+static uint32_t add_send_vector_entry(tlv_send_vector_t * p_send_vector, uint32_t max_vector_count, uint32_t * p_vector_count,
+    const uint8_t * p_octets, uint32_t length);
+
+/* End of contents octets of the indefinite length container, the send vector entry of each container end points here. */
+static const uint8_t tlv_end_of_contents_octets[2] = { (uint8_t)TAG_END_OF_CONTENT, (uint8_t)TAG_END_OF_CONTENT };
 
 /*
  * Initialize TLV.
@@ -25,23 +62,128 @@ bool_t b_tlv_app_data_map_initialized = FALSE;
  */
 void_t tlv_initialize(void_t)
 {
-    /* Initialize the app data to tags map to NULL. */
-    for (uint32_t i = 0; i < TAG_MAX; i++)
-    {
-        tag_to_app_data_map[i] = NULL;
-    }
-    /* Set app data map initialized map. */
-    b_tlv_app_data_map_initialized = TRUE;
+    tlv_context_initialize(&tlv_default_context);
 }
 
 /* Function to initialize and create TLV object of the app data with definite size. */
 uint32_t tlv_init_and_create_app_data(uint8_t * p_app_data_buffer, uint32_t app_data_size, uint32_t app_data_tag)
+{
+    return tlv_init_and_create_app_data_in_context(&tlv_default_context, p_app_data_buffer, app_data_size, app_data_tag);
+}
+
+/* Function to create constructed container TLV object of the app data with indefinite size. */
+uint32_t tlv_create_container_app_data(uint32_t container_app_data_tag)
+{
+    return tlv_create_container_app_data_in_context(&tlv_default_context, container_app_data_tag);
+}
+
+/* Function to create TLV object of the app data and add to container (parent) TLV object as a child. */
+uint32_t tlv_add_child_to_container_app_data(uint32_t container_app_data_tag, uint8_t * p_app_data_buffer, uint32_t app_data_size, uint32_t child_app_data_tag)
+{
+    return tlv_add_child_to_container_app_data_in_context(&tlv_default_context, container_app_data_tag, p_app_data_buffer, app_data_size, child_app_data_tag);
+}
+
+/* Function to add created child TLV object to container (parent) TLV object. */
+uint32_t tlv_add_child_tag_to_container_app_data(uint32_t container_app_data_tag, uint32_t child_app_data_tag)
+{
+    return tlv_add_child_tag_to_container_app_data_in_context(&tlv_default_context, container_app_data_tag, child_app_data_tag);
+}
+
+/* Function to add data to TLV objects with definite size. */
+uint32_t tlv_add_data_to_app_data(uint32_t app_data_tag)
+{
+    return tlv_add_data_to_app_data_in_context(&tlv_default_context, app_data_tag);
+}
+
+/* Function to add data to constructed container TLV object with indefinite size. */
+uint32_t tlv_add_data_to_container_app_data(uint32_t container_app_data_tag, uint32_t child_app_data_tag)
+{
+    return tlv_add_data_to_container_app_data_in_context(&tlv_default_context, container_app_data_tag, child_app_data_tag);
+}
+
+/* Function to send application data. */
+uint32_t tlv_app_data_send(uint32_t tag)
+{
+    return tlv_app_data_send_in_context(&tlv_default_context, tag);
+}
+
+/* Function to delete a TLV object and removes the mapping between the TLV object and the app data. */
+uint32_t tlv_delete_app_data(uint32_t tag)
+{
+    return tlv_delete_app_data_in_context(&tlv_default_context, tag);
+}
+
+/* Function to initialize the app data arena on the application provided memory. */
+uint32_t tlv_app_data_arena_init(uint8_t * p_arena_buffer, uint32_t arena_size)
+{
+    return tlv_app_data_arena_init_in_context(&tlv_default_context, p_arena_buffer, arena_size);
+}
+
+/* Function to reset the app data arena, all the app data (and TLV objects) of the message are released at once. */
+uint32_t tlv_app_data_arena_reset(void_t)
+{
+    return tlv_app_data_arena_reset_in_context(&tlv_default_context);
+}
+
+/* Function to mark the app data changed (dirty), the app data is encoded with the next tlv_encode_dirty_app_data(). */
+uint32_t tlv_mark_app_data_dirty(uint32_t app_data_tag)
+{
+    return tlv_mark_app_data_dirty_in_context(&tlv_default_context, app_data_tag);
+}
+
+/* Function to mark the child app data of the container changed (dirty). */
+uint32_t tlv_mark_child_app_data_dirty(uint32_t container_app_data_tag, uint32_t child_app_data_tag)
+{
+    return tlv_mark_child_app_data_dirty_in_context(&tlv_default_context, container_app_data_tag, child_app_data_tag);
+}
+
+/* Function to set the value of the app data (copied to the application variable) and mark the app data dirty. */
+uint32_t tlv_set_app_data(uint32_t app_data_tag, const uint8_t * p_value, uint32_t value_size)
+{
+    return tlv_set_app_data_in_context(&tlv_default_context, app_data_tag, p_value, value_size);
+}
+
+/* Function to encode the dirty app data of the tag (and dirty child app data of a container), clean app data is not encoded again. */
+uint32_t tlv_encode_dirty_app_data(uint32_t app_data_tag)
+{
+    return tlv_encode_dirty_app_data_in_context(&tlv_default_context, app_data_tag);
+}
+
+/* Function to build the send vector of the app data, the send vector entries point at the encoded octets of the TLV objects. */
+uint32_t tlv_app_data_build_send_vector(uint32_t tag, tlv_send_vector_t * p_send_vector, uint32_t max_vector_count, uint32_t * p_vector_count)
+{
+    return tlv_app_data_build_send_vector_in_context(&tlv_default_context, tag, p_send_vector, max_vector_count, p_vector_count);
+}
+
+/* Function to send the app data to the file descriptor with writev(). */
+uint32_t tlv_app_data_send_fd(uint32_t tag, int32_t fd, uint32_t * p_sent_length)
+{
+    return tlv_app_data_send_fd_in_context(&tlv_default_context, tag, fd, p_sent_length);
+}
+
+/*
+ * Initialize the TLV context.
+ * Application must call this function before accessing any other app data API with the TLV context.
+ */
+void_t tlv_context_initialize(tlv_context_t * p_tlv_context)
+{
+    /* App data is allocated from heap until the app data arena of the TLV context is initialized. */
+    p_tlv_context->p_tlv_app_data_arena = NULL;
+
+    /* Parsed app data is decoded by the parse (no lazy decode). */
+    p_tlv_context->b_lazy_decode = FALSE;
+
+    clear_app_data_map(p_tlv_context);
+}
+
+/* Function to initialize and create TLV object of the app data with definite size in the TLV context. */
+uint32_t tlv_init_and_create_app_data_in_context(tlv_context_t * p_tlv_context, uint8_t * p_app_data_buffer, uint32_t app_data_size, uint32_t app_data_tag)
 {
     TLV_STATUS status = TLV_FAIL;
 
     /* Allocate memory to store meta-data for application data with map to TLV object. */
     tlv_app_data_t * p_tlv_app_data = NULL;
-    p_tlv_app_data = (tlv_app_data_t *)calloc(1U, sizeof(tlv_app_data_t));
+    p_tlv_app_data = (tlv_app_data_t *)allocate_app_data_memory(p_tlv_context, (uint32_t)sizeof(tlv_app_data_t));
 
     if (p_tlv_app_data != NULL)
     {
@@ -54,23 +196,22 @@ uint32_t tlv_init_and_create_app_data(uint8_t * p_app_data_buffer, uint32_t app_
 
         /* Allocate memory for TLV object to encode the app data into TLV object. */
         p_tlv_app_data->p_tlv_object = NULL;
-        p_tlv_app_data->p_tlv_object = (tlv_object_t *)calloc(1U, sizeof(tlv_object_t));
+        p_tlv_app_data->p_tlv_object = (tlv_object_t *)allocate_app_data_memory(p_tlv_context, (uint32_t)sizeof(tlv_object_t));
         if (p_tlv_app_data->p_tlv_object != NULL)
         {
             /* Create the TLV object. */
             if (TAG_INTEGER_UNSIGNED == app_data_tag)
             {
-                status = create_tlv_object(p_tlv_app_data->p_tlv_object, TAG_INTEGER, p_tlv_app_data->p_app_data, p_tlv_app_data->u_size.data_size);
+                status = create_tlv_object_in_arena(p_tlv_context->p_tlv_app_data_arena, p_tlv_app_data->p_tlv_object, TAG_INTEGER, p_tlv_app_data->p_app_data, p_tlv_app_data->u_size.data_size);
             }
             else
             {
-                status = create_tlv_object(p_tlv_app_data->p_tlv_object, app_data_tag, p_tlv_app_data->p_app_data, p_tlv_app_data->u_size.data_size);
+                status = create_tlv_object_in_arena(p_tlv_context->p_tlv_app_data_arena, p_tlv_app_data->p_tlv_object, app_data_tag, p_tlv_app_data->p_app_data, p_tlv_app_data->u_size.data_size);
             }
         }
         else
         {
-            /* Memory allocation failed, free the app data structure and return error. */
-            free(p_tlv_app_data);
+            /* Memory allocation failed, app data structure is freed below, return error. */
             status = TLV_NO_MEMORY;
         }
 
@@ -78,14 +219,14 @@ uint32_t tlv_init_and_create_app_data(uint8_t * p_app_data_buffer, uint32_t app_
         {
             /* TLV object created successfully. */
             /* Add key: tag_number and value: p_tlv_app_data to the map. */
-            tag_to_app_data_map[app_data_tag] = p_tlv_app_data;
+            p_tlv_context->tag_to_app_data_map[app_data_tag] = p_tlv_app_data;
             p_tlv_app_data->tag_number = app_data_tag;
         }
         else
         {
             /* TLV object was not created successfully, free the memory and return status. */
-            free(p_tlv_app_data->p_tlv_object);
-            free(p_tlv_app_data);
+            free_app_data_memory(p_tlv_context, p_tlv_app_data->p_tlv_object);
+            free_app_data_memory(p_tlv_context, p_tlv_app_data);
         }
     }
     else
@@ -98,14 +239,14 @@ uint32_t tlv_init_and_create_app_data(uint8_t * p_app_data_buffer, uint32_t app_
     return status;
 }
 
-/* Function to create constructed container TLV object of the app data with indefinite size. */
-uint32_t tlv_create_container_app_data(uint32_t container_app_data_tag)
+/* Function to create constructed container TLV object of the app data with indefinite size in the TLV context. */
+uint32_t tlv_create_container_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag)
 {
     TLV_STATUS status = TLV_FAIL;
 
     /* Allocate memory to store meta-data for application data with map to TLV object. */
     tlv_app_data_t * p_tlv_app_data = NULL;
-    p_tlv_app_data = (tlv_app_data_t *)calloc(1U, sizeof(tlv_app_data_t));
+    p_tlv_app_data = (tlv_app_data_t *)allocate_app_data_memory(p_tlv_context, (uint32_t)sizeof(tlv_app_data_t));
 
     if (p_tlv_app_data != NULL)
     {
@@ -117,16 +258,15 @@ uint32_t tlv_create_container_app_data(uint32_t container_app_data_tag)
 
         /* Allocate memory for TLV object to encode the container type app data into container TLV object. */
         p_tlv_app_data->p_tlv_object = NULL;
-        p_tlv_app_data->p_tlv_object = (tlv_object_t *)calloc(1U, sizeof(tlv_object_t));
+        p_tlv_app_data->p_tlv_object = (tlv_object_t *)allocate_app_data_memory(p_tlv_context, (uint32_t)sizeof(tlv_object_t));
         if (p_tlv_app_data->p_tlv_object != NULL)
         {
             /* Create the TLV object. */
-            status = create_tlv_object(p_tlv_app_data->p_tlv_object, container_app_data_tag, p_tlv_app_data->p_app_data, p_tlv_app_data->u_size.data_size);
+            status = create_tlv_object_in_arena(p_tlv_context->p_tlv_app_data_arena, p_tlv_app_data->p_tlv_object, container_app_data_tag, p_tlv_app_data->p_app_data, p_tlv_app_data->u_size.data_size);
         }
         else
         {
-            /* Memory allocation failed, free the app data structure and return error. */
-            free(p_tlv_app_data);
+            /* Memory allocation failed, app data structure is freed below, return error. */
             status = TLV_NO_MEMORY;
         }
 
@@ -134,14 +274,14 @@ uint32_t tlv_create_container_app_data(uint32_t container_app_data_tag)
         {
             /* Container TLV object created successfully. */
             /* Add key: tag_number and value: p_tlv_app_data to the map. */
-            tag_to_app_data_map[container_app_data_tag] = p_tlv_app_data;
+            p_tlv_context->tag_to_app_data_map[container_app_data_tag] = p_tlv_app_data;
             p_tlv_app_data->tag_number = container_app_data_tag;
         }
         else
         {
             /* Container TLV object was not created successfully, free the memory and return status. */
-            free(p_tlv_app_data->p_tlv_object);
-            free(p_tlv_app_data);
+            free_app_data_memory(p_tlv_context, p_tlv_app_data->p_tlv_object);
+            free_app_data_memory(p_tlv_context, p_tlv_app_data);
         }
     }
     else
@@ -154,14 +294,15 @@ uint32_t tlv_create_container_app_data(uint32_t container_app_data_tag)
     return status;
 }
 
-/* Function to create TLV object of the app data and add to container (parent) TLV object as a child. */
-uint32_t tlv_add_child_to_container_app_data(uint32_t container_app_data_tag, uint8_t * p_app_data_buffer, uint32_t app_data_size, uint32_t child_app_data_tag)
+/* Function to create TLV object of the app data and add to container (parent) TLV object as a child in the TLV context. */
+uint32_t tlv_add_child_to_container_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint8_t * p_app_data_buffer,
+    uint32_t app_data_size, uint32_t child_app_data_tag)
 {
     TLV_STATUS status = TLV_FAIL;
 
     /* Allocate memory to store meta-data for application data with map to TLV object. */
     tlv_app_data_t * p_tlv_app_data = NULL;
-    p_tlv_app_data = (tlv_app_data_t *)calloc(1U, sizeof(tlv_app_data_t));
+    p_tlv_app_data = (tlv_app_data_t *)allocate_app_data_memory(p_tlv_context, (uint32_t)sizeof(tlv_app_data_t));
 
     if (p_tlv_app_data != NULL)
     {
@@ -169,21 +310,21 @@ uint32_t tlv_add_child_to_container_app_data(uint32_t container_app_data_tag, ui
         p_tlv_app_data->u_size.data_size = app_data_size;
         p_tlv_app_data->p_app_data = p_app_data_buffer;
         /* Get the container app data map. */
-        tlv_app_data_t * p_tlv_container_app_data = tag_to_app_data_map[container_app_data_tag];
+        tlv_app_data_t * p_tlv_container_app_data = p_tlv_context->tag_to_app_data_map[container_app_data_tag];
 
         /* Allocate memory for TLV object to encode the app data into TLV object. */
         p_tlv_app_data->p_tlv_object = NULL;
-        p_tlv_app_data->p_tlv_object = (tlv_object_t *)calloc(1U, sizeof(tlv_object_t));
+        p_tlv_app_data->p_tlv_object = (tlv_object_t *)allocate_app_data_memory(p_tlv_context, (uint32_t)sizeof(tlv_object_t));
         if (p_tlv_app_data->p_tlv_object != NULL)
         {
             /* Create the TLV object. */
             if (TAG_INTEGER_UNSIGNED == child_app_data_tag)
             {
-                status = create_tlv_object(p_tlv_app_data->p_tlv_object, TAG_INTEGER, p_tlv_app_data->p_app_data, p_tlv_app_data->u_size.data_size);
+                status = create_tlv_object_in_arena(p_tlv_context->p_tlv_app_data_arena, p_tlv_app_data->p_tlv_object, TAG_INTEGER, p_tlv_app_data->p_app_data, p_tlv_app_data->u_size.data_size);
             }
             else
             {
-                status = create_tlv_object(p_tlv_app_data->p_tlv_object, child_app_data_tag, p_tlv_app_data->p_app_data, p_tlv_app_data->u_size.data_size);
+                status = create_tlv_object_in_arena(p_tlv_context->p_tlv_app_data_arena, p_tlv_app_data->p_tlv_object, child_app_data_tag, p_tlv_app_data->p_app_data, p_tlv_app_data->u_size.data_size);
             }
 
             if (TLV_SUCCESS == status)
@@ -195,8 +336,7 @@ uint32_t tlv_add_child_to_container_app_data(uint32_t container_app_data_tag, ui
         }
         else
         {
-            /* Memory allocation failed, free the app data structure and return error. */
-            free(p_tlv_app_data);
+            /* Memory allocation failed, app data structure is freed below, return error. */
             status = TLV_NO_MEMORY;
         }
 
@@ -214,8 +354,8 @@ uint32_t tlv_add_child_to_container_app_data(uint32_t container_app_data_tag, ui
         else
         {
             /* Child TLV object was not created and added successfully, free the memory and return status. */
-            free(p_tlv_app_data->p_tlv_object);
-            free(p_tlv_app_data);
+            free_app_data_memory(p_tlv_context, p_tlv_app_data->p_tlv_object);
+            free_app_data_memory(p_tlv_context, p_tlv_app_data);
         }
     }
     else
@@ -228,14 +368,14 @@ uint32_t tlv_add_child_to_container_app_data(uint32_t container_app_data_tag, ui
     return status;
 }
 
-/* Function to add created child TLV object to container (parent) TLV object. */
-uint32_t tlv_add_child_tag_to_container_app_data(uint32_t container_app_data_tag, uint32_t child_app_data_tag)
+/* Function to add created child TLV object to container (parent) TLV object in the TLV context. */
+uint32_t tlv_add_child_tag_to_container_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag)
 {
     TLV_STATUS status = TLV_FAIL;
 
     /* Get the container tag app data */
-    tlv_app_data_t * p_tlv_container_app_data = tag_to_app_data_map[container_app_data_tag];
-    tlv_app_data_t * p_tlv_child_app_data = tag_to_app_data_map[child_app_data_tag];
+    tlv_app_data_t * p_tlv_container_app_data = p_tlv_context->tag_to_app_data_map[container_app_data_tag];
+    tlv_app_data_t * p_tlv_child_app_data = p_tlv_context->tag_to_app_data_map[child_app_data_tag];
     status = add_tlv_object_to_tlv_container(p_tlv_container_app_data->p_tlv_object, p_tlv_child_app_data->p_tlv_object);
     if (TLV_SUCCESS == status)
     {
@@ -245,32 +385,43 @@ uint32_t tlv_add_child_tag_to_container_app_data(uint32_t container_app_data_tag
         /* update container app data with child app data details. */
         p_tlv_container_app_data->p_child_app_data[p_tlv_container_app_data->u_size.child_count] = p_tlv_child_app_data;
         p_tlv_container_app_data->u_size.child_count++;
+
+        if (TRUE == p_tlv_child_app_data->b_dirty)
+        {
+            /* Dirty child app data, the container is dirty too. */
+            mark_app_data_dirty(p_tlv_child_app_data);
+        }
     }
 
     return status;
 }
 
-/* Function to add data to TLV objects with definite size. */
-uint32_t tlv_add_data_to_app_data(uint32_t app_data_tag)
+/* Function to add data to TLV objects with definite size in the TLV context. */
+uint32_t tlv_add_data_to_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag)
 {
     TLV_STATUS status = TLV_FAIL;
 
     /* Get the app data map. */
-    tlv_app_data_t * p_tlv_app_data = tag_to_app_data_map[app_data_tag];
+    tlv_app_data_t * p_tlv_app_data = p_tlv_context->tag_to_app_data_map[app_data_tag];
     /* Update the application data to the TLV object. */
     status = add_data_to_tlv_object(p_tlv_app_data->p_tlv_object, app_data_tag, p_tlv_app_data->p_app_data, p_tlv_app_data->u_size.data_size);
+    if (TLV_SUCCESS == status)
+    {
+        /* App data is encoded. */
+        p_tlv_app_data->b_dirty = FALSE;
+    }
 
     return status;
 }
 
-/* Function to add data to constructed container TLV object with indefinite size. */
-uint32_t tlv_add_data_to_container_app_data(uint32_t container_app_data_tag, uint32_t child_app_data_tag)
+/* Function to add data to constructed container TLV object with indefinite size in the TLV context. */
+uint32_t tlv_add_data_to_container_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag)
 {
     TLV_STATUS status = TLV_FAIL;
     bool_t b_child_found = FALSE;
 
     /* Get the container tag app data */
-    tlv_app_data_t * p_container_app_data = tag_to_app_data_map[container_app_data_tag];
+    tlv_app_data_t * p_container_app_data = p_tlv_context->tag_to_app_data_map[container_app_data_tag];
     for (uint32_t i = 0U; i < p_container_app_data->u_size.child_count; i++)
     {
         /* Search the child app data. */
@@ -280,6 +431,11 @@ uint32_t tlv_add_data_to_container_app_data(uint32_t container_app_data_tag, uin
 
             /* update the child application data to the corresponding child TLV object. */
             status = add_data_to_tlv_object((p_container_app_data->p_child_app_data[i])->p_tlv_object, child_app_data_tag, (p_container_app_data->p_child_app_data[i])->p_app_data, (p_container_app_data->p_child_app_data[i])->u_size.data_size);
+            if (TLV_SUCCESS == status)
+            {
+                /* Child app data is encoded. */
+                (p_container_app_data->p_child_app_data[i])->b_dirty = FALSE;
+            }
         }
     }
 
@@ -293,8 +449,8 @@ uint32_t tlv_add_data_to_container_app_data(uint32_t container_app_data_tag, uin
     return status;
 }
 
-/* Function to send application data. */
-uint32_t tlv_app_data_send(uint32_t tag)
+/* Function to send application data in the TLV context. */
+uint32_t tlv_app_data_send_in_context(tlv_context_t * p_tlv_context, uint32_t tag)
 {
     TLV_STATUS status = TLV_SUCCESS;
     /*
@@ -302,8 +458,16 @@ uint32_t tlv_app_data_send(uint32_t tag)
      * - May be it just writes TLV encoded buffer to the ring buffer.
      * - The serial driver reads the TLV encoded buffer from the ring buffer and send on the serial Communication channel.
      * - This function will be updated to communicate with serial driver, currently is used for testing TLV encoded object.
+     * - tlv_app_data_send_fd_in_context() sends the encoded TLV objects to a file descriptor (socket, pipe).
      */
-    tlv_app_data_t * p_app_data = tag_to_app_data_map[tag];
+    tlv_app_data_t * p_app_data = p_tlv_context->tag_to_app_data_map[tag];
+
+    /* Encode the dirty app data first, the encoded TLV objects of the clean app data are sent as is. */
+    status = encode_dirty_app_data(p_app_data);
+    if (TLV_SUCCESS != status)
+    {
+        return status;
+    }
 
     if (p_app_data->b_container)
     {
@@ -334,7 +498,7 @@ uint32_t tlv_app_data_send(uint32_t tag)
             else
             {
                 printf("Container within a container. \n");
-                tlv_app_data_send((p_app_data->p_child_app_data[i])->tag_number);
+                tlv_app_data_send_in_context(p_tlv_context, (p_app_data->p_child_app_data[i])->tag_number);
             }
         }
 
@@ -362,14 +526,340 @@ uint32_t tlv_app_data_send(uint32_t tag)
  * Child in a container should be in linked list (instead of array) for deleting an app data included in a parent.
  * This is not a problem with tlv.h and tlv.c (child TLV objects), as they are in listed using linked list.
  */
-uint32_t tlv_delete_app_data(uint32_t tag)
+uint32_t tlv_delete_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t tag)
 {
     TLV_STATUS status = TLV_FAIL;
 
-    if (!tag)
+    if ((!p_tlv_context) || (!tag))
     {
         /* Suppress warning. */
     }
 
     return status;
 }
+
+/*
+ * Function to initialize the app data arena on the application provided memory.
+ * App data and TLV objects created after this call are allocated from the app data arena (no calloc per app data).
+ * App data created before (allocated from heap) would not be released by the reset, the app data map should be empty.
+ */
+uint32_t tlv_app_data_arena_init_in_context(tlv_context_t * p_tlv_context, uint8_t * p_arena_buffer, uint32_t arena_size)
+{
+    TLV_STATUS status = TLV_FAIL;
+
+    if (TRUE != is_app_data_map_empty(p_tlv_context))
+    {
+        status = TLV_TAG_CREATED;
+    }
+    else
+    {
+        status = tlv_arena_init(&p_tlv_context->tlv_app_data_arena, p_arena_buffer, arena_size);
+    }
+
+    if (TLV_SUCCESS == status)
+    {
+        p_tlv_context->p_tlv_app_data_arena = &p_tlv_context->tlv_app_data_arena;
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/*
+ * Function to reset the app data arena, all the app data (and TLV objects) of the message are released at once.
+ * The app data map is cleared, app data should be created again for the next message.
+ */
+uint32_t tlv_app_data_arena_reset_in_context(tlv_context_t * p_tlv_context)
+{
+    TLV_STATUS status = TLV_FAIL;
+
+    status = tlv_arena_reset(&p_tlv_context->tlv_app_data_arena);
+    if (TLV_SUCCESS == status)
+    {
+        /* Clear the app data to tags map. */
+        clear_app_data_map(p_tlv_context);
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to mark the app data of the TLV context changed (dirty). */
+uint32_t tlv_mark_app_data_dirty_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag)
+{
+    /* Mark the app data and its container app data dirty. */
+    mark_app_data_dirty(p_tlv_context->tag_to_app_data_map[app_data_tag]);
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Function to mark the child app data of the container in the TLV context changed (dirty). */
+uint32_t tlv_mark_child_app_data_dirty_in_context(tlv_context_t * p_tlv_context, uint32_t container_app_data_tag, uint32_t child_app_data_tag)
+{
+    TLV_STATUS status = TLV_TAG_NOT_CREATED;
+
+    /* Get the container tag app data */
+    tlv_app_data_t * p_container_app_data = p_tlv_context->tag_to_app_data_map[container_app_data_tag];
+    for (uint32_t i = 0U; i < p_container_app_data->u_size.child_count; i++)
+    {
+        /* Search the child app data. */
+        if ((p_container_app_data->p_child_app_data[i])->tag_number == child_app_data_tag)
+        {
+            mark_app_data_dirty(p_container_app_data->p_child_app_data[i]);
+            status = TLV_SUCCESS;
+        }
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to set the value of the app data of the TLV context and mark the app data dirty. */
+uint32_t tlv_set_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag, const uint8_t * p_value, uint32_t value_size)
+{
+    tlv_app_data_t * p_tlv_app_data = p_tlv_context->tag_to_app_data_map[app_data_tag];
+
+    /* Copy the value to the application variable, the rest of the application variable is zeroed. */
+    memcpy(p_tlv_app_data->p_app_data, p_value, value_size);
+    memset(&p_tlv_app_data->p_app_data[value_size], 0, (p_tlv_app_data->u_size.data_size - value_size));
+
+    /* Return status. */
+    return tlv_mark_app_data_dirty_in_context(p_tlv_context, app_data_tag);
+}
+
+/* Function to encode the dirty app data of the tag in the TLV context. */
+uint32_t tlv_encode_dirty_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag)
+{
+    /* Encode the dirty app data. */
+    return encode_dirty_app_data(p_tlv_context->tag_to_app_data_map[app_data_tag]);
+}
+
+/*
+ * Function to build the send vector of the app data in the TLV context.
+ * The dirty app data is encoded first, then each send vector entry points at the encoded octets of a TLV object (tag and length
+ * octets of a container, a child TLV object or the end of contents octets of an indefinite length container), no octets are copied.
+ */
+uint32_t tlv_app_data_build_send_vector_in_context(tlv_context_t * p_tlv_context, uint32_t tag, tlv_send_vector_t * p_send_vector,
+    uint32_t max_vector_count, uint32_t * p_vector_count)
+{
+    TLV_STATUS status = TLV_FAIL;
+    tlv_app_data_t * p_app_data = p_tlv_context->tag_to_app_data_map[tag];
+
+    *p_vector_count = 0U;
+
+    /* Encode the dirty app data first, the encoded TLV objects of the clean app data are sent as is. */
+    status = encode_dirty_app_data(p_app_data);
+    if (TLV_SUCCESS == status)
+    {
+        status = add_app_data_send_vector(p_app_data, p_send_vector, max_vector_count, p_vector_count);
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/*
+ * Function to send the app data of the TLV context to the file descriptor, the send vector of the app data is written with writev().
+ * A partial write (socket buffer or pipe full) is continued from the first octet not written. The octets written are returned
+ * in p_sent_length, also if writev() fails after a partial write (e.g. EAGAIN of a non-blocking file descriptor).
+ */
+uint32_t tlv_app_data_send_fd_in_context(tlv_context_t * p_tlv_context, uint32_t tag, int32_t fd, uint32_t * p_sent_length)
+{
+    TLV_STATUS status = TLV_SEND_FAILED;
+
+    *p_sent_length = 0U;
+
+#if (0 < TLV_SEND_WRITEV)
+    tlv_send_vector_t send_vector[TLV_SEND_MAX_VECTOR_COUNT];
+    uint32_t vector_count = 0U;
+    uint32_t vector_index = 0U;
+
+    status = tlv_app_data_build_send_vector_in_context(p_tlv_context, tag, send_vector, TLV_SEND_MAX_VECTOR_COUNT, &vector_count);
+
+    while ((TLV_SUCCESS == status) && (vector_index < vector_count))
+    {
+        ssize_t written_length = writev(fd, &send_vector[vector_index], (int)(vector_count - vector_index));
+        if (0 > written_length)
+        {
+            if (EINTR != errno)
+            {
+                /* Cannot write to the file descriptor. */
+                status = TLV_SEND_FAILED;
+            }
+            continue;
+        }
+
+        /* Skip the written send vector entries, a partially written entry continues after the written octets. */
+        size_t remaining_length = (size_t)written_length;
+        *p_sent_length += (uint32_t)written_length;
+        while ((vector_index < vector_count) && (remaining_length >= send_vector[vector_index].iov_len))
+        {
+            remaining_length -= send_vector[vector_index].iov_len;
+            vector_index++;
+        }
+
+        if (vector_index < vector_count)
+        {
+            send_vector[vector_index].iov_base = &((uint8_t *)send_vector[vector_index].iov_base)[remaining_length];
+            send_vector[vector_index].iov_len -= remaining_length;
+        }
+    }
+#else
+    if ((!p_tlv_context) || (!tag) || (!fd))
+    {
+        /* Suppress warning, no writev() on the target. */
+    }
+#endif /* TLV_SEND_WRITEV */
+
+    /* Return status. */
+    return status;
+}
+
+/* Clear the tag to app data map of the TLV context. */
+static void_t clear_app_data_map(tlv_context_t * p_tlv_context)
+{
+    /* Initialize the app data to tags map to NULL. */
+    for (uint32_t i = 0; i < TAG_MAX; i++)
+    {
+        p_tlv_context->tag_to_app_data_map[i] = NULL;
+    }
+    /* Set app data map initialized map. */
+    p_tlv_context->b_tlv_app_data_map_initialized = TRUE;
+}
+
+/* Check if no app data is created in the TLV context (app data to tags map is empty). */
+static bool_t is_app_data_map_empty(const tlv_context_t * p_tlv_context)
+{
+    bool_t b_empty = TRUE;
+
+    for (uint32_t i = 0; (i < TAG_MAX) && (TRUE == b_empty); i++)
+    {
+        if (p_tlv_context->tag_to_app_data_map[i] != NULL)
+        {
+            b_empty = FALSE;
+        }
+    }
+
+    return b_empty;
+}
+
+/* Allocate zero initialized memory for app data and TLV object from the app data arena of the TLV context or heap. */
+static void_t * allocate_app_data_memory(tlv_context_t * p_tlv_context, uint32_t size)
+{
+    return allocate_tlv_memory(p_tlv_context->p_tlv_app_data_arena, size);
+}
+
+/* Free memory of app data and TLV object allocated from heap (memory allocated from the app data arena is released on reset). */
+static void_t free_app_data_memory(tlv_context_t * p_tlv_context, void_t * p_memory)
+{
+    free_tlv_memory(p_tlv_context->p_tlv_app_data_arena, p_memory);
+}
+
+/* Mark the app data and its container (parent) app data dirty, stop at a container already dirty. */
+static void_t mark_app_data_dirty(tlv_app_data_t * p_tlv_app_data)
+{
+    p_tlv_app_data->b_dirty = TRUE;
+    for (tlv_app_data_t * p_parent_app_data = p_tlv_app_data->p_parent_app_data;
+        (p_parent_app_data) && (FALSE == p_parent_app_data->b_dirty); p_parent_app_data = p_parent_app_data->p_parent_app_data)
+    {
+        p_parent_app_data->b_dirty = TRUE;
+    }
+}
+
+/* Encode the dirty app data (and the dirty child app data of a container), this is a recursive call for the child containers. */
+static uint32_t encode_dirty_app_data(tlv_app_data_t * p_tlv_app_data)
+{
+    TLV_STATUS status = TLV_SUCCESS;
+
+    if (FALSE == p_tlv_app_data->b_dirty)
+    {
+        /* Clean app data (and all its child app data), the TLV object is encoded. */
+        return TLV_SUCCESS;
+    }
+
+    if (p_tlv_app_data->b_container)
+    {
+        /* Encode only the dirty child app data. */
+        for (uint32_t i = 0U; (TLV_SUCCESS == status) && (i < p_tlv_app_data->u_size.child_count); i++)
+        {
+            status = encode_dirty_app_data(p_tlv_app_data->p_child_app_data[i]);
+        }
+    }
+    else
+    {
+        /* Update the application data to the TLV object. */
+        status = add_data_to_tlv_object(p_tlv_app_data->p_tlv_object, p_tlv_app_data->tag_number, p_tlv_app_data->p_app_data,
+            p_tlv_app_data->u_size.data_size);
+    }
+
+    if (TLV_SUCCESS == status)
+    {
+        /* App data is encoded. */
+        p_tlv_app_data->b_dirty = FALSE;
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Add the encoded TLV objects of the app data to the send vector, this is a recursive call for the child containers. */
+static uint32_t add_app_data_send_vector(const tlv_app_data_t * p_tlv_app_data, tlv_send_vector_t * p_send_vector, uint32_t max_vector_count,
+    uint32_t * p_vector_count)
+{
+    TLV_STATUS status = TLV_SUCCESS;
+    const tlv_object_t * p_tlv_object = p_tlv_app_data->p_tlv_object;
+
+    /* Encoded TLV object, the tag and length octets only for a container. */
+    status = add_send_vector_entry(p_send_vector, max_vector_count, p_vector_count, p_tlv_object->p_tlv_object_encoded_buffer,
+        p_tlv_object->tlv_curr_encoded_object_length);
+
+    if (p_tlv_app_data->b_container)
+    {
+        for (uint32_t i = 0U; (TLV_SUCCESS == status) && (i < p_tlv_app_data->u_size.child_count); i++)
+        {
+            status = add_app_data_send_vector(p_tlv_app_data->p_child_app_data[i], p_send_vector, max_vector_count, p_vector_count);
+        }
+
+        if ((TLV_SUCCESS == status) && (FALSE == p_tlv_object->b_tlv_object_length_definite))
+        {
+            /* End of contents octets of the indefinite length container. */
+            status = add_send_vector_entry(p_send_vector, max_vector_count, p_vector_count, tlv_end_of_contents_octets,
+                sizeof(tlv_end_of_contents_octets));
+        }
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Add the octets to the send vector, octets following the last send vector entry in memory extend the last send vector entry. */
+static uint32_t add_send_vector_entry(tlv_send_vector_t * p_send_vector, uint32_t max_vector_count, uint32_t * p_vector_count,
+    const uint8_t * p_octets, uint32_t length)
+{
+    TLV_STATUS status = TLV_SUCCESS;
+
+    if (!length)
+    {
+        /* Nothing to send. */
+    }
+    else if ((*p_vector_count) && (&((const uint8_t *)p_send_vector[*p_vector_count - 1U].iov_base)[p_send_vector[*p_vector_count - 1U].iov_len] == p_octets))
+    {
+        /* Octets are contiguous with the last send vector entry. */
+        p_send_vector[*p_vector_count - 1U].iov_len += length;
+    }
+    else if (*p_vector_count < max_vector_count)
+    {
+        p_send_vector[*p_vector_count].iov_base = (void_t *)p_octets;
+        p_send_vector[*p_vector_count].iov_len = length;
+        (*p_vector_count)++;
+    }
+    else
+    {
+        /* App data needs more send vector entries. */
+        status = TLV_SEND_VECTOR_FULL;
+    }
+
+    /* Return status. */
+    return status;
+}
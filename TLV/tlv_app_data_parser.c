@@ -13,14 +13,19 @@
 #include "tlv_api.h"
 #include "tlv_app_data.h"
 #include "tlv_app_data_tag_check.h"
+#include "tlv_integer.h"
+#include "tlv_definition.h"
 
-extern tlv_app_data_t * tag_to_app_data_map[TAG_MAX];
+extern tlv_context_t tlv_default_context;
 
 /* App data constraints verification for the parsed TLV object. */
-static uint32_t check_parsed_tlv_object_app_data(tlv_object_t * p_tlv_parsed_object, tlv_app_data_t ** p_tlv_app_data);
+static uint32_t check_parsed_tlv_object_app_data(const tlv_context_t * p_tlv_context, const tlv_object_view_t * p_tlv_parsed_object, tlv_app_data_t ** p_tlv_app_data);
 
-/* Copy the encoded TLV buffer from the parsed TLV object to the app data mapped of the TLV object */
-static void_t copy_tlv_encoded_buffer(tlv_object_t * p_tlv_parsed_object, tlv_app_data_t * p_tlv_app_data);
+/* Check the value length of the parsed TLV object fits the app data (integer value of 1 to app data size octets). */
+static uint32_t check_app_data_value_length(const tlv_app_data_t * p_tlv_app_data, uint32_t value_length);
+
+/* Copy the encoded TLV buffer from the parsed TLV object view to the app data mapped of the TLV object */
+static void_t copy_tlv_encoded_buffer(const tlv_object_view_t * p_tlv_parsed_object, tlv_app_data_t * p_tlv_app_data);
 
 /* update app data from the decoded TLV object. */
 static void_t update_app_data(tlv_app_data_t * p_tlv_app_data);
@@ -31,82 +36,165 @@ static void_t update_app_data_integer(tlv_app_data_t * p_tlv_app_data);
 /* Generic update app data with TLV value. */
 static void_t update_app_data_generic(tlv_app_data_t * p_tlv_app_data);
 
+/* Keep the parsed TLV object view in the app data (lazy decode) or decode it into the app data. */
+static void_t store_parsed_app_data(const tlv_context_t * p_tlv_context, const tlv_object_view_t * p_tlv_parsed_object, tlv_app_data_t * p_tlv_app_data);
+
+/* Decode the parsed app data not decoded yet (and the child app data of a container), this is a recursive call for the child containers. */
+static void_t decode_pending_app_data(tlv_app_data_t * p_tlv_app_data);
+
+/* Keep the parsed TLV object views of the child app data of the container (lazy decode), this is a recursive call for the child containers. */
+static uint32_t store_parsed_child_app_data(const tlv_context_t * p_tlv_context, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length,
+    uint32_t buffer_index, bool_t b_recursive, tlv_app_data_t * p_container_app_data);
+
 /* Function to parse app data from TLV data buffer (first found TLV object is parsed.) */
 uint32_t tlv_parse_app_data(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t * p_parsed_tag)
+{
+    return tlv_parse_app_data_in_context(&tlv_default_context, p_tlv_data_buffer, buffer_length, p_parsed_tag);
+}
+
+/* Function to search tag and parse the TLV data buffer (if recursive set to true, then search for child app data).*/
+uint32_t tlv_search_parse_app_data(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t search_parse_tag, bool_t b_recursive)
+{
+    return tlv_search_parse_app_data_in_context(&tlv_default_context, p_tlv_data_buffer, buffer_length, search_parse_tag, b_recursive);
+}
+
+/* Function to set the lazy decode of the parsed app data (value decoded on the first access). */
+uint32_t tlv_set_lazy_decode(bool_t b_lazy_decode)
+{
+    return tlv_set_lazy_decode_in_context(&tlv_default_context, b_lazy_decode);
+}
+
+/* Function to decode the parsed app data (and the child app data of a container) not decoded yet into the application variable. */
+uint32_t tlv_decode_app_data(uint32_t app_data_tag)
+{
+    return tlv_decode_app_data_in_context(&tlv_default_context, app_data_tag);
+}
+
+/* Function to parse app data of the TLV context from TLV data buffer (first found TLV object is parsed.) */
+uint32_t tlv_parse_app_data_in_context(tlv_context_t * p_tlv_context, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t * p_parsed_tag)
 {
     TLV_STATUS status = TLV_FAIL;
-    tlv_object_t * tlv_parsed_object = NULL;
+    tlv_object_view_t tlv_parsed_object_view;
 
-    /* allocated memory for the TLV object. */
-    tlv_parsed_object = (tlv_object_t *)calloc(1U, sizeof(tlv_object_t));
-    if (tlv_parsed_object)
+    /* Parse the first tag in the buffer (the view points into the TLV data buffer, no memory allocation). */
+    status = parse_tlv_object_view(p_tlv_data_buffer, buffer_length, &tlv_parsed_object_view);
+    if (TLV_SUCCESS == status)
     {
-        /* Parse the first tag in the buffer. */
-        status = parse_tlv_object(p_tlv_data_buffer, buffer_length, tlv_parsed_object);
+        tlv_app_data_t * p_tlv_app_data = NULL;
+        status = check_parsed_tlv_object_app_data(p_tlv_context, &tlv_parsed_object_view, &p_tlv_app_data);
+
         if (TLV_SUCCESS == status)
         {
-            tlv_app_data_t * p_tlv_app_data = NULL;
-            status = check_parsed_tlv_object_app_data(tlv_parsed_object, &p_tlv_app_data);
+            /* Decode the app data (or keep the view for the first access). */
+            store_parsed_app_data(p_tlv_context, &tlv_parsed_object_view, p_tlv_app_data);
 
-            if (TLV_SUCCESS == status)
-            {
-                /* copy the encoded buffer from TLV object to app data. */
-                copy_tlv_encoded_buffer(tlv_parsed_object, p_tlv_app_data);
-
-                /* update app data from the decoded TLV object. */
-                update_app_data(p_tlv_app_data);
-
-                /* Return the found tag. */
-                *p_parsed_tag = p_tlv_app_data->tag_number;
-            }
-            /* Free the TLV buffer. */
-            free(tlv_parsed_object->p_tlv_object_encoded_buffer);
+            /* Return the found tag. */
+            *p_parsed_tag = p_tlv_app_data->tag_number;
         }
-        /* Free the TLV object. */
-        free(tlv_parsed_object);
     }
 
-
     /* Return status. */
     return status;
 }
 
-/* Function to search tag and parse the TLV data buffer (if recursive set to true, then search for child app data).*/
-uint32_t tlv_search_parse_app_data(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t search_parse_tag, bool_t b_recursive)
+/* Function to search tag and parse the TLV data buffer into the app data of the TLV context (if recursive set to true, then search for child app data).*/
+uint32_t tlv_search_parse_app_data_in_context(tlv_context_t * p_tlv_context, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length,
+    uint32_t search_parse_tag, bool_t b_recursive)
 {
     TLV_STATUS status = TLV_FAIL;
 
     /* get app data to tlv object mapping. */
     tlv_app_data_t * p_tlv_app_data = NULL;
-    p_tlv_app_data = tag_to_app_data_map[search_parse_tag];
+    p_tlv_app_data = p_tlv_context->tag_to_app_data_map[search_parse_tag];
+
+    if (TRUE == p_tlv_context->b_lazy_decode)
+    {
+        tlv_object_view_t tlv_parsed_object_view;
+
+        /* Search the tag, the view points into the TLV data buffer (nothing is copied or decoded). */
+        status = tlv_search_tag_view(p_tlv_data_buffer, buffer_length, search_parse_tag, b_recursive, &tlv_parsed_object_view);
+        if ((TLV_SUCCESS == status) &&
+            ((tlv_parsed_object_view.b_tlv_container_object != p_tlv_app_data->b_container) ||
+            (tlv_parsed_object_view.tlv_encoded_object_length > (p_tlv_app_data->p_tlv_object)->tlv_max_encoded_object_length)))
+        {
+            /* TLV object does not fit the app data. */
+            status = TLV_NO_TAG_FOUND;
+        }
+
+        if (TLV_SUCCESS == status)
+        {
+            /* Value is decoded on the first access, the value length is checked now. */
+            status = check_app_data_value_length(p_tlv_app_data, tlv_parsed_object_view.tlv_object_value_length);
+        }
+
+        if (TLV_SUCCESS == status)
+        {
+            store_parsed_app_data(p_tlv_context, &tlv_parsed_object_view, p_tlv_app_data);
+
+            if (TRUE == p_tlv_app_data->b_container)
+            {
+                /* Child app data are searched in order after the tag and length octets of the container (same as tlv_search_tag()). */
+                (void_t)store_parsed_child_app_data(p_tlv_context, p_tlv_data_buffer, buffer_length,
+                    ((uint32_t)(tlv_parsed_object_view.p_tlv_object_encoded_buffer - p_tlv_data_buffer) + tlv_parsed_object_view.tlv_encoded_object_length),
+                    b_recursive, p_tlv_app_data);
+            }
+        }
+
+        return status;
+    }
 
     /* Search and parse TLV object from the TLV data buffer. */
     status = tlv_search_tag(p_tlv_data_buffer, buffer_length, search_parse_tag, b_recursive, p_tlv_app_data->p_tlv_object);
+    if (TLV_SUCCESS == status)
+    {
+        status = check_app_data_value_length(p_tlv_app_data, (p_tlv_app_data->p_tlv_object)->tlv_curr_object_value_length);
+    }
+
     if (TLV_SUCCESS == status)
     {
         /* update app data from the decoded TLV object. */
+        p_tlv_app_data->b_decode_pending = FALSE;
         update_app_data(p_tlv_app_data);
     }
 
     return status;
 }
 
+/* Function to set the lazy decode of the parsed app data of the TLV context. */
+uint32_t tlv_set_lazy_decode_in_context(tlv_context_t * p_tlv_context, bool_t b_lazy_decode)
+{
+    p_tlv_context->b_lazy_decode = b_lazy_decode;
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Function to decode the parsed app data of the TLV context not decoded yet into the application variable. */
+uint32_t tlv_decode_app_data_in_context(tlv_context_t * p_tlv_context, uint32_t app_data_tag)
+{
+    /* Decode on the first access, decoded app data is not decoded again. */
+    decode_pending_app_data(p_tlv_context->tag_to_app_data_map[app_data_tag]);
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
 /* App data constraints verification for the parsed TLV object. */
-static uint32_t check_parsed_tlv_object_app_data(tlv_object_t * p_tlv_parsed_object, tlv_app_data_t ** p_tlv_app_data)
+static uint32_t check_parsed_tlv_object_app_data(const tlv_context_t * p_tlv_context, const tlv_object_view_t * p_tlv_parsed_object, tlv_app_data_t ** p_tlv_app_data)
 {
     TLV_STATUS status = TLV_FAIL;
 
     /* check tag and associated constraints */
-    status = check_tag(p_tlv_parsed_object->tlv_object_tag_number, p_tlv_parsed_object->tlv_curr_object_value_length);
+    status = check_tag(p_tlv_parsed_object->tlv_object_tag_number, p_tlv_parsed_object->tlv_object_value_length);
 
     if (TLV_SUCCESS == status)
     {
         *p_tlv_app_data = NULL;
-        *p_tlv_app_data = tag_to_app_data_map[p_tlv_parsed_object->tlv_object_tag_number];
+        *p_tlv_app_data = p_tlv_context->tag_to_app_data_map[p_tlv_parsed_object->tlv_object_tag_number];
 
         if ((!(*p_tlv_app_data)) && (TAG_INTEGER == p_tlv_parsed_object->tlv_object_tag_number))
         {
-            *p_tlv_app_data = tag_to_app_data_map[TAG_INTEGER_UNSIGNED];
+            *p_tlv_app_data = p_tlv_context->tag_to_app_data_map[TAG_INTEGER_UNSIGNED];
         }
 
         if (!(*p_tlv_app_data))
@@ -121,6 +209,10 @@ static uint32_t check_parsed_tlv_object_app_data(tlv_object_t * p_tlv_parsed_obj
             {
                 status = TLV_NO_TAG_FOUND;
             }
+            else
+            {
+                status = check_app_data_value_length(*p_tlv_app_data, p_tlv_parsed_object->tlv_object_value_length);
+            }
         }
     }
 
@@ -128,16 +220,32 @@ static uint32_t check_parsed_tlv_object_app_data(tlv_object_t * p_tlv_parsed_obj
     return status;
 }
 
-/* Copy the encoded TLV buffer from the parsed TLV object to the app data mapped of the TLV object */
-static void_t copy_tlv_encoded_buffer(tlv_object_t * p_tlv_parsed_object, tlv_app_data_t * p_tlv_app_data)
+/* Check the value length of the parsed TLV object fits the app data (integer value of 1 to app data size octets). */
+static uint32_t check_app_data_value_length(const tlv_app_data_t * p_tlv_app_data, uint32_t value_length)
+{
+    TLV_STATUS status = TLV_SUCCESS;
+
+    /* Integer value octets are decoded into the application variable (1 to MAX_INTEGER_BYTES octets). */
+    if ((FALSE == p_tlv_app_data->b_container) && (TAG_INTEGER == p_tlv_app_data->tag_number) &&
+        ((!value_length) || (value_length > MAX_INTEGER_BYTES) || (value_length > p_tlv_app_data->u_size.data_size)))
+    {
+        status = TLV_BAD_DATA_SIZE;
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Copy the encoded TLV buffer from the parsed TLV object view to the app data mapped of the TLV object */
+static void_t copy_tlv_encoded_buffer(const tlv_object_view_t * p_tlv_parsed_object, tlv_app_data_t * p_tlv_app_data)
 {
     /* Copy TLV encoded buffer */
-    (p_tlv_app_data->p_tlv_object)->tlv_curr_encoded_object_length = p_tlv_parsed_object->tlv_curr_encoded_object_length;
-    (p_tlv_app_data->p_tlv_object)->tlv_curr_object_value_length = p_tlv_parsed_object->tlv_curr_object_value_length;
+    (p_tlv_app_data->p_tlv_object)->tlv_curr_encoded_object_length = p_tlv_parsed_object->tlv_encoded_object_length;
+    (p_tlv_app_data->p_tlv_object)->tlv_curr_object_value_length = p_tlv_parsed_object->tlv_object_value_length;
 
     for (uint32_t i = 0; i < (p_tlv_app_data->p_tlv_object)->tlv_max_encoded_object_length; i++)
     {
-        if (i < p_tlv_parsed_object->tlv_curr_encoded_object_length)
+        if (i < p_tlv_parsed_object->tlv_encoded_object_length)
         {
             (p_tlv_app_data->p_tlv_object)->p_tlv_object_encoded_buffer[i] = p_tlv_parsed_object->p_tlv_object_encoded_buffer[i];
         }
@@ -199,60 +307,108 @@ static void_t update_app_data(tlv_app_data_t * p_tlv_app_data)
 /* Decode and update app data integer value. */
 static void_t update_app_data_integer(tlv_app_data_t * p_tlv_app_data)
 {
-    /* Check the size bit and copy the integer value. */
-    int32_t index = (int32_t)((p_tlv_app_data->p_tlv_object)->tlv_curr_object_value_length - 1U);
-    uint64_t temp_value = 0U;
-    uint64_t signed_value = 0U;
-    for (; index >= 0; index--)
+    /* Decode the integer value octets (sign extended) and copy the decoded value to the application variable, 0 if the value length does not fit. */
+    int64_t decoded_value = decode_integer_octets((p_tlv_app_data->p_tlv_object)->p_tlv_value_buffer,
+        (p_tlv_app_data->p_tlv_object)->tlv_curr_object_value_length);
+
+    store_integer_value(p_tlv_app_data->p_app_data, p_tlv_app_data->u_size.data_size, decoded_value);
+}
+
+/* generic update app data with TLV value. */
+static void_t update_app_data_generic(tlv_app_data_t * p_tlv_app_data)
+{
+    if (FALSE == p_tlv_app_data->b_container)
     {
-        if (index == (int32_t)((p_tlv_app_data->p_tlv_object)->tlv_curr_object_value_length - 1U))
-        {
-            temp_value |= (uint64_t)((p_tlv_app_data->p_tlv_object)->p_tlv_value_buffer[index] & UNSIGNED_VALUE_FILTER_8BIT);
-            signed_value |= (uint64_t)((p_tlv_app_data->p_tlv_object)->p_tlv_value_buffer[index] & SIGNED_FILTER_8BIT);
-        }
-        else
+        for (uint32_t i = 0; i < p_tlv_app_data->u_size.data_size; i++)
         {
-            temp_value = (temp_value << SHIFT_8BIT);
-            signed_value = (signed_value << SHIFT_8BIT);
-            temp_value |= (uint32_t)(p_tlv_app_data->p_tlv_object)->p_tlv_value_buffer[index];
+            if (i < (p_tlv_app_data->p_tlv_object)->tlv_curr_object_value_length)
+            {
+                p_tlv_app_data->p_app_data[i] = (p_tlv_app_data->p_tlv_object)->p_tlv_value_buffer[i];
+            }
+            else
+            {
+                p_tlv_app_data->p_app_data[i] = 0x0U;
+            }
         }
-
     }
+}
 
-    /* get the decoded integer value. */
-    int64_t decoded_value = 0;
-    if (signed_value)
+/* Keep the parsed TLV object view in the app data (lazy decode) or decode it into the app data. */
+static void_t store_parsed_app_data(const tlv_context_t * p_tlv_context, const tlv_object_view_t * p_tlv_parsed_object, tlv_app_data_t * p_tlv_app_data)
+{
+    if ((TRUE == p_tlv_context->b_lazy_decode) && (FALSE == p_tlv_app_data->b_container))
     {
-        decoded_value = (int32_t)(temp_value - signed_value);
+        /* Only the header and the value location are kept, decoded on the first access. */
+        p_tlv_app_data->tlv_pending_object_view = *p_tlv_parsed_object;
+        p_tlv_app_data->b_decode_pending = TRUE;
     }
     else
     {
-        decoded_value = (int32_t)temp_value;
+        /* copy the encoded buffer from TLV object view to app data. */
+        copy_tlv_encoded_buffer(p_tlv_parsed_object, p_tlv_app_data);
+        p_tlv_app_data->b_decode_pending = FALSE;
+
+        /* update app data from the decoded TLV object, with lazy decode the child app data are decoded on access. */
+        if (FALSE == p_tlv_context->b_lazy_decode)
+        {
+            update_app_data(p_tlv_app_data);
+        }
     }
+}
 
-    /* Copy the decoded value */
-    for (uint32_t i = 0; i < p_tlv_app_data->u_size.data_size; i++)
+/* Decode the parsed app data not decoded yet (and the child app data of a container), this is a recursive call for the child containers. */
+static void_t decode_pending_app_data(tlv_app_data_t * p_tlv_app_data)
+{
+    if (TRUE == p_tlv_app_data->b_container)
     {
-        p_tlv_app_data->p_app_data[i] = (uint8_t)(decoded_value & MASK_BIT_0_TO_7);
-        decoded_value = (decoded_value >> SHIFT_8BIT);
+        for (uint32_t i = 0; i < p_tlv_app_data->u_size.child_count; i++)
+        {
+            /* This is a recursive call, please take care of depth and when modifying. */
+            decode_pending_app_data(p_tlv_app_data->p_child_app_data[i]);
+        }
+    }
+    else if (TRUE == p_tlv_app_data->b_decode_pending)
+    {
+        /* copy the encoded buffer from TLV object view to app data and decode the value. */
+        copy_tlv_encoded_buffer(&p_tlv_app_data->tlv_pending_object_view, p_tlv_app_data);
+        update_app_data(p_tlv_app_data);
+        p_tlv_app_data->b_decode_pending = FALSE;
     }
 }
 
-/* generic update app data with TLV value. */
-static void_t update_app_data_generic(tlv_app_data_t * p_tlv_app_data)
+/*
+ * Keep the parsed TLV object views of the child app data of the container (lazy decode), the buffer index is after the tag and length
+ * octets of the container. Each child app data is searched in order from the end of the previous child, a child container keeps the
+ * views of its own child app data. Returns the TLV data buffer index after the end of contents octets of the container.
+ */
+static uint32_t store_parsed_child_app_data(const tlv_context_t * p_tlv_context, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length,
+    uint32_t buffer_index, bool_t b_recursive, tlv_app_data_t * p_container_app_data)
 {
-    if (FALSE == p_tlv_app_data->b_container)
+    for (uint32_t i = 0; (i < p_container_app_data->u_size.child_count) && (buffer_index < buffer_length); i++)
     {
-        for (uint32_t i = 0; i < p_tlv_app_data->u_size.data_size; i++)
+        tlv_app_data_t * p_child_app_data = p_container_app_data->p_child_app_data[i];
+        tlv_object_view_t tlv_parsed_object_view;
+
+        /* Search the tag of the child TLV object (TAG_INTEGER for TAG_INTEGER_UNSIGNED app data). */
+        TLV_STATUS status = tlv_search_tag_view(&p_tlv_data_buffer[buffer_index], (buffer_length - buffer_index),
+            (p_child_app_data->p_tlv_object)->tlv_object_tag_number, b_recursive, &tlv_parsed_object_view);
+
+        if ((TLV_SUCCESS == status) && (tlv_parsed_object_view.b_tlv_container_object == p_child_app_data->b_container) &&
+            (tlv_parsed_object_view.tlv_encoded_object_length <= (p_child_app_data->p_tlv_object)->tlv_max_encoded_object_length) &&
+            (TLV_SUCCESS == check_app_data_value_length(p_child_app_data, tlv_parsed_object_view.tlv_object_value_length)))
         {
-            if (i < (p_tlv_app_data->p_tlv_object)->tlv_curr_object_value_length)
-            {
-                p_tlv_app_data->p_app_data[i] = (p_tlv_app_data->p_tlv_object)->p_tlv_value_buffer[i];
-            }
-            else
+            store_parsed_app_data(p_tlv_context, &tlv_parsed_object_view, p_child_app_data);
+            buffer_index = (uint32_t)(tlv_parsed_object_view.p_tlv_object_encoded_buffer - p_tlv_data_buffer) +
+                tlv_parsed_object_view.tlv_encoded_object_length;
+
+            if (TRUE == p_child_app_data->b_container)
             {
-                p_tlv_app_data->p_app_data[i] = 0x0U;
+                /* This is a recursive call, please take care of depth and when modifying. */
+                buffer_index = store_parsed_child_app_data(p_tlv_context, p_tlv_data_buffer, buffer_length, buffer_index, b_recursive, p_child_app_data);
             }
         }
     }
+
+    /* The search of the parent continues after the end of contents octets of the container. */
+    return skip_indefinite_length_tlv_object(p_tlv_data_buffer, buffer_length, buffer_index);
 }
@@ -9,8 +9,15 @@
  * Author: Hemant Pundpal                            Date: 03 Mar 2019
  *
  */
+#include <string.h>
+
 #include "tlv_app_data_api.h"
 
+#if (0 < TLV_SEND_WRITEV)
+#include <fcntl.h>
+#include <unistd.h>
+#endif /* TLV_SEND_WRITEV */
+
 #define MAX_TXN_REF_LEN         7U
 #define MAX_ADDNL_TXN_REF_LEN   10U
 
@@ -35,6 +42,9 @@ typedef struct additional_transaction_data
 addnl_txn_data_t addnl_txn_info;
 
 void parse_data_received();
+void check_lazy_decode();
+void check_lazy_decode_of_tag(uint8_t * p_tlv_buffer, uint32_t buffer_length, uint32_t tag, bool_t b_recursive);
+void check_send_fd();
 
 int main()
 {
@@ -196,6 +206,12 @@ int main()
 
     /* Parsing received set of data. */
     parse_data_received();
+
+    /* Lazy decode of the received containers. */
+    check_lazy_decode();
+
+    /* Send the container to a pipe. */
+    check_send_fd();
     return 0;
 }
 
@@ -377,3 +393,114 @@ void parse_data_received()
         printf("Integer value is: %d \n", addnl_txn_info.txn_tax_type);
     }
 }
+
+void check_lazy_decode()
+{
+    /*
+     * - This demo checks the lazy decode of the received containers.
+     * - With lazy decode the search keeps the location of the container and its child TLV objects, the values are decoded into the
+     * application variables by tlv_decode_app_data(). The decoded values should be same as the values decoded by the search.
+     */
+    printf("\nDEMO FOR LAZY DECODE OF CONTAINER TLV OBJECTS********************************\n\n");
+    check_lazy_decode_of_tag(tlv_buffer_2, sizeof(tlv_buffer_2), TAG_APP_ADDNL_TXN_INFO, TRUE);
+    check_lazy_decode_of_tag(tlv_buffer_5, sizeof(tlv_buffer_5), TAG_APP_TXN_INFO, FALSE);
+}
+
+void check_lazy_decode_of_tag(uint8_t * p_tlv_buffer, uint32_t buffer_length, uint32_t tag, bool_t b_recursive)
+{
+    txn_data_t eager_txn_info;
+    addnl_txn_data_t eager_addnl_txn_info;
+
+    /* Decode by the search. */
+    tlv_set_lazy_decode(FALSE);
+    memset(&txn_info, 0, sizeof(txn_info));
+    memset(&addnl_txn_info, 0, sizeof(addnl_txn_info));
+    if (TLV_SUCCESS != tlv_search_parse_app_data(p_tlv_buffer, buffer_length, tag, b_recursive))
+    {
+        printf("Received TAG (%d) not found \n", tag);
+        return;
+    }
+    memcpy(&eager_txn_info, &txn_info, sizeof(txn_info));
+    memcpy(&eager_addnl_txn_info, &addnl_txn_info, sizeof(addnl_txn_info));
+
+    /* Lazy decode, nothing is decoded by the search. */
+    tlv_set_lazy_decode(TRUE);
+    memset(&txn_info, 0, sizeof(txn_info));
+    memset(&addnl_txn_info, 0, sizeof(addnl_txn_info));
+    if ((TLV_SUCCESS == tlv_search_parse_app_data(p_tlv_buffer, buffer_length, tag, b_recursive)) &&
+        (TLV_SUCCESS == tlv_decode_app_data(tag)) &&
+        (!memcmp(&eager_txn_info, &txn_info, sizeof(txn_info))) &&
+        (!memcmp(&eager_addnl_txn_info, &addnl_txn_info, sizeof(addnl_txn_info))))
+    {
+        printf("Received TAG (%d) - lazy decode is same as decode by the search \n", tag);
+    }
+    else
+    {
+        printf("Received TAG (%d) - lazy decode is NOT same as decode by the search \n", tag);
+    }
+    tlv_set_lazy_decode(FALSE);
+}
+
+void check_send_fd()
+{
+    /*
+     * - This demo sends the container app data to a pipe with tlv_app_data_send_fd() (writev() of the send vector) and reads it back,
+     * the octets read should be same as the octets of the send vector.
+     * - A full pipe of a non-blocking file descriptor fails with TLV_SEND_FAILED, the octets already written are returned.
+     */
+    printf("\nDEMO FOR SEND OF APP DATA TO A FILE DESCRIPTOR*******************************\n\n");
+#if (0 < TLV_SEND_WRITEV)
+    tlv_send_vector_t send_vector[TLV_SEND_MAX_VECTOR_COUNT];
+    uint8_t send_buffer[256];
+    uint8_t read_buffer[256];
+    uint32_t vector_count = 0U;
+    uint32_t send_length = 0U;
+    uint32_t sent_length = 0U;
+    uint32_t status = TLV_FAIL;
+    int pipe_fd[2];
+
+    if (0 != pipe(pipe_fd))
+    {
+        printf("Cannot create pipe \n");
+        return;
+    }
+
+    /* Octets of the message, the send vector entries point at the encoded TLV objects. */
+    if (TLV_SUCCESS == tlv_app_data_build_send_vector(TAG_APP_TXN_INFO, send_vector, TLV_SEND_MAX_VECTOR_COUNT, &vector_count))
+    {
+        for (uint32_t i = 0; (i < vector_count) && ((send_length + send_vector[i].iov_len) <= sizeof(send_buffer)); i++)
+        {
+            memcpy(&send_buffer[send_length], send_vector[i].iov_base, send_vector[i].iov_len);
+            send_length += (uint32_t)send_vector[i].iov_len;
+        }
+    }
+
+    status = tlv_app_data_send_fd(TAG_APP_TXN_INFO, pipe_fd[1], &sent_length);
+    if ((TLV_SUCCESS == status) && (sent_length == send_length) &&
+        ((ssize_t)sent_length == read(pipe_fd[0], read_buffer, sizeof(read_buffer))) && (!memcmp(send_buffer, read_buffer, sent_length)))
+    {
+        printf("Sent Container TAG (%d) to pipe - %u octets in %u send vector entries, read back same octets \n", TAG_APP_TXN_INFO,
+            sent_length, vector_count);
+    }
+    else
+    {
+        printf("Sent Container TAG (%d) to pipe - status (0x%X), %u of %u octets - NOT same \n", TAG_APP_TXN_INFO, status, sent_length, send_length);
+    }
+
+    /* Fill the pipe of the non-blocking file descriptor, writev() fails with EAGAIN. */
+    (void)fcntl(pipe_fd[1], F_SETFL, (fcntl(pipe_fd[1], F_GETFL) | O_NONBLOCK));
+    memset(read_buffer, 0, sizeof(read_buffer));
+    while (0 < write(pipe_fd[1], read_buffer, sizeof(read_buffer)))
+    {
+    }
+
+    status = tlv_app_data_send_fd(TAG_APP_TXN_INFO, pipe_fd[1], &sent_length);
+    printf("Sent Container TAG (%d) to full pipe (non-blocking) - status (0x%X), %u octets sent - %s \n", TAG_APP_TXN_INFO, status,
+        sent_length, (TLV_SEND_FAILED == status) ? "send failed as expected" : "NOT failed");
+
+    (void)close(pipe_fd[0]);
+    (void)close(pipe_fd[1]);
+#else
+    printf("No writev() on the target \n");
+#endif /* TLV_SEND_WRITEV */
+}
@@ -41,6 +41,12 @@
 uint32_t create_application_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_buffer, uint32_t buffer_length);
 
 
+/*
+ * Function to create application class or context specific class container TLV object of definite or indefinite length.
+ * Note: The length octets of a definite length container TLV object are encoded when it is measured (get_tlv_object_encoded_length()).
+ */
+uint32_t create_application_tlv_container(tlv_object_t * p_tlv_object, uint32_t tlv_tag, bool_t b_length_definite);
+
 /* Encode the definite length value into TLV object. */
 void_t add_data_to_definite_length_application_tlv_object(tlv_object_t * p_tlv_object, const uint8_t * p_tlv_buffer, uint32_t buffer_length);
 
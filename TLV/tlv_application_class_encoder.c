@@ -14,12 +14,6 @@
 #include "tlv_application_class.h"
 #include "tlv_definition.h"
 
-/*
- * Create indefinite length application class TLV object.
- * This function can also create indefinite length context specific class TLV object.
- */
-static uint32_t create_indefinite_length_application_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag);
-
 /*
  * Create definite length application class TLV object.
  * This function can also create definite length context specific class TLV object.
@@ -62,19 +56,20 @@ uint32_t create_application_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv
    }
    else
    {
-       /* Not Supported. */
-       p_tlv_object->b_tlv_object_length_definite = FALSE;
-       status = create_indefinite_length_application_tlv_object(p_tlv_object, tlv_tag);
+       /* Indefinite length container TLV object. */
+       status = create_application_tlv_container(p_tlv_object, tlv_tag, FALSE);
    }
 
     return status;
 }
 
-/* 
- * Create indefinite length application class TLV object.
- * This function can also create indefinite length context specific class TLV object.
+/*
+ * Create application class container TLV object of definite or indefinite length.
+ * This function can also create context specific class container TLV object.
+ * Note: The length octets of a definite length container TLV object are encoded when the container TLV object is measured
+ * (after the child TLV objects are added), room for the longest length octets is allocated.
  */
-static uint32_t create_indefinite_length_application_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag)
+uint32_t create_application_tlv_container(tlv_object_t * p_tlv_object, uint32_t tlv_tag, bool_t b_length_definite)
 {
     TLV_STATUS status = TLV_FAIL;
 
@@ -82,11 +77,12 @@ static uint32_t create_indefinite_length_application_tlv_object(tlv_object_t * p
 
     uint32_t tag_octets = 0;
     tag_octets = get_tag_octets(tlv_tag);
-    uint32_t tlv_encoded_buffer_length = (tag_octets + VALUE_LENGTH_1OCTET);
+    uint32_t length_octets = (TRUE == b_length_definite) ? get_length_octets(APP_TAG_MAX_VALUE_LENGTH) : VALUE_LENGTH_1OCTET;
+    uint32_t tlv_encoded_buffer_length = (tag_octets + length_octets);
 
     /* Allocate the TLV encoded buffer. */
     p_tlv_object->p_tlv_object_encoded_buffer = NULL;
-    p_tlv_object->p_tlv_object_encoded_buffer = (uint8_t *)calloc(tlv_encoded_buffer_length, sizeof(uint8_t));
+    p_tlv_object->p_tlv_object_encoded_buffer = (uint8_t *)allocate_tlv_memory(p_tlv_object->p_tlv_arena, tlv_encoded_buffer_length);
 
     if (p_tlv_object->p_tlv_object_encoded_buffer != NULL)
     {
@@ -94,52 +90,19 @@ static uint32_t create_indefinite_length_application_tlv_object(tlv_object_t * p
         p_tlv_object->b_tlv_has_a_parent = FALSE;
         p_tlv_object->p_tlv_parent_tlv_object = NULL;
 
-        /* Initialize the tLV encoded buffer. */
+        /* Initialize the tLV encoded buffer (no child TLV objects, value length is 0). */
         p_tlv_object->tlv_max_encoded_object_length = tlv_encoded_buffer_length;
-        p_tlv_object->tlv_curr_encoded_object_length = tlv_encoded_buffer_length;
+        p_tlv_object->tlv_curr_encoded_object_length = (tag_octets + VALUE_LENGTH_1OCTET);
         p_tlv_object->tlv_tag_length = tag_octets;
-        p_tlv_object->tlv_max_length_of_endcoded_value_length = VALUE_LENGTH_1OCTET;
-
-        if (tlv_tag < TAG_APP_CLS_MAX)
-        {
-            /* Add application constructed TLV object tag number and class. */
-            p_tlv_object->p_tlv_object_encoded_buffer[0] = (uint8_t)TAG_APPL_CLS_CONSTRUCTED | (uint8_t)TAG_EXTENDED_BYTES;
-        }
-        else if (tlv_tag < TAG_CONT_SPCF_CLS_MAX)
-        {
-            /* Add context specific constructed TLV object tag number and class. */
-            p_tlv_object->p_tlv_object_encoded_buffer[0] = (uint8_t)TAG_CS_CLS_CONSTRUCTED | (uint8_t)TAG_EXTENDED_BYTES;
-        }
-        else
-        {
-            /* do nothing */
-            /* validity of the tag is checked in error check functions. */
-        }
+        p_tlv_object->tlv_max_length_of_endcoded_value_length = length_octets;
+        p_tlv_object->b_tlv_object_length_definite = b_length_definite;
 
-        switch (p_tlv_object->tlv_tag_length)
-        {
-            case TAG_2OCTET:
-            {
-                /* encode the tag. */
-                p_tlv_object->p_tlv_object_encoded_buffer[1] = (uint8_t)tlv_tag;
-            }
-            break;
-            case TAG_3OCTET:
-            {
-                /* encode the tag. */
-                p_tlv_object->p_tlv_object_encoded_buffer[1] = (uint8_t)((tlv_tag & MSB_FILTER_8BIT) >> SHIFT_TO_BIT_7);
-                p_tlv_object->p_tlv_object_encoded_buffer[1] |= (uint8_t)(LONG_LENGTH_FORM);
-                p_tlv_object->p_tlv_object_encoded_buffer[2] = (uint8_t)(tlv_tag & LENGTH_FILTER);
-            }
-            break;
-            default:
-            {
-                /* do nothing. */
-            }
-        }
+        /* Add application or context specific constructed TLV object tag number and class. */
+        (void_t)encode_tag_octets(p_tlv_object->p_tlv_object_encoded_buffer, tlv_tag);
 
-        /* encode the indefinite length. */
-        p_tlv_object->p_tlv_object_encoded_buffer[p_tlv_object->tlv_tag_length] = (uint8_t)INDEFINITE_LENGTH;
+        /* encode the indefinite length (or the definite length of no child TLV objects). */
+        p_tlv_object->p_tlv_object_encoded_buffer[p_tlv_object->tlv_tag_length] =
+            (TRUE == b_length_definite) ? (uint8_t)0x0U : (uint8_t)INDEFINITE_LENGTH;
 
         /* Setup TLV object as container. */
         p_tlv_object->b_tlv_container_object = TRUE;
@@ -188,7 +151,7 @@ static uint32_t create_definite_length_application_tlv_object(tlv_object_t * p_t
 
     uint32_t tlv_encoded_buffer_length = tag_octets + length_octets + buffer_length;
     p_tlv_object->p_tlv_object_encoded_buffer = NULL;
-    p_tlv_object->p_tlv_object_encoded_buffer = (uint8_t *)calloc(tlv_encoded_buffer_length, sizeof(uint8_t));
+    p_tlv_object->p_tlv_object_encoded_buffer = (uint8_t *)allocate_tlv_memory(p_tlv_object->p_tlv_arena, tlv_encoded_buffer_length);
 
     if (p_tlv_object->p_tlv_object_encoded_buffer != NULL)
     {
@@ -208,46 +171,8 @@ static uint32_t create_definite_length_application_tlv_object(tlv_object_t * p_t
         /* save max length (number of octets) of the encoded value length. */
         p_tlv_object->tlv_max_length_of_endcoded_value_length = length_octets;
 
-        /* Add tag number and class. */
-
-        if (tlv_tag < TAG_APP_CLS_MAX)
-        {
-            /* Add application constructed TLV object tag number and class. */
-            p_tlv_object->p_tlv_object_encoded_buffer[0] = (uint8_t)TAG_APPL_CLS_CONSTRUCTED | (uint8_t)TAG_EXTENDED_BYTES;
-        }
-        else if (tlv_tag < TAG_CONT_SPCF_CLS_MAX)
-        {
-            /* Add context specific constructed TLV object tag number and class. */
-            p_tlv_object->p_tlv_object_encoded_buffer[0] = (uint8_t)TAG_CS_CLS_CONSTRUCTED | (uint8_t)TAG_EXTENDED_BYTES;
-        }
-        else
-        {
-            /* do nothing */
-            /* validity of the tag is checked in error check functions. */
-        }
-
-        /* Encode the tag */
-        switch (p_tlv_object->tlv_tag_length)
-        {
-            case TAG_2OCTET:
-            {
-                /* encode the tag. */
-                p_tlv_object->p_tlv_object_encoded_buffer[1] = (uint8_t)tlv_tag;
-            }
-            break;
-            case TAG_3OCTET:
-            {
-                /* encode the tag. */
-                p_tlv_object->p_tlv_object_encoded_buffer[1] = (uint8_t)((tlv_tag & MSB_FILTER_8BIT) >> SHIFT_TO_BIT_7);
-                p_tlv_object->p_tlv_object_encoded_buffer[1] |= (uint8_t)(LONG_LENGTH_FORM);
-                p_tlv_object->p_tlv_object_encoded_buffer[2] = (uint8_t)(tlv_tag & LENGTH_FILTER);
-            }
-            break;
-            default:
-            {
-                /* do nothing. */
-            }
-        }
+        /* Add application or context specific constructed TLV object tag number and class. */
+        (void_t)encode_tag_octets(p_tlv_object->p_tlv_object_encoded_buffer, tlv_tag);
 
         p_tlv_object->b_tlv_container_object = FALSE;
         p_tlv_object->tlv_child_Count = 0;
@@ -278,35 +203,8 @@ void_t add_data_to_definite_length_application_tlv_object(tlv_object_t * p_tlv_o
     uint32_t length_octets = 0;
     length_octets = get_length_octets(buffer_length);
 
-    switch (length_octets)
-    {
-        case VALUE_LENGTH_1OCTET:
-        {
-            /* Add length of the tag value. */
-            p_tlv_object->p_tlv_object_encoded_buffer[p_tlv_object->tlv_tag_length] = (uint8_t)buffer_length;
-        }
-        break;
-        case VALUE_LENGTH_2OCTET:
-        {
-            /* Add length of the tag value. */
-            p_tlv_object->p_tlv_object_encoded_buffer[p_tlv_object->tlv_tag_length] = (uint8_t)LONG_LENGTH_FORM | (uint8_t)VALUE_LENGTH_1OCTET;
-            p_tlv_object->p_tlv_object_encoded_buffer[(p_tlv_object->tlv_tag_length + 1U)] = (uint8_t)buffer_length;
-        }
-        break;
-        case VALUE_LENGTH_3OCTET:
-        {
-            /* Add length of the tag value. */
-            p_tlv_object->p_tlv_object_encoded_buffer[p_tlv_object->tlv_tag_length] = (uint8_t)LONG_LENGTH_FORM | (uint8_t)VALUE_LENGTH_2OCTET;
-            p_tlv_object->p_tlv_object_encoded_buffer[(p_tlv_object->tlv_tag_length + 1U)] = (uint8_t)((buffer_length & MASK_BIT_8_TO_15) >> SHIFT_8BIT);
-            p_tlv_object->p_tlv_object_encoded_buffer[(p_tlv_object->tlv_tag_length + 2U)] = (uint8_t)(buffer_length & MASK_BIT_0_TO_7);
-        }
-        break;
-        default:
-        {
-            /* do nothing. */
-            /* validity of the buffer length is checked in error check functions. */
-        }
-    }
+    /* Add length of the tag value. */
+    (void_t)encode_length_octets(&p_tlv_object->p_tlv_object_encoded_buffer[p_tlv_object->tlv_tag_length], buffer_length);
 
     /* Save start of value buffer. */
     p_tlv_object->p_tlv_value_buffer = &(p_tlv_object->p_tlv_object_encoded_buffer[(p_tlv_object->tlv_tag_length + length_octets)]);
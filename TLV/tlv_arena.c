@@ -0,0 +1,78 @@
+/*
+ * Name: tlv_arena.c
+ *
+ * Description:
+ * All API definitions required for the TLV arena (bump allocator for TLV objects of one message).
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#define TLV_OBJECT_SOURCE_CODE
+
+#include <string.h>
+
+#include "tlv_api.h"
+#include "tlv.h"
+#include "tlv_definition.h"
+
+/* Function to initialize the TLV arena on the application provided memory. */
+uint32_t tlv_arena_init(tlv_arena_t * p_tlv_arena, uint8_t * p_arena_buffer, uint32_t arena_size)
+{
+    p_tlv_arena->p_arena_buffer = p_arena_buffer;
+    p_tlv_arena->arena_size = arena_size;
+    p_tlv_arena->arena_used_size = 0U;
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Function to reset the TLV arena, all the memory allocated from the TLV arena is released at once. */
+uint32_t tlv_arena_reset(tlv_arena_t * p_tlv_arena)
+{
+    p_tlv_arena->arena_used_size = 0U;
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Allocate zero initialized memory from the TLV arena (from heap if the TLV arena is NULL), returns NULL if no memory. */
+void_t * allocate_tlv_memory(tlv_arena_t * p_tlv_arena, uint32_t size)
+{
+    void_t * p_memory = NULL;
+
+    if (!p_tlv_arena)
+    {
+        /* No TLV arena, allocate from heap with the TLV allocator. */
+        p_memory = allocate_tlv_heap_memory(size);
+        if (p_memory)
+        {
+            memset(p_memory, 0, size);
+        }
+    }
+    else
+    {
+        /* Align the allocation, the TLV objects can be allocated from the TLV arena. */
+        size_t address = (size_t)&p_tlv_arena->p_arena_buffer[p_tlv_arena->arena_used_size];
+        uint32_t padding = (uint32_t)((TLV_ARENA_ALIGNMENT - (address & (TLV_ARENA_ALIGNMENT - 1U))) & (TLV_ARENA_ALIGNMENT - 1U));
+
+        if ((padding + size) <= (p_tlv_arena->arena_size - p_tlv_arena->arena_used_size))
+        {
+            p_memory = &p_tlv_arena->p_arena_buffer[p_tlv_arena->arena_used_size + padding];
+            memset(p_memory, 0, size);
+            p_tlv_arena->arena_used_size += (padding + size);
+        }
+    }
+
+    /* Return allocated memory. */
+    return p_memory;
+}
+
+/* Free memory allocated with allocate_tlv_memory() from heap (memory allocated from the TLV arena is released on reset). */
+void_t free_tlv_memory(tlv_arena_t * p_tlv_arena, void_t * p_memory)
+{
+    if ((!p_tlv_arena) && (p_memory))
+    {
+        free_tlv_heap_memory(p_memory);
+    }
+}
@@ -0,0 +1,279 @@
+/*
+ * Name: tlv_batch.c
+ *
+ * Description:
+ * All API definitions required for the TLV batch decode (a batch of messages decoded by a pool of worker threads).
+ * Each message is decoded into its own TLV index (no shared state and no memory allocated per message), the worker
+ * threads claim the messages of the batch in chunks.
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#define TLV_OBJECT_SOURCE_CODE
+
+#include "tlv_api.h"
+#include "tlv.h"
+#include "tlv_definition.h"
+
+#if (0 < TLV_BATCH_THREAD_POOL)
+#include <pthread.h>
+#endif /* TLV_BATCH_THREAD_POOL */
+
+/* Number of messages claimed at a time by a thread (keeps the batch lock out of the decode). */
+#define TLV_BATCH_CHUNK_MESSAGE_COUNT   16U
+
+/* TLV batch pool. */
+struct tlv_batch_pool
+{
+#if (0 < TLV_BATCH_THREAD_POOL)
+    /* Worker threads. */
+    pthread_t                 worker_thread[TLV_BATCH_MAX_WORKER_THREADS];
+    uint32_t                  worker_thread_count;
+
+    /*
+     * Batch lock and conditions, the batch generation is incremented for each batch (wakes up the worker threads)
+     * and the last active worker thread signals the batch is done.
+     */
+    pthread_mutex_t           batch_mutex;
+    pthread_cond_t            batch_start_cond;
+    pthread_cond_t            batch_done_cond;
+    uint32_t                  batch_generation;
+    uint32_t                  active_worker_count;
+    bool_t                    b_shutdown;
+#endif /* TLV_BATCH_THREAD_POOL */
+
+    /* Current batch, next message to be claimed and number of messages not decoded. */
+    tlv_batch_message_t     * p_tlv_batch_messages;
+    uint32_t                  message_count;
+    uint32_t                  next_message_index;
+    uint32_t                  failed_message_count;
+    tlv_batch_callback_t      p_callback;
+    void_t                  * p_callback_data;
+};
+
+/* Decode the messages of the current batch, messages are claimed in chunks until all are claimed. */
+static void_t decode_tlv_batch_messages(tlv_batch_pool_t * p_tlv_batch_pool);
+
+#if (0 < TLV_BATCH_THREAD_POOL)
+/* Worker thread, decodes the messages of each batch. */
+static void_t * tlv_batch_worker_thread(void_t * p_thread_data);
+#endif /* TLV_BATCH_THREAD_POOL */
+
+/* Function to create the TLV batch pool with the worker threads. */
+uint32_t tlv_batch_pool_create(uint32_t worker_thread_count, tlv_batch_pool_t ** pp_tlv_batch_pool)
+{
+    TLV_STATUS status = TLV_SUCCESS;
+    tlv_batch_pool_t * p_tlv_batch_pool = (tlv_batch_pool_t *)allocate_tlv_memory(NULL, (uint32_t)sizeof(tlv_batch_pool_t));
+
+    if (!p_tlv_batch_pool)
+    {
+        return TLV_NO_MEMORY;
+    }
+
+#if (0 < TLV_BATCH_THREAD_POOL)
+    pthread_mutex_init(&p_tlv_batch_pool->batch_mutex, NULL);
+    pthread_cond_init(&p_tlv_batch_pool->batch_start_cond, NULL);
+    pthread_cond_init(&p_tlv_batch_pool->batch_done_cond, NULL);
+
+    for (uint32_t i = 0U; i < worker_thread_count; i++)
+    {
+        if (pthread_create(&p_tlv_batch_pool->worker_thread[i], NULL, tlv_batch_worker_thread, p_tlv_batch_pool))
+        {
+            status = TLV_FAIL;
+            break;
+        }
+        p_tlv_batch_pool->worker_thread_count++;
+    }
+
+    if (TLV_SUCCESS != status)
+    {
+        /* Stop the created worker threads. */
+        (void_t)tlv_batch_pool_destroy(p_tlv_batch_pool);
+        p_tlv_batch_pool = NULL;
+    }
+#else
+    (void_t)worker_thread_count;
+#endif /* TLV_BATCH_THREAD_POOL */
+
+    *pp_tlv_batch_pool = p_tlv_batch_pool;
+
+    /* Return status. */
+    return status;
+}
+
+/*
+ * Function to decode a batch of messages with the TLV batch pool, the calling thread decodes with the worker threads.
+ * Note: One batch is decoded at a time by the TLV batch pool, tlv_batch_decode() should not be called from multiple threads.
+ */
+uint32_t tlv_batch_decode(tlv_batch_pool_t * p_tlv_batch_pool, tlv_batch_message_t * p_tlv_batch_messages, uint32_t message_count,
+    tlv_batch_callback_t p_callback, void_t * p_callback_data)
+{
+    TLV_STATUS status = TLV_SUCCESS;
+
+#if (0 < TLV_BATCH_THREAD_POOL)
+    /* Start the batch, wake up the worker threads. */
+    pthread_mutex_lock(&p_tlv_batch_pool->batch_mutex);
+#endif /* TLV_BATCH_THREAD_POOL */
+    p_tlv_batch_pool->p_tlv_batch_messages = p_tlv_batch_messages;
+    p_tlv_batch_pool->message_count = message_count;
+    p_tlv_batch_pool->next_message_index = 0U;
+    p_tlv_batch_pool->failed_message_count = 0U;
+    p_tlv_batch_pool->p_callback = p_callback;
+    p_tlv_batch_pool->p_callback_data = p_callback_data;
+#if (0 < TLV_BATCH_THREAD_POOL)
+    p_tlv_batch_pool->batch_generation++;
+    pthread_cond_broadcast(&p_tlv_batch_pool->batch_start_cond);
+    pthread_mutex_unlock(&p_tlv_batch_pool->batch_mutex);
+#endif /* TLV_BATCH_THREAD_POOL */
+
+    decode_tlv_batch_messages(p_tlv_batch_pool);
+
+#if (0 < TLV_BATCH_THREAD_POOL)
+    /*
+     * All the messages are claimed, wait for the worker threads decoding the claimed messages.
+     * Note: A worker thread that wakes up after this has no message to claim.
+     */
+    pthread_mutex_lock(&p_tlv_batch_pool->batch_mutex);
+    while (p_tlv_batch_pool->active_worker_count)
+    {
+        pthread_cond_wait(&p_tlv_batch_pool->batch_done_cond, &p_tlv_batch_pool->batch_mutex);
+    }
+#endif /* TLV_BATCH_THREAD_POOL */
+    if (p_tlv_batch_pool->failed_message_count)
+    {
+        status = TLV_FAIL;
+    }
+#if (0 < TLV_BATCH_THREAD_POOL)
+    pthread_mutex_unlock(&p_tlv_batch_pool->batch_mutex);
+#endif /* TLV_BATCH_THREAD_POOL */
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to destroy the TLV batch pool, worker threads are stopped and joined. */
+uint32_t tlv_batch_pool_destroy(tlv_batch_pool_t * p_tlv_batch_pool)
+{
+#if (0 < TLV_BATCH_THREAD_POOL)
+    pthread_mutex_lock(&p_tlv_batch_pool->batch_mutex);
+    p_tlv_batch_pool->b_shutdown = TRUE;
+    pthread_cond_broadcast(&p_tlv_batch_pool->batch_start_cond);
+    pthread_mutex_unlock(&p_tlv_batch_pool->batch_mutex);
+
+    for (uint32_t i = 0U; i < p_tlv_batch_pool->worker_thread_count; i++)
+    {
+        pthread_join(p_tlv_batch_pool->worker_thread[i], NULL);
+    }
+
+    pthread_cond_destroy(&p_tlv_batch_pool->batch_done_cond);
+    pthread_cond_destroy(&p_tlv_batch_pool->batch_start_cond);
+    pthread_mutex_destroy(&p_tlv_batch_pool->batch_mutex);
+#endif /* TLV_BATCH_THREAD_POOL */
+
+    free_tlv_memory(NULL, p_tlv_batch_pool);
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Decode the messages of the current batch, messages are claimed in chunks until all are claimed. */
+static void_t decode_tlv_batch_messages(tlv_batch_pool_t * p_tlv_batch_pool)
+{
+    while (TRUE)
+    {
+        uint32_t first_message_index = 0U;
+        uint32_t end_message_index = 0U;
+        uint32_t failed_message_count = 0U;
+
+        /* Claim the next chunk of messages. */
+#if (0 < TLV_BATCH_THREAD_POOL)
+        pthread_mutex_lock(&p_tlv_batch_pool->batch_mutex);
+#endif /* TLV_BATCH_THREAD_POOL */
+        first_message_index = p_tlv_batch_pool->next_message_index;
+        end_message_index = p_tlv_batch_pool->message_count;
+        if ((end_message_index - first_message_index) > TLV_BATCH_CHUNK_MESSAGE_COUNT)
+        {
+            end_message_index = first_message_index + TLV_BATCH_CHUNK_MESSAGE_COUNT;
+        }
+        p_tlv_batch_pool->next_message_index = end_message_index;
+#if (0 < TLV_BATCH_THREAD_POOL)
+        pthread_mutex_unlock(&p_tlv_batch_pool->batch_mutex);
+#endif /* TLV_BATCH_THREAD_POOL */
+
+        if (first_message_index == end_message_index)
+        {
+            /* All the messages of the batch are claimed. */
+            break;
+        }
+
+        /* Decode the claimed messages, each into its own TLV index. */
+        for (uint32_t i = first_message_index; i < end_message_index; i++)
+        {
+            tlv_batch_message_t * p_tlv_batch_message = &p_tlv_batch_pool->p_tlv_batch_messages[i];
+
+            p_tlv_batch_message->decode_status = tlv_index_build(&p_tlv_batch_message->tlv_index, p_tlv_batch_message->p_tlv_data_buffer,
+                p_tlv_batch_message->buffer_length, p_tlv_batch_message->p_tlv_index_nodes, p_tlv_batch_message->max_node_count);
+            if (TLV_SUCCESS != p_tlv_batch_message->decode_status)
+            {
+                failed_message_count++;
+            }
+
+            if (p_tlv_batch_pool->p_callback)
+            {
+                p_tlv_batch_pool->p_callback(p_tlv_batch_message, p_tlv_batch_pool->p_callback_data);
+            }
+        }
+
+        if (failed_message_count)
+        {
+#if (0 < TLV_BATCH_THREAD_POOL)
+            pthread_mutex_lock(&p_tlv_batch_pool->batch_mutex);
+#endif /* TLV_BATCH_THREAD_POOL */
+            p_tlv_batch_pool->failed_message_count += failed_message_count;
+#if (0 < TLV_BATCH_THREAD_POOL)
+            pthread_mutex_unlock(&p_tlv_batch_pool->batch_mutex);
+#endif /* TLV_BATCH_THREAD_POOL */
+        }
+    }
+}
+
+#if (0 < TLV_BATCH_THREAD_POOL)
+/* Worker thread, waits for a batch (or shutdown) and decodes the messages of the batch with the other threads. */
+static void_t * tlv_batch_worker_thread(void_t * p_thread_data)
+{
+    tlv_batch_pool_t * p_tlv_batch_pool = (tlv_batch_pool_t *)p_thread_data;
+    uint32_t batch_generation = 0U;
+
+    pthread_mutex_lock(&p_tlv_batch_pool->batch_mutex);
+    batch_generation = p_tlv_batch_pool->batch_generation;
+    while (TRUE)
+    {
+        while ((FALSE == p_tlv_batch_pool->b_shutdown) && (batch_generation == p_tlv_batch_pool->batch_generation))
+        {
+            pthread_cond_wait(&p_tlv_batch_pool->batch_start_cond, &p_tlv_batch_pool->batch_mutex);
+        }
+
+        if (TRUE == p_tlv_batch_pool->b_shutdown)
+        {
+            break;
+        }
+
+        batch_generation = p_tlv_batch_pool->batch_generation;
+        p_tlv_batch_pool->active_worker_count++;
+        pthread_mutex_unlock(&p_tlv_batch_pool->batch_mutex);
+
+        decode_tlv_batch_messages(p_tlv_batch_pool);
+
+        pthread_mutex_lock(&p_tlv_batch_pool->batch_mutex);
+        p_tlv_batch_pool->active_worker_count--;
+        if (!p_tlv_batch_pool->active_worker_count)
+        {
+            pthread_cond_signal(&p_tlv_batch_pool->batch_done_cond);
+        }
+    }
+    pthread_mutex_unlock(&p_tlv_batch_pool->batch_mutex);
+
+    return NULL;
+}
+#endif /* TLV_BATCH_THREAD_POOL */
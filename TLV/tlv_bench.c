@@ -0,0 +1,806 @@
+/*
+ * Name: tlv_bench.c
+ *
+ * Description:
+ * TLV encode and decode benchmark over synthetic message corpora.
+ * - corpora of configurable shape: flat, deeply nested, many small integers and large strings.
+ * - encode with the TLV writer and with TLV objects (heap and TLV arena).
+ * - decode into a TLV index and into TLV objects (heap and TLV arena).
+ * - messages/sec, bytes/sec, heap allocations and allocated octets per message and p50 / p99 per message latency.
+ * - integer value encode and decode (tlv_integer.h) per value width (1 to MAX_INTEGER_BYTES octets), against the octet by octet
+ *   loops of the earlier integer encoder and decoder.
+ *
+ * Results are printed as JSON (parameters and one object per benchmark and shape) so that results can be
+ * compared across versions.
+ *
+ * Usage: tlv_bench [messages] [field_count] [nesting_depth] [string_length]
+ *
+ * Note: Heap allocations of the TLV module are counted with the TLV counting allocator.
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <string.h>
+#include <time.h>
+
+#include "tlv_api.h"
+#include "tlv_integer.h"
+
+#define BENCH_DEFAULT_MESSAGES          200000U
+#define BENCH_DEFAULT_FIELD_COUNT       16U
+#define BENCH_DEFAULT_NESTING_DEPTH     6U
+#define BENCH_DEFAULT_STRING_LENGTH     1024U
+#define BENCH_LATENCY_SAMPLES           100000U
+
+/* Number of distinct messages in a corpus, the messages are encoded and decoded round robin. */
+#define BENCH_CORPUS_MESSAGES           64U
+
+/* Limits of a message (fields, nesting depth and string length). */
+#define BENCH_MAX_FIELD_COUNT           256U
+#define BENCH_MAX_MESSAGE_FIELDS        ((BENCH_MAX_FIELD_COUNT * 4U) + 2U)
+#define BENCH_MAX_NESTING_DEPTH         (TLV_WRITER_MAX_CONTAINER_DEPTH - 1U)
+#define BENCH_MAX_STRING_LENGTH         65536U
+#define BENCH_MAX_MESSAGE_LENGTH        ((BENCH_MAX_FIELD_COUNT * (BENCH_MAX_STRING_LENGTH + 8U)) / 4U)
+
+/* Size of the TLV arena of one message. */
+#define BENCH_ARENA_SIZE                (BENCH_MAX_MESSAGE_LENGTH + (BENCH_MAX_MESSAGE_FIELDS * 16U))
+
+/* Number of distinct integer values of each width, the values are encoded and decoded round robin. */
+#define BENCH_INTEGER_VALUES            64U
+
+/* Tag numbers of the message, nested container and large string TLV objects. */
+#define BENCH_TAG_MESSAGE               TAG_APP_TXN_INFO
+#define BENCH_TAG_NESTED                TAG_APP_ADDNL_TXN_INFO
+#define BENCH_TAG_LARGE_STRING          (TAG_CONT_SPCF_UINT_8 + 1U)
+
+/* Field of a message. */
+typedef enum bench_field_type
+{
+    BENCH_FIELD_INTEGER,
+    BENCH_FIELD_STRING,
+    BENCH_FIELD_OPEN_CONTAINER,
+    BENCH_FIELD_CLOSE_CONTAINER
+} bench_field_type_t;
+
+typedef struct bench_field
+{
+    bench_field_type_t    field_type;
+    uint32_t              tag;
+    int64_t               integer_value;
+    const uint8_t       * p_string;
+    uint32_t              string_length;
+} bench_field_t;
+
+/* Corpus of messages of one shape, the fields and the encoded octets of each message. */
+typedef struct bench_corpus
+{
+    const char          * p_shape_name;
+    bench_field_t       * p_fields;
+    uint32_t              field_offset[BENCH_CORPUS_MESSAGES + 1U];
+    uint8_t             * p_encoded;
+    uint32_t              encoded_offset[BENCH_CORPUS_MESSAGES + 1U];
+    uint32_t              tlv_object_count[BENCH_CORPUS_MESSAGES];
+} bench_corpus_t;
+
+/* Benchmark of one message, returns TLV_SUCCESS if the message is encoded or decoded. */
+typedef uint32_t (*bench_function_t)(const bench_corpus_t * p_corpus, uint32_t message_index);
+
+typedef struct bench
+{
+    const char          * p_name;
+    bench_function_t      p_function;
+    bool_t                b_decode;
+} bench_t;
+
+/* Corpus shape parameters. */
+typedef struct bench_shape
+{
+    uint32_t              field_count;
+    uint32_t              nesting_depth;
+    uint32_t              string_length;
+} bench_shape_t;
+
+static uint64_t get_time_ns(void);
+static uint32_t bench_random(void);
+static uint32_t build_corpus(bench_corpus_t * p_corpus, const char * p_shape_name, const bench_shape_t * p_shape,
+    uint32_t (*p_add_message_fields)(bench_field_t * p_fields, const bench_shape_t * p_shape));
+static uint32_t add_flat_message_fields(bench_field_t * p_fields, const bench_shape_t * p_shape);
+static uint32_t add_nested_message_fields(bench_field_t * p_fields, const bench_shape_t * p_shape);
+static uint32_t add_small_integer_message_fields(bench_field_t * p_fields, const bench_shape_t * p_shape);
+static uint32_t add_large_string_message_fields(bench_field_t * p_fields, const bench_shape_t * p_shape);
+static uint32_t add_integer_field(bench_field_t * p_field, int64_t integer_value);
+static uint32_t add_string_field(bench_field_t * p_field, uint32_t tag, uint32_t string_length);
+static uint32_t add_container_field(bench_field_t * p_field, bench_field_type_t field_type, uint32_t tag);
+static uint32_t encode_message_with_writer(const bench_corpus_t * p_corpus, uint32_t message_index, uint8_t * p_buffer, uint32_t * p_encoded_length);
+static uint32_t encode_message_with_tlv_objects(const bench_corpus_t * p_corpus, uint32_t message_index, tlv_arena_t * p_tlv_arena);
+static uint32_t decode_message_into_tlv_objects(const bench_corpus_t * p_corpus, uint32_t message_index, tlv_arena_t * p_tlv_arena);
+static uint32_t bench_encode_writer(const bench_corpus_t * p_corpus, uint32_t message_index);
+static uint32_t bench_encode_object(const bench_corpus_t * p_corpus, uint32_t message_index);
+static uint32_t bench_encode_object_arena(const bench_corpus_t * p_corpus, uint32_t message_index);
+static uint32_t bench_decode_index(const bench_corpus_t * p_corpus, uint32_t message_index);
+static uint32_t bench_decode_object(const bench_corpus_t * p_corpus, uint32_t message_index);
+static uint32_t bench_decode_object_arena(const bench_corpus_t * p_corpus, uint32_t message_index);
+static void run_bench(const bench_t * p_bench, const bench_corpus_t * p_corpus, uint32_t messages, bool_t b_first_result);
+static void run_integer_bench(uint32_t value_width, uint32_t values, bool_t b_first_result);
+static uint32_t encode_integer_byte_loop(const uint8_t * p_value, uint32_t value_length, uint8_t * p_value_octets);
+static void decode_integer_byte_loop(const uint8_t * p_value_octets, uint32_t octet_count, uint8_t * p_value, uint32_t value_length);
+static int compare_uint64(const void * p_left, const void * p_right);
+
+/* Benchmarks run on each corpus. */
+static const bench_t g_benches[] =
+{
+    { "encode_writer",       bench_encode_writer,       FALSE },
+    { "encode_object",       bench_encode_object,       FALSE },
+    { "encode_object_arena", bench_encode_object_arena, FALSE },
+    { "decode_index",        bench_decode_index,        TRUE },
+    { "decode_object",       bench_decode_object,       TRUE },
+    { "decode_object_arena", bench_decode_object_arena, TRUE }
+};
+
+/* TLV counting allocator, counts the heap allocations of the TLV module. */
+static tlv_counting_allocator_t g_tlv_counting_allocator;
+
+/* Pseudo random state, the corpora are the same on each run. */
+static uint32_t g_random_state = 0x2545F491U;
+
+/* String octets of the string fields. */
+static uint8_t g_string[BENCH_MAX_STRING_LENGTH];
+
+/* Encoded message, TLV objects, TLV arena and TLV index of one message. */
+static uint8_t g_encode_buffer[BENCH_MAX_MESSAGE_LENGTH];
+static tlv_object_t g_tlv_objects[BENCH_MAX_MESSAGE_FIELDS];
+static uint8_t g_arena_buffer[BENCH_ARENA_SIZE];
+static tlv_arena_t g_tlv_arena;
+static tlv_index_node_t g_tlv_index_nodes[BENCH_MAX_MESSAGE_FIELDS];
+static tlv_index_t g_tlv_index;
+
+/* Latency samples of the messages. */
+static uint64_t g_latency_samples[BENCH_LATENCY_SAMPLES];
+
+int main(int argc, char * argv[])
+{
+    uint32_t messages = BENCH_DEFAULT_MESSAGES;
+    bench_shape_t shape = { BENCH_DEFAULT_FIELD_COUNT, BENCH_DEFAULT_NESTING_DEPTH, BENCH_DEFAULT_STRING_LENGTH };
+    static bench_corpus_t corpora[4];
+    bool_t b_first_result = TRUE;
+
+    if (argc > 1)
+    {
+        messages = (uint32_t)strtoul(argv[1], NULL, 10);
+    }
+    if (argc > 2)
+    {
+        shape.field_count = (uint32_t)strtoul(argv[2], NULL, 10);
+    }
+    if (argc > 3)
+    {
+        shape.nesting_depth = (uint32_t)strtoul(argv[3], NULL, 10);
+    }
+    if (argc > 4)
+    {
+        shape.string_length = (uint32_t)strtoul(argv[4], NULL, 10);
+    }
+
+    if ((0U == messages) || (0U == shape.field_count) || (BENCH_MAX_FIELD_COUNT < shape.field_count) || (0U == shape.nesting_depth) ||
+        (BENCH_MAX_NESTING_DEPTH < shape.nesting_depth) || (0U == shape.string_length) || (BENCH_MAX_STRING_LENGTH < shape.string_length))
+    {
+        fprintf(stderr, "Usage: tlv_bench [messages] [field_count <1 to %u>] [nesting_depth <1 to %u>] [string_length <1 to %u>]\n",
+            BENCH_MAX_FIELD_COUNT, BENCH_MAX_NESTING_DEPTH, BENCH_MAX_STRING_LENGTH);
+        return 1;
+    }
+
+    for (uint32_t i = 0; i < BENCH_MAX_STRING_LENGTH; i++)
+    {
+        g_string[i] = (uint8_t)('a' + (i % 26U));
+    }
+
+    if ((TLV_SUCCESS != build_corpus(&corpora[0], "flat", &shape, add_flat_message_fields)) ||
+        (TLV_SUCCESS != build_corpus(&corpora[1], "nested", &shape, add_nested_message_fields)) ||
+        (TLV_SUCCESS != build_corpus(&corpora[2], "small_integers", &shape, add_small_integer_message_fields)) ||
+        (TLV_SUCCESS != build_corpus(&corpora[3], "large_strings", &shape, add_large_string_message_fields)))
+    {
+        fprintf(stderr, "tlv_bench: could not build the message corpora\n");
+        return 1;
+    }
+
+    (void)tlv_arena_init(&g_tlv_arena, g_arena_buffer, BENCH_ARENA_SIZE);
+    (void)tlv_counting_allocator_init(&g_tlv_counting_allocator, NULL);
+    (void)tlv_set_allocator(&g_tlv_counting_allocator.tlv_allocator);
+
+    printf("{\n  \"benchmark\": \"tlv\",\n  \"messages\": %u,\n  \"field_count\": %u,\n  \"nesting_depth\": %u,\n  \"string_length\": %u,\n"
+        "  \"results\": [\n", messages, shape.field_count, shape.nesting_depth, shape.string_length);
+
+    for (uint32_t i = 0; i < (sizeof(corpora) / sizeof(corpora[0])); i++)
+    {
+        for (uint32_t j = 0; j < (sizeof(g_benches) / sizeof(g_benches[0])); j++)
+        {
+            run_bench(&g_benches[j], &corpora[i], messages, b_first_result);
+            b_first_result = FALSE;
+        }
+    }
+
+    printf("\n  ],\n  \"integer_results\": [\n");
+
+    for (uint32_t i = 1U; i <= MAX_INTEGER_BYTES; i++)
+    {
+        run_integer_bench(i, messages, (1U == i) ? TRUE : FALSE);
+    }
+
+    printf("\n  ]\n}\n");
+
+    for (uint32_t i = 0; i < (sizeof(corpora) / sizeof(corpora[0])); i++)
+    {
+        free(corpora[i].p_fields);
+        free(corpora[i].p_encoded);
+    }
+
+    return 0;
+}
+
+/* Get monotonic time in nano seconds. */
+static uint64_t get_time_ns(void)
+{
+    struct timespec time_now;
+    clock_gettime(CLOCK_MONOTONIC, &time_now);
+    return ((uint64_t)time_now.tv_sec * 1000000000ULL) + (uint64_t)time_now.tv_nsec;
+}
+
+/* xorshift32 pseudo random number. */
+static uint32_t bench_random(void)
+{
+    g_random_state ^= g_random_state << 13;
+    g_random_state ^= g_random_state >> 17;
+    g_random_state ^= g_random_state << 5;
+    return g_random_state;
+}
+
+/*
+ * Build the corpus of the shape, the fields of each message are added and encoded with the TLV writer.
+ * The encoded messages are checked against the TLV objects encode and the number of TLV objects of the TLV index.
+ */
+static uint32_t build_corpus(bench_corpus_t * p_corpus, const char * p_shape_name, const bench_shape_t * p_shape,
+    uint32_t (*p_add_message_fields)(bench_field_t * p_fields, const bench_shape_t * p_shape))
+{
+    uint32_t status = TLV_SUCCESS;
+    uint32_t encoded_length = 0U;
+
+    memset(p_corpus, 0, sizeof(bench_corpus_t));
+    p_corpus->p_shape_name = p_shape_name;
+    p_corpus->p_fields = (bench_field_t *)calloc((size_t)BENCH_CORPUS_MESSAGES * BENCH_MAX_MESSAGE_FIELDS, sizeof(bench_field_t));
+    if (!p_corpus->p_fields)
+    {
+        return TLV_NO_MEMORY;
+    }
+
+    for (uint32_t i = 0; (TLV_SUCCESS == status) && (i < BENCH_CORPUS_MESSAGES); i++)
+    {
+        p_corpus->field_offset[i + 1U] = p_corpus->field_offset[i] + p_add_message_fields(&p_corpus->p_fields[p_corpus->field_offset[i]], p_shape);
+
+        status = encode_message_with_writer(p_corpus, i, g_encode_buffer, &encoded_length);
+
+        if (TLV_SUCCESS == status)
+        {
+            /* Append the encoded message to the corpus. */
+            uint8_t * p_encoded = (uint8_t *)realloc(p_corpus->p_encoded, (p_corpus->encoded_offset[i] + encoded_length));
+            if (!p_encoded)
+            {
+                return TLV_NO_MEMORY;
+            }
+            p_corpus->p_encoded = p_encoded;
+            memcpy(&p_corpus->p_encoded[p_corpus->encoded_offset[i]], g_encode_buffer, encoded_length);
+            p_corpus->encoded_offset[i + 1U] = p_corpus->encoded_offset[i] + encoded_length;
+
+            status = tlv_index_build(&g_tlv_index, &p_corpus->p_encoded[p_corpus->encoded_offset[i]], encoded_length,
+                g_tlv_index_nodes, BENCH_MAX_MESSAGE_FIELDS);
+            p_corpus->tlv_object_count[i] = g_tlv_index.node_count;
+        }
+
+        if (TLV_SUCCESS == status)
+        {
+            /* Same message encoded with TLV objects. */
+            (void)tlv_arena_init(&g_tlv_arena, g_arena_buffer, BENCH_ARENA_SIZE);
+            status = encode_message_with_tlv_objects(p_corpus, i, &g_tlv_arena);
+            if ((TLV_SUCCESS == status) && (memcmp(g_encode_buffer, &p_corpus->p_encoded[p_corpus->encoded_offset[i]], encoded_length)))
+            {
+                status = TLV_FAIL;
+            }
+        }
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Flat message, integers and short strings in the message container. */
+static uint32_t add_flat_message_fields(bench_field_t * p_fields, const bench_shape_t * p_shape)
+{
+    uint32_t field_count = add_container_field(&p_fields[0], BENCH_FIELD_OPEN_CONTAINER, BENCH_TAG_MESSAGE);
+
+    for (uint32_t i = 0; i < p_shape->field_count; i++)
+    {
+        if (i & 1U)
+        {
+            field_count += add_string_field(&p_fields[field_count], TAG_UTF8STRING, (1U + (bench_random() % MAX_UTF8STRING_LENGTH)));
+        }
+        else
+        {
+            field_count += add_integer_field(&p_fields[field_count], (int64_t)(int32_t)bench_random());
+        }
+    }
+
+    return field_count + add_container_field(&p_fields[field_count], BENCH_FIELD_CLOSE_CONTAINER, BENCH_TAG_MESSAGE);
+}
+
+/* Nested message, containers within containers up to the nesting depth, an integer and a short string in each container. */
+static uint32_t add_nested_message_fields(bench_field_t * p_fields, const bench_shape_t * p_shape)
+{
+    uint32_t field_count = add_container_field(&p_fields[0], BENCH_FIELD_OPEN_CONTAINER, BENCH_TAG_MESSAGE);
+
+    for (uint32_t i = 0; i < p_shape->nesting_depth; i++)
+    {
+        field_count += add_integer_field(&p_fields[field_count], (int64_t)(int32_t)bench_random());
+        field_count += add_string_field(&p_fields[field_count], TAG_UTF8STRING, (1U + (bench_random() % MAX_UTF8STRING_LENGTH)));
+        field_count += add_container_field(&p_fields[field_count], BENCH_FIELD_OPEN_CONTAINER, BENCH_TAG_NESTED);
+    }
+
+    field_count += add_integer_field(&p_fields[field_count], (int64_t)(int32_t)bench_random());
+
+    for (uint32_t i = 0; i <= p_shape->nesting_depth; i++)
+    {
+        field_count += add_container_field(&p_fields[field_count], BENCH_FIELD_CLOSE_CONTAINER, BENCH_TAG_NESTED);
+    }
+
+    return field_count;
+}
+
+/* Message of many small integers (1 or 2 value octets), four integers per field. */
+static uint32_t add_small_integer_message_fields(bench_field_t * p_fields, const bench_shape_t * p_shape)
+{
+    uint32_t field_count = add_container_field(&p_fields[0], BENCH_FIELD_OPEN_CONTAINER, BENCH_TAG_MESSAGE);
+
+    for (uint32_t i = 0; i < (p_shape->field_count * 4U); i++)
+    {
+        field_count += add_integer_field(&p_fields[field_count], (int64_t)(int16_t)(bench_random() % 512U) - 256);
+    }
+
+    return field_count + add_container_field(&p_fields[field_count], BENCH_FIELD_CLOSE_CONTAINER, BENCH_TAG_MESSAGE);
+}
+
+/* Message of large strings of the string length, one string per four fields. */
+static uint32_t add_large_string_message_fields(bench_field_t * p_fields, const bench_shape_t * p_shape)
+{
+    uint32_t field_count = add_container_field(&p_fields[0], BENCH_FIELD_OPEN_CONTAINER, BENCH_TAG_MESSAGE);
+    uint32_t string_count = (p_shape->field_count + 3U) / 4U;
+
+    for (uint32_t i = 0; i < string_count; i++)
+    {
+        field_count += add_string_field(&p_fields[field_count], BENCH_TAG_LARGE_STRING, p_shape->string_length);
+    }
+
+    return field_count + add_container_field(&p_fields[field_count], BENCH_FIELD_CLOSE_CONTAINER, BENCH_TAG_MESSAGE);
+}
+
+/* Add an integer field, returns the number of added fields. */
+static uint32_t add_integer_field(bench_field_t * p_field, int64_t integer_value)
+{
+    p_field->field_type = BENCH_FIELD_INTEGER;
+    p_field->tag = TAG_INTEGER;
+    p_field->integer_value = integer_value;
+    return 1U;
+}
+
+/* Add a string field, returns the number of added fields. */
+static uint32_t add_string_field(bench_field_t * p_field, uint32_t tag, uint32_t string_length)
+{
+    p_field->field_type = BENCH_FIELD_STRING;
+    p_field->tag = tag;
+    p_field->p_string = &g_string[bench_random() % (BENCH_MAX_STRING_LENGTH - string_length + 1U)];
+    p_field->string_length = string_length;
+    return 1U;
+}
+
+/* Add an open or close container field, returns the number of added fields. */
+static uint32_t add_container_field(bench_field_t * p_field, bench_field_type_t field_type, uint32_t tag)
+{
+    p_field->field_type = field_type;
+    p_field->tag = tag;
+    return 1U;
+}
+
+/* Encode the message with the TLV writer into the buffer. */
+static uint32_t encode_message_with_writer(const bench_corpus_t * p_corpus, uint32_t message_index, uint8_t * p_buffer, uint32_t * p_encoded_length)
+{
+    uint32_t status = TLV_SUCCESS;
+    tlv_writer_t tlv_writer;
+
+    (void)tlv_writer_init(&tlv_writer, p_buffer, BENCH_MAX_MESSAGE_LENGTH);
+
+    for (uint32_t i = p_corpus->field_offset[message_index]; (TLV_SUCCESS == status) && (i < p_corpus->field_offset[message_index + 1U]); i++)
+    {
+        const bench_field_t * p_field = &p_corpus->p_fields[i];
+
+        switch (p_field->field_type)
+        {
+            case BENCH_FIELD_INTEGER:
+                status = tlv_writer_add_integer(&tlv_writer, p_field->tag, (const uint8_t *)&p_field->integer_value, sizeof(int64_t));
+                break;
+            case BENCH_FIELD_STRING:
+                status = tlv_writer_add_value(&tlv_writer, p_field->tag, p_field->p_string, p_field->string_length);
+                break;
+            case BENCH_FIELD_OPEN_CONTAINER:
+                status = tlv_writer_open_container(&tlv_writer, p_field->tag, FALSE);
+                break;
+            case BENCH_FIELD_CLOSE_CONTAINER:
+                status = tlv_writer_close_container(&tlv_writer);
+                break;
+        }
+    }
+
+    if (TLV_SUCCESS == status)
+    {
+        status = tlv_writer_finish(&tlv_writer, p_encoded_length);
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/*
+ * Encode the message with TLV objects into g_encode_buffer, the TLV objects are created in the TLV arena (from heap if the
+ * TLV arena is NULL, the TLV encoded buffers are freed after the encode).
+ */
+static uint32_t encode_message_with_tlv_objects(const bench_corpus_t * p_corpus, uint32_t message_index, tlv_arena_t * p_tlv_arena)
+{
+    uint32_t status = TLV_SUCCESS;
+    tlv_object_t * p_container_stack[BENCH_MAX_NESTING_DEPTH + 1U];
+    uint32_t container_depth = 0U;
+    uint32_t tlv_object_count = 0U;
+    uint32_t encoded_length = 0U;
+
+    for (uint32_t i = p_corpus->field_offset[message_index]; (TLV_SUCCESS == status) && (i < p_corpus->field_offset[message_index + 1U]); i++)
+    {
+        const bench_field_t * p_field = &p_corpus->p_fields[i];
+        tlv_object_t * p_tlv_object = &g_tlv_objects[tlv_object_count];
+
+        switch (p_field->field_type)
+        {
+            case BENCH_FIELD_INTEGER:
+                status = create_tlv_object_in_arena(p_tlv_arena, p_tlv_object, p_field->tag, (uint8_t *)&p_field->integer_value, sizeof(int64_t));
+                break;
+            case BENCH_FIELD_STRING:
+                status = create_tlv_object_in_arena(p_tlv_arena, p_tlv_object, p_field->tag, (uint8_t *)p_field->p_string, p_field->string_length);
+                break;
+            case BENCH_FIELD_OPEN_CONTAINER:
+                status = create_tlv_container_in_arena(p_tlv_arena, p_tlv_object, p_field->tag, FALSE);
+                break;
+            case BENCH_FIELD_CLOSE_CONTAINER:
+                container_depth--;
+                continue;
+        }
+
+        if (TLV_SUCCESS == status)
+        {
+            tlv_object_count++;
+            if (container_depth)
+            {
+                status = add_tlv_object_to_tlv_container(p_container_stack[container_depth - 1U], p_tlv_object);
+            }
+            if (BENCH_FIELD_OPEN_CONTAINER == p_field->field_type)
+            {
+                p_container_stack[container_depth++] = p_tlv_object;
+            }
+        }
+    }
+
+    if (TLV_SUCCESS == status)
+    {
+        status = encode_tlv_object(&g_tlv_objects[0], g_encode_buffer, BENCH_MAX_MESSAGE_LENGTH, &encoded_length);
+    }
+
+    if (!p_tlv_arena)
+    {
+        for (uint32_t i = 0; i < tlv_object_count; i++)
+        {
+            (void)free_tlv_object_buffer(&g_tlv_objects[i]);
+        }
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/*
+ * Decode the message into TLV objects, each TLV object is parsed in order (a container is parsed with its tag and length octets,
+ * its child TLV objects are parsed next). The TLV objects are parsed in the TLV arena (from heap if the TLV arena is NULL, the
+ * TLV encoded buffers are freed after the decode).
+ */
+static uint32_t decode_message_into_tlv_objects(const bench_corpus_t * p_corpus, uint32_t message_index, tlv_arena_t * p_tlv_arena)
+{
+    uint32_t status = TLV_SUCCESS;
+    const uint8_t * p_buffer = &p_corpus->p_encoded[p_corpus->encoded_offset[message_index]];
+    uint32_t buffer_length = p_corpus->encoded_offset[message_index + 1U] - p_corpus->encoded_offset[message_index];
+    uint32_t buffer_index = 0U;
+    uint32_t tlv_object_count = 0U;
+
+    while ((TLV_SUCCESS == status) && (tlv_object_count < p_corpus->tlv_object_count[message_index]))
+    {
+        tlv_object_t * p_tlv_object = &g_tlv_objects[tlv_object_count];
+
+        /* Skip the end of contents octets of the containers closed before the TLV object. */
+        while (((buffer_index + 1U) < buffer_length) && (TAG_END_OF_CONTENT == p_buffer[buffer_index]) &&
+            (TAG_END_OF_CONTENT == p_buffer[buffer_index + 1U]))
+        {
+            buffer_index += 2U;
+        }
+
+        status = parse_tlv_object_in_arena(p_tlv_arena, &p_buffer[buffer_index], (buffer_length - buffer_index), p_tlv_object);
+        if (TLV_SUCCESS == status)
+        {
+            buffer_index += p_tlv_object->tlv_curr_encoded_object_length;
+            tlv_object_count++;
+        }
+    }
+
+    if (!p_tlv_arena)
+    {
+        for (uint32_t i = 0; i < tlv_object_count; i++)
+        {
+            (void)free_tlv_object_buffer(&g_tlv_objects[i]);
+        }
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Encode the message with the TLV writer. */
+static uint32_t bench_encode_writer(const bench_corpus_t * p_corpus, uint32_t message_index)
+{
+    uint32_t encoded_length = 0U;
+    return encode_message_with_writer(p_corpus, message_index, g_encode_buffer, &encoded_length);
+}
+
+/* Encode the message with TLV objects allocated from heap. */
+static uint32_t bench_encode_object(const bench_corpus_t * p_corpus, uint32_t message_index)
+{
+    return encode_message_with_tlv_objects(p_corpus, message_index, NULL);
+}
+
+/* Encode the message with TLV objects allocated from the TLV arena, the TLV arena is reset per message. */
+static uint32_t bench_encode_object_arena(const bench_corpus_t * p_corpus, uint32_t message_index)
+{
+    (void)tlv_arena_reset(&g_tlv_arena);
+    return encode_message_with_tlv_objects(p_corpus, message_index, &g_tlv_arena);
+}
+
+/* Decode the message into the TLV index. */
+static uint32_t bench_decode_index(const bench_corpus_t * p_corpus, uint32_t message_index)
+{
+    return tlv_index_build(&g_tlv_index, &p_corpus->p_encoded[p_corpus->encoded_offset[message_index]],
+        (p_corpus->encoded_offset[message_index + 1U] - p_corpus->encoded_offset[message_index]), g_tlv_index_nodes, BENCH_MAX_MESSAGE_FIELDS);
+}
+
+/* Decode the message into TLV objects allocated from heap. */
+static uint32_t bench_decode_object(const bench_corpus_t * p_corpus, uint32_t message_index)
+{
+    return decode_message_into_tlv_objects(p_corpus, message_index, NULL);
+}
+
+/* Decode the message into TLV objects allocated from the TLV arena, the TLV arena is reset per message. */
+static uint32_t bench_decode_object_arena(const bench_corpus_t * p_corpus, uint32_t message_index)
+{
+    (void)tlv_arena_reset(&g_tlv_arena);
+    return decode_message_into_tlv_objects(p_corpus, message_index, &g_tlv_arena);
+}
+
+/*
+ * Run the benchmark on the corpus and print the result.
+ * Throughput is measured over all the messages, the latency of each message is measured in a second pass (up to
+ * BENCH_LATENCY_SAMPLES messages) so that the time measurement is not included in the throughput.
+ */
+static void run_bench(const bench_t * p_bench, const bench_corpus_t * p_corpus, uint32_t messages, bool_t b_first_result)
+{
+    uint32_t failed_messages = 0U;
+    uint32_t latency_samples = (messages < BENCH_LATENCY_SAMPLES) ? messages : BENCH_LATENCY_SAMPLES;
+    uint64_t corpus_bytes = p_corpus->encoded_offset[BENCH_CORPUS_MESSAGES];
+    uint64_t corpus_tlv_objects = 0U;
+    uint64_t bytes = ((uint64_t)(messages / BENCH_CORPUS_MESSAGES) * corpus_bytes) +
+        p_corpus->encoded_offset[messages % BENCH_CORPUS_MESSAGES];
+
+    /* Warm up. */
+    for (uint32_t i = 0; i < BENCH_CORPUS_MESSAGES; i++)
+    {
+        corpus_tlv_objects += p_corpus->tlv_object_count[i];
+        (void)p_bench->p_function(p_corpus, i);
+    }
+
+    (void)tlv_counting_allocator_reset(&g_tlv_counting_allocator);
+    uint64_t start_ns = get_time_ns();
+    for (uint32_t i = 0; i < messages; i++)
+    {
+        if (TLV_SUCCESS != p_bench->p_function(p_corpus, (i % BENCH_CORPUS_MESSAGES)))
+        {
+            failed_messages++;
+        }
+    }
+    uint64_t elapsed_ns = get_time_ns() - start_ns;
+    uint64_t allocation_count = g_tlv_counting_allocator.allocation_count;
+    uint64_t allocated_octets = g_tlv_counting_allocator.allocated_octets;
+
+    for (uint32_t i = 0; i < latency_samples; i++)
+    {
+        uint64_t message_start_ns = get_time_ns();
+        (void)p_bench->p_function(p_corpus, (i % BENCH_CORPUS_MESSAGES));
+        g_latency_samples[i] = get_time_ns() - message_start_ns;
+    }
+    qsort(g_latency_samples, latency_samples, sizeof(uint64_t), compare_uint64);
+
+    if (elapsed_ns == 0U)
+    {
+        elapsed_ns = 1U;
+    }
+
+    printf("%s    {\"name\": \"%s\", \"shape\": \"%s\", \"operation\": \"%s\", \"messages\": %u, \"failed_messages\": %u, "
+        "\"bytes_per_message\": %.1f, \"tlv_objects_per_message\": %.1f, \"messages_per_s\": %.0f, \"mb_per_s\": %.1f, "
+        "\"allocations_per_message\": %.2f, \"allocated_octets_per_message\": %.1f, \"p50_ns\": %llu, \"p99_ns\": %llu}",
+        (TRUE == b_first_result) ? "" : ",\n", p_bench->p_name, p_corpus->p_shape_name, (TRUE == p_bench->b_decode) ? "decode" : "encode",
+        messages, failed_messages, ((double)corpus_bytes / (double)BENCH_CORPUS_MESSAGES),
+        ((double)corpus_tlv_objects / (double)BENCH_CORPUS_MESSAGES), (((double)messages * 1000000000.0) / (double)elapsed_ns),
+        (((double)bytes * 1000.0) / (double)elapsed_ns), ((double)allocation_count / (double)messages),
+        ((double)allocated_octets / (double)messages),
+        (unsigned long long)g_latency_samples[(latency_samples * 50U) / 100U],
+        (unsigned long long)g_latency_samples[(latency_samples * 99U) / 100U]);
+}
+
+/*
+ * Run the integer value encode and decode benchmark of the value width (octets) and print the result.
+ * - encode: application variable (MAX_INTEGER_BYTES octets) to the minimum number of value octets.
+ * - decode: value octets to the application variable.
+ * The integer functions of tlv_integer.h are measured against the octet by octet loops of the earlier implementation.
+ */
+static void run_integer_bench(uint32_t value_width, uint32_t values, bool_t b_first_result)
+{
+    uint8_t integer_values[BENCH_INTEGER_VALUES][MAX_INTEGER_BYTES];
+    uint8_t value_octets[BENCH_INTEGER_VALUES][MAX_INTEGER_BYTES];
+    uint8_t decoded_value[MAX_INTEGER_BYTES];
+    uint32_t failed_values = 0U;
+    uint64_t checksum = 0U;
+    uint64_t elapsed_ns[4];
+
+    /* Values of the width (positive and negative), the encoded value octets are checked against the width and decoded back. */
+    for (uint32_t i = 0; i < BENCH_INTEGER_VALUES; i++)
+    {
+        uint64_t magnitude = ((uint64_t)bench_random() << 32U) | bench_random();
+        int64_t value = (int64_t)(magnitude >> ((INTEGER_VALUE_BITS - (value_width * INTEGER_OCTET_BITS)) + 1U));
+
+        value |= (int64_t)((uint64_t)1U << ((value_width * INTEGER_OCTET_BITS) - 2U));
+        value = (i & 1U) ? (-value - 1) : value;
+        store_integer_value(integer_values[i], MAX_INTEGER_BYTES, value);
+
+        encode_integer_octets(value_octets[i], value, get_integer_octet_count(value));
+        if ((value_width != get_integer_octet_count(value)) || (value != decode_integer_octets(value_octets[i], value_width)))
+        {
+            failed_values++;
+        }
+    }
+
+    /* Encode with tlv_integer.h. */
+    uint64_t start_ns = get_time_ns();
+    for (uint32_t i = 0; i < values; i++)
+    {
+        int64_t value = load_integer_value(integer_values[i % BENCH_INTEGER_VALUES], MAX_INTEGER_BYTES);
+        uint32_t octet_count = get_integer_octet_count(value);
+
+        encode_integer_octets(value_octets[i % BENCH_INTEGER_VALUES], value, octet_count);
+        checksum += octet_count;
+    }
+    elapsed_ns[0] = get_time_ns() - start_ns;
+
+    /* Encode with the octet by octet loop. */
+    start_ns = get_time_ns();
+    for (uint32_t i = 0; i < values; i++)
+    {
+        checksum += encode_integer_byte_loop(integer_values[i % BENCH_INTEGER_VALUES], MAX_INTEGER_BYTES, value_octets[i % BENCH_INTEGER_VALUES]);
+    }
+    elapsed_ns[1] = get_time_ns() - start_ns;
+
+    /* Decode with tlv_integer.h. */
+    start_ns = get_time_ns();
+    for (uint32_t i = 0; i < values; i++)
+    {
+        store_integer_value(decoded_value, MAX_INTEGER_BYTES, decode_integer_octets(value_octets[i % BENCH_INTEGER_VALUES], value_width));
+        checksum += decoded_value[0];
+    }
+    elapsed_ns[2] = get_time_ns() - start_ns;
+
+    /* Decode with the octet by octet loop. */
+    start_ns = get_time_ns();
+    for (uint32_t i = 0; i < values; i++)
+    {
+        decode_integer_byte_loop(value_octets[i % BENCH_INTEGER_VALUES], value_width, decoded_value, MAX_INTEGER_BYTES);
+        checksum += decoded_value[0];
+    }
+    elapsed_ns[3] = get_time_ns() - start_ns;
+
+    printf("%s    {\"value_width\": %u, \"values\": %u, \"failed_values\": %u, \"encode_ns\": %.2f, \"encode_byte_loop_ns\": %.2f, "
+        "\"decode_ns\": %.2f, \"decode_byte_loop_ns\": %.2f, \"checksum\": %llu}", (TRUE == b_first_result) ? "" : ",\n", value_width,
+        values, failed_values, ((double)elapsed_ns[0] / (double)values), ((double)elapsed_ns[1] / (double)values),
+        ((double)elapsed_ns[2] / (double)values), ((double)elapsed_ns[3] / (double)values), (unsigned long long)checksum);
+}
+
+/*
+ * Earlier integer encoder (baseline of the integer benchmark), the sign octets are trimmed and the value octets are copied
+ * octet by octet.
+ */
+static uint32_t encode_integer_byte_loop(const uint8_t * p_value, uint32_t value_length, uint8_t * p_value_octets)
+{
+    uint32_t octet_count = value_length;
+    bool_t b_negative = (p_value[octet_count - 1U] == 0xFFU) ? TRUE : FALSE;
+
+    for (; octet_count > 1U; octet_count--)
+    {
+        if ((0x00U != p_value[(octet_count - 1U)]) && (0xFFU != p_value[(octet_count - 1U)]))
+        {
+            break;
+        }
+    }
+
+    for (uint32_t i = 0; i < MAX_INTEGER_BYTES; i++)
+    {
+        if (i < octet_count)
+        {
+            p_value_octets[i] = p_value[i];
+            if ((octet_count == (i + 1U)) && (TRUE == b_negative))
+            {
+                p_value_octets[i] |= (uint8_t)(1U << 7U);
+            }
+        }
+        else
+        {
+            p_value_octets[i] = 0x0U;
+        }
+    }
+
+    return octet_count;
+}
+
+/* Earlier integer decoder (baseline of the integer benchmark), the value is rebuilt and copied octet by octet (all 64 bits are kept). */
+static void decode_integer_byte_loop(const uint8_t * p_value_octets, uint32_t octet_count, uint8_t * p_value, uint32_t value_length)
+{
+    uint64_t temp_value = 0U;
+    uint64_t signed_value = 0U;
+
+    for (int32_t index = (int32_t)(octet_count - 1U); index >= 0; index--)
+    {
+        if (index == (int32_t)(octet_count - 1U))
+        {
+            temp_value |= (uint64_t)(p_value_octets[index] & 0x7FU);
+            signed_value |= (uint64_t)(p_value_octets[index] & 0x80U);
+        }
+        else
+        {
+            temp_value = (temp_value << 8U);
+            signed_value = (signed_value << 8U);
+            temp_value |= (uint64_t)p_value_octets[index];
+        }
+    }
+
+    int64_t decoded_value = (int64_t)(temp_value - signed_value);
+    for (uint32_t i = 0; i < value_length; i++)
+    {
+        p_value[i] = (uint8_t)(decoded_value & 0xFFU);
+        decoded_value = (decoded_value >> 8U);
+    }
+}
+
+/* qsort compare function for latency samples. */
+static int compare_uint64(const void * p_left, const void * p_right)
+{
+    uint64_t left = *(const uint64_t *)p_left;
+    uint64_t right = *(const uint64_t *)p_right;
+
+    return (left > right) - (left < right);
+}
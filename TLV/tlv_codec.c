@@ -0,0 +1,109 @@
+/*
+ * Name: tlv_codec.c
+ *
+ * Description:
+ * All API definitions required for the TLV codec registry (encode, decode, validate and size bound of each tag number).
+ * The TLV codecs are looked up by the tag number in a direct indexed table, TLV objects are created, written and checked
+ * with one indexed call instead of a switch per tag.
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#define TLV_OBJECT_SOURCE_CODE
+
+#include <string.h>
+
+#include "tlv_api.h"
+#include "tlv.h"
+#include "tlv_universal_class.h"
+#include "tlv_application_class.h"
+#include "tlv_definition.h"
+
+/* Default application class and context specific class TLV codec (value length 0 is a container TLV object). */
+static const tlv_codec_t application_tlv_codec =
+{
+    create_application_tlv_object,
+    add_data_to_definite_length_application_tlv_object,
+    NULL,
+    NULL,
+    0U,
+    APP_TAG_MAX_VALUE_LENGTH
+};
+
+/*
+ * TLV codec of each tag number, indexed by the tag number (p_create NULL if no TLV codec is registered).
+ * Note: Add the TLV codec of each supported universal tag.
+ */
+static tlv_codec_t tlv_codec_table[TAG_MAX + 1U] =
+{
+    [TAG_INTEGER] =
+    {
+        create_integer_tlv_object,
+        add_data_integer_tlv_object,
+        NULL,
+        NULL,
+        1U,
+        MAX_INTEGER_BYTES
+    },
+    [TAG_UTF8STRING] =
+    {
+        create_utf8_string_tlv_object,
+        add_data_universal_tlv_object,
+        NULL,
+        NULL,
+        1U,
+        MAX_UTF8STRING_LENGTH
+    }
+};
+
+/* Function to register the TLV codec of a tag number, the TLV codec NULL removes the registered TLV codec. */
+uint32_t tlv_codec_register(uint32_t tlv_tag, const tlv_codec_t * p_tlv_codec)
+{
+    if (p_tlv_codec)
+    {
+        /* Copy the TLV codec. */
+        tlv_codec_table[tlv_tag] = *p_tlv_codec;
+
+        /* Application tags use the default application encode if the TLV codec has none. */
+        if (TAG_MAX_UNIVERSAL < tlv_tag)
+        {
+            if (!p_tlv_codec->p_create)
+            {
+                tlv_codec_table[tlv_tag].p_create = application_tlv_codec.p_create;
+            }
+
+            if (!p_tlv_codec->p_add_data)
+            {
+                tlv_codec_table[tlv_tag].p_add_data = application_tlv_codec.p_add_data;
+            }
+        }
+    }
+    else
+    {
+        /* Remove the registered TLV codec. */
+        memset(&tlv_codec_table[tlv_tag], 0, sizeof(tlv_codec_t));
+    }
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Get the TLV codec of the tag number, returns NULL if the tag is not supported. */
+const tlv_codec_t * get_tlv_codec(uint32_t tlv_tag)
+{
+    const tlv_codec_t * p_tlv_codec = NULL;
+
+    if ((tlv_tag <= TAG_MAX) && (tlv_codec_table[tlv_tag].p_create))
+    {
+        p_tlv_codec = &tlv_codec_table[tlv_tag];
+    }
+    else if ((TAG_MAX_UNIVERSAL < tlv_tag) && (TAG_MAX_EXTENDED >= tlv_tag))
+    {
+        /* Application tags without a registered TLV codec use the default application TLV codec. */
+        p_tlv_codec = &application_tlv_codec;
+    }
+
+    /* Return TLV codec. */
+    return p_tlv_codec;
+}
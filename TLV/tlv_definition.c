@@ -12,6 +12,8 @@
 #define TLV_OBJECT_SOURCE_CODE
 
 #include "tlv_api.h"
+#include "tlv_universal_class.h"
+#include "tlv_application_class.h"
 #include "tlv_definition.h"
 
 
@@ -32,10 +34,14 @@ uint32_t get_length_octets(uint32_t buffer_length)
     {
         length_octets = VALUE_LENGTH_3OCTET;
     }
+    else if (buffer_length <= FOUR_OCTET_MAX_LENGTH)
+    {
+        length_octets = VALUE_LENGTH_4OCTET;
+    }
     else
     {
-        /* do nothing. */
-        /* validity of the buffer length is checked in error check functions. */
+        /* Long form length with 4 length octets (uint32_t value length). */
+        length_octets = VALUE_LENGTH_5OCTET;
     }
 
     return length_octets;
@@ -56,6 +62,10 @@ uint32_t get_tag_octets(uint32_t tlv_tag)
     {
         tag_octets = TAG_3OCTET;
     }
+    else if (tlv_tag > THREE_OCTET_TAG_MAX && tlv_tag <= FOUR_OCTET_TAG_MAX)
+    {
+        tag_octets = TAG_4OCTET;
+    }
     else
     {
         /* do nothing. */
@@ -64,3 +74,98 @@ uint32_t get_tag_octets(uint32_t tlv_tag)
 
     return tag_octets;
 }
+
+
+/* Encode the tag (class and tag number) into the TLV encoded buffer, returns number of tag octets. */
+uint32_t encode_tag_octets(uint8_t * p_tlv_encoded_buffer, uint32_t tlv_tag)
+{
+    uint32_t tag_octets = TAG_1OCTET;
+
+    if (tlv_tag <= TAG_MAX_UNIVERSAL)
+    {
+        /* Universal class tag number. */
+        p_tlv_encoded_buffer[0] = (uint8_t)TAG_UNIVERSAL_PRIMITIVE | (uint8_t)tlv_tag;
+    }
+    else
+    {
+        /* Application class or context specific class tag number (same octets as the application class encoder). */
+        if (tlv_tag < TAG_APP_CLS_MAX)
+        {
+            p_tlv_encoded_buffer[0] = (uint8_t)TAG_APPL_CLS_CONSTRUCTED | (uint8_t)TAG_EXTENDED_BYTES;
+        }
+        else
+        {
+            p_tlv_encoded_buffer[0] = (uint8_t)TAG_CS_CLS_CONSTRUCTED | (uint8_t)TAG_EXTENDED_BYTES;
+        }
+
+        /*
+         * Tag number in the extended tag octets, 7 bits per octet (most significant first) and
+         * bit 8 is set in all the extended tag octets except the last.
+         */
+        tag_octets = get_tag_octets(tlv_tag);
+        for (uint32_t i = 1U; i < tag_octets; i++)
+        {
+            p_tlv_encoded_buffer[i] = (uint8_t)((tlv_tag >> (SHIFT_7BIT * (tag_octets - 1U - i))) & EXTENDED_TAG_FILTER);
+            if (i < (tag_octets - 1U))
+            {
+                p_tlv_encoded_buffer[i] |= (uint8_t)EXTENDED_TAG;
+            }
+        }
+    }
+
+    return tag_octets;
+}
+
+
+/* Encode the definite value length into the TLV encoded buffer, returns number of length octets. */
+uint32_t encode_length_octets(uint8_t * p_tlv_encoded_buffer, uint32_t value_length)
+{
+    uint32_t length_octets = 0U;
+    length_octets = get_length_octets(value_length);
+
+    switch (length_octets)
+    {
+        case VALUE_LENGTH_1OCTET:
+        {
+            p_tlv_encoded_buffer[0] = (uint8_t)value_length;
+        }
+        break;
+        case VALUE_LENGTH_2OCTET:
+        {
+            p_tlv_encoded_buffer[0] = (uint8_t)LONG_LENGTH_FORM | (uint8_t)VALUE_LENGTH_1OCTET;
+            p_tlv_encoded_buffer[1] = (uint8_t)value_length;
+        }
+        break;
+        case VALUE_LENGTH_3OCTET:
+        {
+            p_tlv_encoded_buffer[0] = (uint8_t)LONG_LENGTH_FORM | (uint8_t)VALUE_LENGTH_2OCTET;
+            p_tlv_encoded_buffer[1] = (uint8_t)((value_length & MASK_BIT_8_TO_15) >> SHIFT_8BIT);
+            p_tlv_encoded_buffer[2] = (uint8_t)(value_length & MASK_BIT_0_TO_7);
+        }
+        break;
+        case VALUE_LENGTH_4OCTET:
+        {
+            p_tlv_encoded_buffer[0] = (uint8_t)LONG_LENGTH_FORM | (uint8_t)VALUE_LENGTH_3OCTET;
+            p_tlv_encoded_buffer[1] = (uint8_t)((value_length & MASK_BIT_16_TO_23) >> SHIFT_16BIT);
+            p_tlv_encoded_buffer[2] = (uint8_t)((value_length & MASK_BIT_8_TO_15) >> SHIFT_8BIT);
+            p_tlv_encoded_buffer[3] = (uint8_t)(value_length & MASK_BIT_0_TO_7);
+        }
+        break;
+        case VALUE_LENGTH_5OCTET:
+        {
+            p_tlv_encoded_buffer[0] = (uint8_t)LONG_LENGTH_FORM | (uint8_t)VALUE_LENGTH_4OCTET;
+            p_tlv_encoded_buffer[1] = (uint8_t)((value_length & MASK_BIT_24_TO_31) >> SHIFT_24BIT);
+            p_tlv_encoded_buffer[2] = (uint8_t)((value_length & MASK_BIT_16_TO_23) >> SHIFT_16BIT);
+            p_tlv_encoded_buffer[3] = (uint8_t)((value_length & MASK_BIT_8_TO_15) >> SHIFT_8BIT);
+            p_tlv_encoded_buffer[4] = (uint8_t)(value_length & MASK_BIT_0_TO_7);
+        }
+        break;
+        default:
+        {
+            /* do nothing. */
+            /* validity of the value length is checked in error check functions. */
+        }
+    }
+
+    return length_octets;
+}
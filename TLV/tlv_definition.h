@@ -15,10 +15,13 @@
 #define ONE_OCTET_MAX_LENGTH        127U
 #define TWO_OCTET_MAX_LENGTH        255U
 #define THREE_OCTET_MAX_LENGTH      65535U
+#define FOUR_OCTET_MAX_LENGTH       16777215U
+#define FIVE_OCTET_MAX_LENGTH       4294967295U
 
 #define ONE_OCTET_TAG_MAX           31U
 #define TWO_OCTET_TAG_MAX           127U
-#define THREE_OCTET_TAG_MAX         254U
+#define THREE_OCTET_TAG_MAX         16383U
+#define FOUR_OCTET_TAG_MAX          2097151U
 
 /* Universal TLV object length field length of 1 octet. */
 #define VALUE_LENGTH_1OCTET         1U
@@ -26,6 +29,10 @@
 #define VALUE_LENGTH_2OCTET         2U
 /* Universal TLV object length field length of 3 octet. */
 #define VALUE_LENGTH_3OCTET         3U
+/* Universal TLV object length field length of 4 octet. */
+#define VALUE_LENGTH_4OCTET         4U
+/* Universal TLV object length field length of 5 octet. */
+#define VALUE_LENGTH_5OCTET         5U
 
 /* Universal TLV object tag length of 1 octet. */
 #define TAG_1OCTET                  1U
@@ -37,8 +44,10 @@
 
 /* Application TLV object tag length of 2 octet. */
 #define TAG_2OCTET                  2U
-/* Application TLV object tag length of 2 octet. */
+/* Application TLV object tag length of 3 octet. */
 #define TAG_3OCTET                  3U
+/* Application TLV object tag length of 4 octet. */
+#define TAG_4OCTET                  4U
 
 /* Tag is extended to two bytes */
 #define TAG_EXTENDED_BYTES          31U
@@ -50,15 +59,23 @@
 #define TLV_TAG_CLASS_FILTER        0xE0U
 #define TLV_TAG_NUMBER_FILTER       0x1FU
 
+/* TLV Tag class (class and constructed bits of the first tag octet) shift and number of tag classes. */
+#define TLV_TAG_CLASS_SHIFT         5U
+#define TLV_TAG_CLASS_COUNT         8U
+
 /* Extended length tags */
 #define EXTENDED_TAG                0x80U
 #define EXTENDED_TAG_FILTER         0x7FU
 
 #define MASK_BIT_0_TO_7             0xFFU
 #define MASK_BIT_8_TO_15            0xFF00U
+#define MASK_BIT_16_TO_23           0xFF0000U
+#define MASK_BIT_24_TO_31           0xFF000000U
 
 #define SHIFT_8BIT                  8U
 #define SHIFT_7BIT                  7U
+#define SHIFT_16BIT                 16U
+#define SHIFT_24BIT                 24U
 
 
 /* Return number of length octets for encoding value length. */
@@ -67,4 +84,37 @@ uint32_t get_length_octets(uint32_t buffer_lenght);
 /* Return number of tag octets for encoding tag. */
 uint32_t get_tag_octets(uint32_t tag);
 
+/* Encode the tag (class and tag number) into the TLV encoded buffer, returns number of tag octets. */
+uint32_t encode_tag_octets(uint8_t * p_tlv_encoded_buffer, uint32_t tlv_tag);
+
+/* Encode the definite value length into the TLV encoded buffer, returns number of length octets. */
+uint32_t encode_length_octets(uint8_t * p_tlv_encoded_buffer, uint32_t value_length);
+
+/* Allocate zero initialized memory from the TLV arena (from heap if the TLV arena is NULL), returns NULL if no memory. */
+void_t * allocate_tlv_memory(tlv_arena_t * p_tlv_arena, uint32_t size);
+
+/* Free memory allocated with allocate_tlv_memory() from heap (memory allocated from the TLV arena is released on reset). */
+void_t free_tlv_memory(tlv_arena_t * p_tlv_arena, void_t * p_memory);
+
+/* Allocate memory from heap with the TLV allocator (not zero initialized), returns NULL if no memory. */
+void_t * allocate_tlv_heap_memory(uint32_t size);
+
+/* Free memory allocated with allocate_tlv_heap_memory(). */
+void_t free_tlv_heap_memory(void_t * p_memory);
+
+/* Get the TLV codec of the tag number, returns NULL if the tag is not supported. */
+const tlv_codec_t * get_tlv_codec(uint32_t tlv_tag);
+
+/* Find the first octet (from the buffer index) that can be the first tag octet of a TLV object, returns buffer length if not found. */
+uint32_t find_tlv_tag_octet(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t buffer_index);
+
+/* Find the first end of contents octets (two 0x00 octets) from the buffer index, returns buffer length if not found. */
+uint32_t find_end_of_contents_octets(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t buffer_index);
+
+/*
+ * Get index of the TLV data buffer after the end of contents octets of the indefinite length container TLV object (the buffer index is
+ * after the tag and length octets of the container), containers within the container are skipped with their own end of contents octets.
+ */
+uint32_t skip_indefinite_length_tlv_object(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t buffer_index);
+
 #endif /* __TLV_DEFINITION_H__ */
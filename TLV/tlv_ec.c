@@ -11,17 +11,30 @@
 
 #include "tlv_api.h"
 #include "tlv.h"
+#include "tlv_definition.h"
+#include "tlv_stream_parser.h"
 #include "error_assert.h"
 
-/*
- * Internal function - Error check tag number.
- * Note: currently only few tags are supported thus this tag check function is sufficient.
- */
-static uint32_t check_tag(uint32_t tag_number, uint32_t app_data_size);
+/* Internal function - Error check tag number and value with the TLV codec of the tag number. */
+static uint32_t check_tag(uint32_t tag_number, const uint8_t * p_tlv_value, uint32_t data_length);
 
 /* Error check for create TLV object function. */
 uint32_t create_tlv_object_ec(tlv_object_t * p_tlv_object, uint32_t tlv_tag, uint8_t * p_tlv_value, uint32_t value_length)
 {
+    /* TLV encoded buffer is allocated from heap. */
+    return create_tlv_object_in_arena_ec(NULL, p_tlv_object, tlv_tag, p_tlv_value, value_length);
+}
+
+/* Error check for create TLV object in the TLV arena function. */
+uint32_t create_tlv_object_in_arena_ec(tlv_arena_t * p_tlv_arena, tlv_object_t * p_tlv_object, uint32_t tlv_tag, uint8_t * p_tlv_value, uint32_t value_length)
+{
+    /* Check TLV arena (if any) is initialized. */
+    assert((p_tlv_arena) && (!p_tlv_arena->p_arena_buffer));
+    if ((p_tlv_arena) && (!p_tlv_arena->p_arena_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
     /* Check if TLV point is valid. */
     assert(!p_tlv_object);
     if (!p_tlv_object)
@@ -47,10 +60,10 @@ uint32_t create_tlv_object_ec(tlv_object_t * p_tlv_object, uint32_t tlv_tag, uin
 
     /* Check TLV tag and constraints. */
     TLV_STATUS status = TLV_FAIL;
-    status = check_tag(tlv_tag, value_length);
+    status = check_tag(tlv_tag, p_tlv_value, value_length);
     if (TLV_SUCCESS == status)
     {
-        status = create_tlv_object(p_tlv_object, tlv_tag, p_tlv_value, value_length);
+        status = create_tlv_object_in_arena(p_tlv_arena, p_tlv_object, tlv_tag, p_tlv_value, value_length);
     }
 
     /* Return status. */
@@ -138,7 +151,7 @@ uint32_t add_data_to_tlv_object_ec(tlv_object_t * p_tlv_object, uint32_t tlv_tag
 
     /* Check TLV tag and constraints. */
     TLV_STATUS status = TLV_FAIL;
-    status = check_tag(tlv_tag, value_length);
+    status = check_tag(tlv_tag, p_tlv_value, value_length);
     if (TLV_SUCCESS == status)
     {
         status = add_data_to_tlv_object(p_tlv_object, tlv_tag, p_tlv_value, value_length);
@@ -151,6 +164,20 @@ uint32_t add_data_to_tlv_object_ec(tlv_object_t * p_tlv_object, uint32_t tlv_tag
 /* Error check for parse TLV data buffer function. */
 uint32_t parse_tlv_object_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_t * p_tlv_object)
 {
+    /* TLV encoded buffer is allocated from heap. */
+    return parse_tlv_object_in_arena_ec(NULL, p_tlv_data_buffer, buffer_length, p_tlv_object);
+}
+
+/* Error check for parse TLV data buffer in the TLV arena function. */
+uint32_t parse_tlv_object_in_arena_ec(tlv_arena_t * p_tlv_arena, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_t * p_tlv_object)
+{
+    /* Check TLV arena (if any) is initialized. */
+    assert((p_tlv_arena) && (!p_tlv_arena->p_arena_buffer));
+    if ((p_tlv_arena) && (!p_tlv_arena->p_arena_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
     /* Check TLV point is valid. */
     assert(!p_tlv_object);
     if (!p_tlv_object)
@@ -172,7 +199,7 @@ uint32_t parse_tlv_object_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_
     }
 
     TLV_STATUS status = TLV_FAIL;
-    status = parse_tlv_object(p_tlv_data_buffer, buffer_length, p_tlv_object);
+    status = parse_tlv_object_in_arena(p_tlv_arena, p_tlv_data_buffer, buffer_length, p_tlv_object);
 
     /* Return status. */
     return status;
@@ -207,42 +234,958 @@ uint32_t tlv_search_tag_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_le
     return status;
 }
 
-/*
- * Internal function - Error check tag number.
- * Note: currently only few tags are supported thus this tag check function is sufficient.
- */
-static uint32_t check_tag(uint32_t tag_number, uint32_t data_length)
+/* Error check for parse TLV data buffer into a TLV object view function. */
+uint32_t parse_tlv_object_view_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_view_t * p_tlv_object_view)
 {
-    /* Check any constraints that application put on the tags. */
-    switch (tag_number)
+    /* Check TLV object view pointer is valid. */
+    assert(!p_tlv_object_view);
+    if (!p_tlv_object_view)
     {
-        case TAG_INTEGER:
-        {
-            assert(!data_length || data_length > MAX_INTEGER_BYTES);
-            if (!data_length || data_length > MAX_INTEGER_BYTES)
-            {
-                return TLV_BAD_DATA_SIZE;
-            }
-        }
-        break;
-        case TAG_UTF8STRING:
-        {
-            assert(!data_length || data_length > MAX_UTF8STRING_LENGTH);
-            if (!data_length || data_length > MAX_UTF8STRING_LENGTH)
-            {
-                return TLV_BAD_DATA_SIZE;
-            }
-        }
-        break;
-        /* add required check for each universal tag. */
-        default:
-        {
-            assert((TAG_END_OF_CONTENT == tag_number) || (TAG_MAX < tag_number));
-            if ((TAG_END_OF_CONTENT == tag_number) || (TAG_MAX < tag_number))
-            {
-                return TLV_TAG_NOT_SUPPORTED;
-            }
-        }
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    assert(!p_tlv_data_buffer);
+    if (!p_tlv_data_buffer)
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    /* Check buffer length. */
+    assert(!buffer_length);
+    if (!buffer_length)
+    {
+        return TLV_BAD_BUFFER_LENGTH;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = parse_tlv_object_view(p_tlv_data_buffer, buffer_length, p_tlv_object_view);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for search TLV encoded data object in the TLV data buffer into a TLV object view function. */
+uint32_t tlv_search_tag_view_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tag, bool_t b_recursive, tlv_object_view_t * p_tlv_object_view)
+{
+    /* Check TLV object view pointer is valid. */
+    assert(!p_tlv_object_view);
+    if (!p_tlv_object_view)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    assert(!p_tlv_data_buffer);
+    if (!p_tlv_data_buffer)
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    /* Check buffer length. */
+    assert(!buffer_length);
+    if (!buffer_length)
+    {
+        return TLV_BAD_BUFFER_LENGTH;
+    }
+
+    /* Check tag number. */
+    assert((TAG_END_OF_CONTENT == tag) || (TAG_MAX_EXTENDED < tag));
+    if ((TAG_END_OF_CONTENT == tag) || (TAG_MAX_EXTENDED < tag))
+    {
+        return TLV_TAG_NOT_SUPPORTED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_search_tag_view(p_tlv_data_buffer, buffer_length, tag, b_recursive, p_tlv_object_view);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for initialize the TLV stream parser function. */
+uint32_t tlv_stream_parser_init_ec(tlv_stream_parser_t * p_tlv_stream_parser, uint8_t * p_tlv_object_buffer, uint32_t tlv_object_buffer_size,
+    tlv_stream_callback_t p_callback, void_t * p_callback_data)
+{
+    /* Check TLV stream parser pointer is valid. */
+    assert(!p_tlv_stream_parser);
+    if (!p_tlv_stream_parser)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check TLV object buffer is valid. */
+    assert(!p_tlv_object_buffer);
+    if (!p_tlv_object_buffer)
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    /* TLV object buffer should at least hold the tag and length octets of a TLV object. */
+    assert(tlv_object_buffer_size < TLV_STREAM_MAX_HEADER_LENGTH);
+    if (tlv_object_buffer_size < TLV_STREAM_MAX_HEADER_LENGTH)
+    {
+        return TLV_BAD_BUFFER_LENGTH;
+    }
+
+    /* Check callback is valid. */
+    assert(!p_callback);
+    if (!p_callback)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_stream_parser_init(p_tlv_stream_parser, p_tlv_object_buffer, tlv_object_buffer_size, p_callback, p_callback_data);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for feed TLV data to the TLV stream parser function. */
+uint32_t tlv_stream_parser_feed_ec(tlv_stream_parser_t * p_tlv_stream_parser, const uint8_t * p_tlv_data, uint32_t data_length)
+{
+    /* Check TLV stream parser pointer is valid and the TLV stream parser is initialized. */
+    assert((!p_tlv_stream_parser) || (!p_tlv_stream_parser->p_tlv_object_buffer));
+    if ((!p_tlv_stream_parser) || (!p_tlv_stream_parser->p_tlv_object_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    assert(!p_tlv_data);
+    if (!p_tlv_data)
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_stream_parser_feed(p_tlv_stream_parser, p_tlv_data, data_length);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for reset the TLV stream parser function. */
+uint32_t tlv_stream_parser_reset_ec(tlv_stream_parser_t * p_tlv_stream_parser)
+{
+    /* Check TLV stream parser pointer is valid. */
+    assert(!p_tlv_stream_parser);
+    if (!p_tlv_stream_parser)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_stream_parser_reset(p_tlv_stream_parser);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for set the value callback of the TLV stream parser function. */
+uint32_t tlv_stream_parser_set_value_callback_ec(tlv_stream_parser_t * p_tlv_stream_parser, tlv_stream_value_callback_t p_value_callback)
+{
+    /* Check TLV stream parser pointer is valid and the TLV stream parser is initialized. */
+    assert((!p_tlv_stream_parser) || (!p_tlv_stream_parser->p_tlv_object_buffer));
+    if ((!p_tlv_stream_parser) || (!p_tlv_stream_parser->p_tlv_object_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_stream_parser_set_value_callback(p_tlv_stream_parser, p_value_callback);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for initialize the TLV writer function. */
+uint32_t tlv_writer_init_ec(tlv_writer_t * p_tlv_writer, uint8_t * p_tlv_data_buffer, uint32_t buffer_size)
+{
+    /* Check TLV writer pointer is valid. */
+    assert(!p_tlv_writer);
+    if (!p_tlv_writer)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check TLV data buffer is valid. */
+    assert(!p_tlv_data_buffer);
+    if (!p_tlv_data_buffer)
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    assert(!buffer_size);
+    if (!buffer_size)
+    {
+        return TLV_BAD_BUFFER_LENGTH;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_writer_init(p_tlv_writer, p_tlv_data_buffer, buffer_size);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for encode an integer TLV object function. */
+uint32_t tlv_writer_add_integer_ec(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_value, uint32_t value_length)
+{
+    /* Check TLV writer pointer is valid and the TLV writer is initialized. */
+    assert((!p_tlv_writer) || (!p_tlv_writer->p_tlv_data_buffer));
+    if ((!p_tlv_writer) || (!p_tlv_writer->p_tlv_data_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    assert(!p_value);
+    if (!p_value)
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    /* Check integer value length. */
+    assert(!value_length || value_length > MAX_INTEGER_BYTES);
+    if (!value_length || value_length > MAX_INTEGER_BYTES)
+    {
+        return TLV_BAD_DATA_SIZE;
+    }
+
+    /* Check tag number. */
+    assert((TAG_END_OF_CONTENT == tlv_tag) || (ONE_OCTET_TAG_MAX == tlv_tag) || (TAG_MAX_EXTENDED < tlv_tag));
+    if ((TAG_END_OF_CONTENT == tlv_tag) || (ONE_OCTET_TAG_MAX == tlv_tag) || (TAG_MAX_EXTENDED < tlv_tag))
+    {
+        return TLV_TAG_NOT_SUPPORTED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_writer_add_integer(p_tlv_writer, tlv_tag, p_value, value_length);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for encode an array of integer TLV objects function. */
+uint32_t tlv_writer_add_integer_array_ec(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_values, uint32_t value_size,
+    uint32_t value_count)
+{
+    /* Check TLV writer pointer is valid and the TLV writer is initialized. */
+    assert((!p_tlv_writer) || (!p_tlv_writer->p_tlv_data_buffer));
+    if ((!p_tlv_writer) || (!p_tlv_writer->p_tlv_data_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    assert((!p_values) && (value_count));
+    if ((!p_values) && (value_count))
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    /* Check integer value length. */
+    assert(!value_size || value_size > MAX_INTEGER_BYTES);
+    if (!value_size || value_size > MAX_INTEGER_BYTES)
+    {
+        return TLV_BAD_DATA_SIZE;
+    }
+
+    /* Check tag number. */
+    assert((TAG_END_OF_CONTENT == tlv_tag) || (ONE_OCTET_TAG_MAX == tlv_tag) || (TAG_MAX_EXTENDED < tlv_tag));
+    if ((TAG_END_OF_CONTENT == tlv_tag) || (ONE_OCTET_TAG_MAX == tlv_tag) || (TAG_MAX_EXTENDED < tlv_tag))
+    {
+        return TLV_TAG_NOT_SUPPORTED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_writer_add_integer_array(p_tlv_writer, tlv_tag, p_values, value_size, value_count);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for decode the integer TLV objects into an array function. */
+uint32_t tlv_decode_integer_array_ec(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tlv_tag, uint8_t * p_values,
+    uint32_t value_size, uint32_t max_value_count, uint32_t * p_value_count)
+{
+    /* Check TLV data buffer is valid. */
+    assert((!p_tlv_data_buffer) && (buffer_length));
+    if ((!p_tlv_data_buffer) && (buffer_length))
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    assert(((!p_values) && (max_value_count)) || (!p_value_count));
+    if (((!p_values) && (max_value_count)) || (!p_value_count))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check integer value length. */
+    assert(!value_size || value_size > MAX_INTEGER_BYTES);
+    if (!value_size || value_size > MAX_INTEGER_BYTES)
+    {
+        return TLV_BAD_DATA_SIZE;
+    }
+
+    /* Check tag number. */
+    assert((TAG_END_OF_CONTENT == tlv_tag) || (ONE_OCTET_TAG_MAX == tlv_tag) || (TAG_MAX_EXTENDED < tlv_tag));
+    if ((TAG_END_OF_CONTENT == tlv_tag) || (ONE_OCTET_TAG_MAX == tlv_tag) || (TAG_MAX_EXTENDED < tlv_tag))
+    {
+        return TLV_TAG_NOT_SUPPORTED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_decode_integer_array(p_tlv_data_buffer, buffer_length, tlv_tag, p_values, value_size, max_value_count, p_value_count);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for encode a TLV object with the value octets function. */
+uint32_t tlv_writer_add_value_ec(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_value, uint32_t value_length)
+{
+    /* Check TLV writer pointer is valid and the TLV writer is initialized. */
+    assert((!p_tlv_writer) || (!p_tlv_writer->p_tlv_data_buffer));
+    if ((!p_tlv_writer) || (!p_tlv_writer->p_tlv_data_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    assert(!p_value && value_length);
+    if (!p_value && value_length)
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    /* Check buffer (value) length is valid. */
+    assert(value_length > APP_TAG_MAX_VALUE_LENGTH);
+    if (value_length > APP_TAG_MAX_VALUE_LENGTH)
+    {
+        return TLV_BAD_DATA_SIZE;
+    }
+
+    /* Tag number 31 has no tag encoding (one octet tags are 0 to 30, extended tags start from 32). */
+    assert(ONE_OCTET_TAG_MAX == tlv_tag);
+    if (ONE_OCTET_TAG_MAX == tlv_tag)
+    {
+        return TLV_TAG_NOT_SUPPORTED;
+    }
+
+    /* Check tag number and tag constraints. */
+    TLV_STATUS status = check_tag(tlv_tag, p_value, value_length);
+    if (TLV_SUCCESS == status)
+    {
+        status = tlv_writer_add_value(p_tlv_writer, tlv_tag, p_value, value_length);
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for open a container TLV object function. */
+uint32_t tlv_writer_open_container_ec(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, bool_t b_length_definite)
+{
+    /* Check TLV writer pointer is valid and the TLV writer is initialized. */
+    assert((!p_tlv_writer) || (!p_tlv_writer->p_tlv_data_buffer));
+    if ((!p_tlv_writer) || (!p_tlv_writer->p_tlv_data_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Only application class tags are encoded as constructed (container) TLV objects (tag number 31 has no tag encoding). */
+    assert((ONE_OCTET_TAG_MAX >= tlv_tag) || (TAG_MAX_EXTENDED < tlv_tag));
+    if ((ONE_OCTET_TAG_MAX >= tlv_tag) || (TAG_MAX_EXTENDED < tlv_tag))
+    {
+        return TLV_TAG_NOT_SUPPORTED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_writer_open_container(p_tlv_writer, tlv_tag, b_length_definite);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for close the last opened container TLV object function. */
+uint32_t tlv_writer_close_container_ec(tlv_writer_t * p_tlv_writer)
+{
+    /* Check TLV writer pointer is valid and the TLV writer is initialized. */
+    assert((!p_tlv_writer) || (!p_tlv_writer->p_tlv_data_buffer));
+    if ((!p_tlv_writer) || (!p_tlv_writer->p_tlv_data_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_writer_close_container(p_tlv_writer);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for get the number of encoded octets function. */
+uint32_t tlv_writer_finish_ec(tlv_writer_t * p_tlv_writer, uint32_t * p_encoded_length)
+{
+    /* Check TLV writer pointer is valid and the TLV writer is initialized. */
+    assert((!p_tlv_writer) || (!p_tlv_writer->p_tlv_data_buffer));
+    if ((!p_tlv_writer) || (!p_tlv_writer->p_tlv_data_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    assert(!p_encoded_length);
+    if (!p_encoded_length)
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_writer_finish(p_tlv_writer, p_encoded_length);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for initialize the TLV arena function. */
+uint32_t tlv_arena_init_ec(tlv_arena_t * p_tlv_arena, uint8_t * p_arena_buffer, uint32_t arena_size)
+{
+    /* Check TLV arena pointer is valid. */
+    assert(!p_tlv_arena);
+    if (!p_tlv_arena)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check arena memory is valid. */
+    assert(!p_arena_buffer);
+    if (!p_arena_buffer)
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    assert(!arena_size);
+    if (!arena_size)
+    {
+        return TLV_BAD_BUFFER_LENGTH;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_arena_init(p_tlv_arena, p_arena_buffer, arena_size);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for reset the TLV arena function. */
+uint32_t tlv_arena_reset_ec(tlv_arena_t * p_tlv_arena)
+{
+    /* Check TLV arena pointer is valid and the TLV arena is initialized. */
+    assert((!p_tlv_arena) || (!p_tlv_arena->p_arena_buffer));
+    if ((!p_tlv_arena) || (!p_tlv_arena->p_arena_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_arena_reset(p_tlv_arena);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for build the TLV index function. */
+uint32_t tlv_index_build_ec(tlv_index_t * p_tlv_index, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length,
+    tlv_index_node_t * p_tlv_index_nodes, uint32_t max_node_count)
+{
+    /* Check TLV index and TLV index nodes pointers are valid. */
+    assert((!p_tlv_index) || (!p_tlv_index_nodes));
+    if ((!p_tlv_index) || (!p_tlv_index_nodes))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    assert(!max_node_count);
+    if (!max_node_count)
+    {
+        return TLV_NO_MEMORY;
+    }
+
+    assert(!p_tlv_data_buffer);
+    if (!p_tlv_data_buffer)
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    assert(!buffer_length);
+    if (!buffer_length)
+    {
+        return TLV_BAD_BUFFER_LENGTH;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_index_build(p_tlv_index, p_tlv_data_buffer, buffer_length, p_tlv_index_nodes, max_node_count);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for search the first TLV object with the tag in the TLV index function. */
+uint32_t tlv_index_search_tag_ec(const tlv_index_t * p_tlv_index, uint32_t tag, uint32_t * p_node_index)
+{
+    /* Check TLV index pointer is valid and the TLV index is built. */
+    assert((!p_tlv_index) || (!p_tlv_index->p_tlv_index_nodes) || (!p_node_index));
+    if ((!p_tlv_index) || (!p_tlv_index->p_tlv_index_nodes) || (!p_node_index))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check tag number. */
+    assert((TAG_END_OF_CONTENT == tag) || (TAG_MAX_EXTENDED < tag));
+    if ((TAG_END_OF_CONTENT == tag) || (TAG_MAX_EXTENDED < tag))
+    {
+        return TLV_TAG_NOT_SUPPORTED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_index_search_tag(p_tlv_index, tag, p_node_index);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for find the child TLV object with the tag in the container node function. */
+uint32_t tlv_index_find_child_ec(const tlv_index_t * p_tlv_index, uint32_t container_node_index, uint32_t tag, uint32_t * p_node_index)
+{
+    /* Check TLV index pointer is valid and the TLV index is built. */
+    assert((!p_tlv_index) || (!p_tlv_index->p_tlv_index_nodes) || (!p_node_index));
+    if ((!p_tlv_index) || (!p_tlv_index->p_tlv_index_nodes) || (!p_node_index))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check container node is in the TLV index and is a container. */
+    if (TLV_INDEX_NO_NODE != container_node_index)
+    {
+        assert(container_node_index >= p_tlv_index->node_count);
+        if (container_node_index >= p_tlv_index->node_count)
+        {
+            return TLV_OBJECT_INVALID_PTR;
+        }
+
+        assert(FALSE == TLV_INDEX_NODE_IS_CONTAINER(&p_tlv_index->p_tlv_index_nodes[container_node_index]));
+        if (FALSE == TLV_INDEX_NODE_IS_CONTAINER(&p_tlv_index->p_tlv_index_nodes[container_node_index]))
+        {
+            return TLV_NOT_A_CONTAINER;
+        }
+    }
+
+    /* Check tag number. */
+    assert((TAG_END_OF_CONTENT == tag) || (TAG_MAX_EXTENDED < tag));
+    if ((TAG_END_OF_CONTENT == tag) || (TAG_MAX_EXTENDED < tag))
+    {
+        return TLV_TAG_NOT_SUPPORTED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_index_find_child(p_tlv_index, container_node_index, tag, p_node_index);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for get the TLV object view of the TLV index node function. */
+uint32_t tlv_index_get_view_ec(const tlv_index_t * p_tlv_index, uint32_t node_index, tlv_object_view_t * p_tlv_object_view)
+{
+    /* Check TLV index and TLV object view pointers are valid and the TLV index is built. */
+    assert((!p_tlv_index) || (!p_tlv_index->p_tlv_index_nodes) || (!p_tlv_object_view));
+    if ((!p_tlv_index) || (!p_tlv_index->p_tlv_index_nodes) || (!p_tlv_object_view))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check node is in the TLV index. */
+    assert(node_index >= p_tlv_index->node_count);
+    if (node_index >= p_tlv_index->node_count)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_index_get_view(p_tlv_index, node_index, p_tlv_object_view);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for create the TLV batch pool function. */
+uint32_t tlv_batch_pool_create_ec(uint32_t worker_thread_count, tlv_batch_pool_t ** pp_tlv_batch_pool)
+{
+    /* Check TLV batch pool pointer is valid. */
+    assert(!pp_tlv_batch_pool);
+    if (!pp_tlv_batch_pool)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check worker thread count. */
+    assert(TLV_BATCH_MAX_WORKER_THREADS < worker_thread_count);
+    if (TLV_BATCH_MAX_WORKER_THREADS < worker_thread_count)
+    {
+        return TLV_BAD_DATA_SIZE;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_batch_pool_create(worker_thread_count, pp_tlv_batch_pool);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for decode a batch of messages function. */
+uint32_t tlv_batch_decode_ec(tlv_batch_pool_t * p_tlv_batch_pool, tlv_batch_message_t * p_tlv_batch_messages, uint32_t message_count,
+    tlv_batch_callback_t p_callback, void_t * p_callback_data)
+{
+    /* Check TLV batch pool and messages pointers are valid. */
+    assert((!p_tlv_batch_pool) || (!p_tlv_batch_messages));
+    if ((!p_tlv_batch_pool) || (!p_tlv_batch_messages))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check each message, same checks as build the TLV index. */
+    for (uint32_t i = 0U; i < message_count; i++)
+    {
+        assert((!p_tlv_batch_messages[i].p_tlv_index_nodes) || (!p_tlv_batch_messages[i].max_node_count));
+        if ((!p_tlv_batch_messages[i].p_tlv_index_nodes) || (!p_tlv_batch_messages[i].max_node_count))
+        {
+            return TLV_NO_MEMORY;
+        }
+
+        assert((!p_tlv_batch_messages[i].p_tlv_data_buffer) || (!p_tlv_batch_messages[i].buffer_length));
+        if ((!p_tlv_batch_messages[i].p_tlv_data_buffer) || (!p_tlv_batch_messages[i].buffer_length))
+        {
+            return TLV_DATA_BUFFER_INVALID;
+        }
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_batch_decode(p_tlv_batch_pool, p_tlv_batch_messages, message_count, p_callback, p_callback_data);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for destroy the TLV batch pool function. */
+uint32_t tlv_batch_pool_destroy_ec(tlv_batch_pool_t * p_tlv_batch_pool)
+{
+    /* Check TLV batch pool pointer is valid. */
+    assert(!p_tlv_batch_pool);
+    if (!p_tlv_batch_pool)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_batch_pool_destroy(p_tlv_batch_pool);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for register the TLV codec of a tag number function. */
+uint32_t tlv_codec_register_ec(uint32_t tlv_tag, const tlv_codec_t * p_tlv_codec)
+{
+    /* Check tag number, TLV codecs are registered for tag numbers up to TAG_MAX. */
+    assert((TAG_END_OF_CONTENT == tlv_tag) || (TAG_MAX < tlv_tag));
+    if ((TAG_END_OF_CONTENT == tlv_tag) || (TAG_MAX < tlv_tag))
+    {
+        return TLV_TAG_NOT_SUPPORTED;
+    }
+
+    /* Check TLV codec (if any) of a universal tag can create and write the TLV objects. */
+    assert((p_tlv_codec) && (TAG_MAX_UNIVERSAL >= tlv_tag) && ((!p_tlv_codec->p_create) || (!p_tlv_codec->p_add_data)));
+    if ((p_tlv_codec) && (TAG_MAX_UNIVERSAL >= tlv_tag) && ((!p_tlv_codec->p_create) || (!p_tlv_codec->p_add_data)))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check value length bound of the TLV codec. */
+    assert((p_tlv_codec) && (p_tlv_codec->min_value_length > p_tlv_codec->max_value_length));
+    if ((p_tlv_codec) && (p_tlv_codec->min_value_length > p_tlv_codec->max_value_length))
+    {
+        return TLV_BAD_DATA_SIZE;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_codec_register(tlv_tag, p_tlv_codec);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for create container TLV object function. */
+uint32_t create_tlv_container_ec(tlv_object_t * p_tlv_object, uint32_t tlv_tag, bool_t b_length_definite)
+{
+    /* TLV encoded buffer is allocated from heap. */
+    return create_tlv_container_in_arena_ec(NULL, p_tlv_object, tlv_tag, b_length_definite);
+}
+
+/* Error check for create container TLV object in the TLV arena function. */
+uint32_t create_tlv_container_in_arena_ec(tlv_arena_t * p_tlv_arena, tlv_object_t * p_tlv_object, uint32_t tlv_tag, bool_t b_length_definite)
+{
+    /* Check TLV arena (if any) is initialized. */
+    assert((p_tlv_arena) && (!p_tlv_arena->p_arena_buffer));
+    if ((p_tlv_arena) && (!p_tlv_arena->p_arena_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check if TLV point is valid. */
+    assert(!p_tlv_object);
+    if (!p_tlv_object)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Only application class tags are encoded as constructed (container) TLV objects (tag number 31 has no tag encoding). */
+    assert((ONE_OCTET_TAG_MAX >= tlv_tag) || (TAG_MAX_EXTENDED < tlv_tag));
+    if ((ONE_OCTET_TAG_MAX >= tlv_tag) || (TAG_MAX_EXTENDED < tlv_tag))
+    {
+        return TLV_TAG_NOT_SUPPORTED;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = create_tlv_container_in_arena(p_tlv_arena, p_tlv_object, tlv_tag, b_length_definite);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for get the encoded length of the TLV object function. */
+uint32_t get_tlv_object_encoded_length_ec(tlv_object_t * p_tlv_object, uint32_t * p_encoded_length)
+{
+    /* Check if TLV object pointer is valid. */
+    assert((!p_tlv_object) || (!p_tlv_object->p_tlv_object_encoded_buffer));
+    if ((!p_tlv_object) || (!p_tlv_object->p_tlv_object_encoded_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    assert(!p_encoded_length);
+    if (!p_encoded_length)
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = get_tlv_object_encoded_length(p_tlv_object, p_encoded_length);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for encode the TLV object into the TLV data buffer function. */
+uint32_t encode_tlv_object_ec(tlv_object_t * p_tlv_object, uint8_t * p_tlv_data_buffer, uint32_t buffer_size, uint32_t * p_encoded_length)
+{
+    /* Check if TLV object pointer is valid. */
+    assert((!p_tlv_object) || (!p_tlv_object->p_tlv_object_encoded_buffer));
+    if ((!p_tlv_object) || (!p_tlv_object->p_tlv_object_encoded_buffer))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    assert((!p_tlv_data_buffer) || (!p_encoded_length));
+    if ((!p_tlv_data_buffer) || (!p_encoded_length))
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = encode_tlv_object(p_tlv_object, p_tlv_data_buffer, buffer_size, p_encoded_length);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for initialize the TLV frame reader function. */
+uint32_t tlv_frame_reader_init_ec(tlv_frame_reader_t * p_tlv_frame_reader, uint32_t max_message_length)
+{
+    /* Check TLV frame reader pointer is valid. */
+    assert(!p_tlv_frame_reader);
+    if (!p_tlv_frame_reader)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    assert(!max_message_length);
+    if (!max_message_length)
+    {
+        return TLV_BAD_BUFFER_LENGTH;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_frame_reader_init(p_tlv_frame_reader, max_message_length);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for check a complete top level TLV message is received function. */
+uint32_t tlv_frame_reader_check_ec(tlv_frame_reader_t * p_tlv_frame_reader, const tlv_data_segment_t * p_tlv_data_segments, uint32_t segment_count,
+    uint32_t * p_message_length)
+{
+    /* Check TLV frame reader pointer is valid and the TLV frame reader is initialized. */
+    assert((!p_tlv_frame_reader) || (!p_tlv_frame_reader->max_message_length));
+    if ((!p_tlv_frame_reader) || (!p_tlv_frame_reader->max_message_length))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    assert((!p_tlv_data_segments) || (!p_message_length));
+    if ((!p_tlv_data_segments) || (!p_message_length))
+    {
+        return TLV_DATA_BUFFER_INVALID;
+    }
+
+    /* Check TLV data of the TLV data segments is valid. */
+    for (uint32_t index = 0U; index < segment_count; index++)
+    {
+        assert((p_tlv_data_segments[index].data_length) && (!p_tlv_data_segments[index].p_tlv_data));
+        if ((p_tlv_data_segments[index].data_length) && (!p_tlv_data_segments[index].p_tlv_data))
+        {
+            return TLV_DATA_BUFFER_INVALID;
+        }
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_frame_reader_check(p_tlv_frame_reader, p_tlv_data_segments, segment_count, p_message_length);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for reset the TLV frame reader function. */
+uint32_t tlv_frame_reader_reset_ec(tlv_frame_reader_t * p_tlv_frame_reader)
+{
+    /* Check TLV frame reader pointer is valid and the TLV frame reader is initialized. */
+    assert((!p_tlv_frame_reader) || (!p_tlv_frame_reader->max_message_length));
+    if ((!p_tlv_frame_reader) || (!p_tlv_frame_reader->max_message_length))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_frame_reader_reset(p_tlv_frame_reader);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for free the TLV encoded buffer of the TLV object function. */
+uint32_t free_tlv_object_buffer_ec(tlv_object_t * p_tlv_object)
+{
+    /* Check if TLV object pointer is valid. */
+    assert(!p_tlv_object);
+    if (!p_tlv_object)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = free_tlv_object_buffer(p_tlv_object);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for set the TLV allocator function. */
+uint32_t tlv_set_allocator_ec(const tlv_allocator_t * p_tlv_allocator)
+{
+    /* Check the TLV allocator functions are set (NULL TLV allocator, default TLV allocator). */
+    assert((p_tlv_allocator) && ((!p_tlv_allocator->p_alloc) || (!p_tlv_allocator->p_free)));
+    if ((p_tlv_allocator) && ((!p_tlv_allocator->p_alloc) || (!p_tlv_allocator->p_free)))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_set_allocator(p_tlv_allocator);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for initialize the TLV counting allocator function. */
+uint32_t tlv_counting_allocator_init_ec(tlv_counting_allocator_t * p_tlv_counting_allocator, const tlv_allocator_t * p_backing_allocator)
+{
+    /* Check TLV counting allocator pointer is valid. */
+    assert(!p_tlv_counting_allocator);
+    if (!p_tlv_counting_allocator)
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    /* Check the backing TLV allocator functions are set and it is not the TLV counting allocator itself. */
+    assert((p_backing_allocator) && ((!p_backing_allocator->p_alloc) || (!p_backing_allocator->p_free) ||
+        (p_backing_allocator == &p_tlv_counting_allocator->tlv_allocator)));
+    if ((p_backing_allocator) && ((!p_backing_allocator->p_alloc) || (!p_backing_allocator->p_free) ||
+        (p_backing_allocator == &p_tlv_counting_allocator->tlv_allocator)))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_counting_allocator_init(p_tlv_counting_allocator, p_backing_allocator);
+
+    /* Return status. */
+    return status;
+}
+
+/* Error check for reset the counts of the TLV counting allocator function. */
+uint32_t tlv_counting_allocator_reset_ec(tlv_counting_allocator_t * p_tlv_counting_allocator)
+{
+    /* Check TLV counting allocator pointer is valid and the TLV counting allocator is initialized. */
+    assert((!p_tlv_counting_allocator) || (p_tlv_counting_allocator->tlv_allocator.p_allocator_context != p_tlv_counting_allocator));
+    if ((!p_tlv_counting_allocator) || (p_tlv_counting_allocator->tlv_allocator.p_allocator_context != p_tlv_counting_allocator))
+    {
+        return TLV_OBJECT_INVALID_PTR;
+    }
+
+    TLV_STATUS status = TLV_FAIL;
+    status = tlv_counting_allocator_reset(p_tlv_counting_allocator);
+
+    /* Return status. */
+    return status;
+}
+
+/* Internal function - Error check tag number and value with the TLV codec of the tag number. */
+static uint32_t check_tag(uint32_t tag_number, const uint8_t * p_tlv_value, uint32_t data_length)
+{
+    const tlv_codec_t * p_tlv_codec = get_tlv_codec(tag_number);
+
+    if (!p_tlv_codec)
+    {
+        /* No TLV codec (universal tag not supported by the TLV objects), check the tag number only. */
+        assert((TAG_END_OF_CONTENT == tag_number) || (TAG_MAX_EXTENDED < tag_number));
+        if ((TAG_END_OF_CONTENT == tag_number) || (TAG_MAX_EXTENDED < tag_number))
+        {
+            return TLV_TAG_NOT_SUPPORTED;
+        }
+
+        /* Return Success. */
+        return TLV_SUCCESS;
+    }
+
+    /* Check the value length bound of the TLV codec. */
+    assert((data_length < p_tlv_codec->min_value_length) || (data_length > p_tlv_codec->max_value_length));
+    if ((data_length < p_tlv_codec->min_value_length) || (data_length > p_tlv_codec->max_value_length))
+    {
+        return TLV_BAD_DATA_SIZE;
+    }
+
+    /* Check any constraints that application put on the tags. */
+    if (p_tlv_codec->p_validate)
+    {
+        return p_tlv_codec->p_validate(tag_number, p_tlv_value, data_length);
     }
 
     /* Return Success. */
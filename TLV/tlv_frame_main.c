@@ -0,0 +1,178 @@
+/*
+ * Name: tlv_frame_main.c
+ *
+ * Description:
+ * THIS IS A DEMO CODE JUST TO EXCERCISE / DEMONSTRATE THE TLV FRAME READER ON THE UNREAD DATA OF A RING BUFFER
+ * (ring_buffer_peek(), tlv_frame_reader_check(), TLV stream parser, ring_buffer_skip()).
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#include "ring_buffer_api.h"
+#include "tlv_api.h"
+
+/* Max length of the demo TLV message. */
+#define FRAME_DEMO_MESSAGE_SIZE     64U
+
+/* Unread octets left at the end of the ring buffer before the demo TLV message is written (the TLV message rolls over). */
+#define FRAME_DEMO_TAIL_SIZE        7U
+
+/* Encode the demo TLV message (indefinite length container with an integer and a string). */
+static uint32_t encode_frame_message(uint8_t * p_message, uint32_t message_size, int32_t amount, uint32_t * p_message_length);
+
+/* Peek the unread data of the ring buffer, if a complete TLV message is received parse it and skip it in the ring buffer. */
+static uint32_t read_frame(rgbf_t * p_ring_buffer, tlv_frame_reader_t * p_frame_reader, uint32_t * p_segment_count, uint32_t * p_object_count,
+    uint32_t * p_message_length);
+
+/* Count the TLV objects parsed by the TLV stream parser. */
+static void_t count_tlv_object(const tlv_object_view_t * p_tlv_object_view, void_t * p_callback_data);
+
+int main(void)
+{
+    rgbf_t * p_ring_buffer = NULL;
+    tlv_frame_reader_t frame_reader;
+    uint8_t message[FRAME_DEMO_MESSAGE_SIZE];
+    uint8_t filler[RINGBUFFER_SIZE_MAX - FRAME_DEMO_TAIL_SIZE] = { 0 };
+    uint32_t message_length = 0U;
+    uint32_t frame_length = 0U;
+    uint32_t segment_count = 0U;
+    uint32_t object_count = 0U;
+    uint32_t status = TLV_FAIL;
+
+    if ((RB_SUCCESS != create_ring_buffer(&p_ring_buffer, RINGBUFFER_SIZE_MAX)) ||
+        (TLV_SUCCESS != tlv_frame_reader_init(&frame_reader, RINGBUFFER_SIZE_MAX)) ||
+        (TLV_SUCCESS != encode_frame_message(message, FRAME_DEMO_MESSAGE_SIZE, 1250, &message_length)))
+    {
+        printf("TLV frame demo setup failed \n");
+        return 1;
+    }
+
+    /* Move the read and write index near the end of the ring buffer, the TLV message rolls over to the start. */
+    (void_t)block_write_to_ring_buffer(p_ring_buffer, filler, (uint32_t)sizeof(filler), FALSE);
+    (void_t)ring_buffer_skip(p_ring_buffer, (uint32_t)sizeof(filler));
+
+    /* Partial TLV message (up to the middle of the string), the TLV message is left in the ring buffer. */
+    (void_t)block_write_to_ring_buffer(p_ring_buffer, message, (message_length - 4U), FALSE);
+    status = read_frame(p_ring_buffer, &frame_reader, &segment_count, &object_count, &frame_length);
+    printf("Partial TLV message: status 0x%X, segments %u - %s \n", status, segment_count,
+        ((TLV_FRAME_INCOMPLETE == status) && (2U == segment_count)) ? "incomplete as expected" : "FAILED");
+
+    /* Rest of the TLV message, the TLV message is complete in two segments (rolled over). */
+    (void_t)block_write_to_ring_buffer(p_ring_buffer, &message[message_length - 4U], 4U, FALSE);
+    status = read_frame(p_ring_buffer, &frame_reader, &segment_count, &object_count, &frame_length);
+    printf("Rolled over TLV message: status 0x%X, segments %u, length %u of %u, TLV objects %u - %s \n", status, segment_count,
+        frame_length, message_length, object_count,
+        ((TLV_SUCCESS == status) && (2U == segment_count) && (frame_length == message_length)) ? "complete" : "FAILED");
+
+    /* Two TLV messages in one segment, each TLV message is read on its own. */
+    (void_t)encode_frame_message(message, FRAME_DEMO_MESSAGE_SIZE, -7, &message_length);
+    (void_t)block_write_to_ring_buffer(p_ring_buffer, message, message_length, FALSE);
+    (void_t)block_write_to_ring_buffer(p_ring_buffer, message, message_length, FALSE);
+    for (uint32_t i = 0U; i < 2U; i++)
+    {
+        status = read_frame(p_ring_buffer, &frame_reader, &segment_count, &object_count, &frame_length);
+        printf("TLV message %u in one segment: status 0x%X, segments %u, length %u of %u, TLV objects %u - %s \n", (i + 1U), status,
+            segment_count, frame_length, message_length, object_count,
+            ((TLV_SUCCESS == status) && (1U == segment_count) && (frame_length == message_length)) ? "complete" : "FAILED");
+    }
+
+    /* All the TLV messages are skipped in the ring buffer. */
+    status = read_frame(p_ring_buffer, &frame_reader, &segment_count, &object_count, &frame_length);
+    printf("Empty ring buffer: status 0x%X, segments %u - %s \n", status, segment_count,
+        ((TLV_FRAME_INCOMPLETE == status) && (!segment_count)) ? "no TLV message" : "FAILED");
+
+    (void_t)delete_ring_buffer(p_ring_buffer);
+
+    return 0;
+}
+
+/* Encode the demo TLV message (indefinite length container with an integer and a string). */
+static uint32_t encode_frame_message(uint8_t * p_message, uint32_t message_size, int32_t amount, uint32_t * p_message_length)
+{
+    tlv_writer_t tlv_writer;
+    const uint8_t txn_string[] = { 'T', 'X', 'N', '-', '0', '0', '1' };
+    TLV_STATUS status = tlv_writer_init(&tlv_writer, p_message, message_size);
+
+    if (TLV_SUCCESS == status)
+    {
+        status = tlv_writer_open_container(&tlv_writer, TAG_APP_TXN_INFO, FALSE);
+    }
+    if (TLV_SUCCESS == status)
+    {
+        status = tlv_writer_add_integer(&tlv_writer, TAG_INTEGER, (const uint8_t *)&amount, (uint32_t)sizeof(amount));
+    }
+    if (TLV_SUCCESS == status)
+    {
+        status = tlv_writer_add_value(&tlv_writer, TAG_UTF8STRING, txn_string, (uint32_t)sizeof(txn_string));
+    }
+    if (TLV_SUCCESS == status)
+    {
+        status = tlv_writer_close_container(&tlv_writer);
+    }
+    if (TLV_SUCCESS == status)
+    {
+        status = tlv_writer_finish(&tlv_writer, p_message_length);
+    }
+
+    return status;
+}
+
+/* Peek the unread data of the ring buffer, if a complete TLV message is received parse it and skip it in the ring buffer. */
+static uint32_t read_frame(rgbf_t * p_ring_buffer, tlv_frame_reader_t * p_frame_reader, uint32_t * p_segment_count, uint32_t * p_object_count,
+    uint32_t * p_message_length)
+{
+    rb_iovec_t iovec[2];
+    tlv_data_segment_t tlv_data_segments[2];
+    uint32_t status = TLV_FRAME_INCOMPLETE;
+
+    *p_segment_count = 0U;
+    *p_object_count = 0U;
+    *p_message_length = 0U;
+
+    /* Unread data in place (two segments if it rolled over to the start of the ring buffer), nothing is read out yet. */
+    if (RB_SUCCESS == ring_buffer_peek(p_ring_buffer, iovec, p_segment_count))
+    {
+        for (uint32_t i = 0U; i < *p_segment_count; i++)
+        {
+            tlv_data_segments[i].p_tlv_data = iovec[i].p_block;
+            tlv_data_segments[i].data_length = iovec[i].size;
+        }
+
+        status = tlv_frame_reader_check(p_frame_reader, tlv_data_segments, *p_segment_count, p_message_length);
+    }
+
+    if (TLV_SUCCESS == status)
+    {
+        /* The complete TLV message is fed to the TLV stream parser one segment at a time (no copy to a message buffer). */
+        tlv_stream_parser_t tlv_stream_parser;
+        uint8_t tlv_object_buffer[FRAME_DEMO_MESSAGE_SIZE];
+        uint32_t remaining_length = *p_message_length;
+
+        status = tlv_stream_parser_init(&tlv_stream_parser, tlv_object_buffer, FRAME_DEMO_MESSAGE_SIZE, count_tlv_object, p_object_count);
+        for (uint32_t i = 0U; (TLV_SUCCESS == status) && (i < *p_segment_count) && (remaining_length); i++)
+        {
+            uint32_t feed_length = (tlv_data_segments[i].data_length < remaining_length) ? tlv_data_segments[i].data_length : remaining_length;
+
+            status = tlv_stream_parser_feed(&tlv_stream_parser, tlv_data_segments[i].p_tlv_data, feed_length);
+            remaining_length -= feed_length;
+        }
+
+        /* The TLV message is read, skip it in the ring buffer. */
+        if (RB_SUCCESS != ring_buffer_skip(p_ring_buffer, *p_message_length))
+        {
+            status = TLV_FAIL;
+        }
+    }
+
+    return status;
+}
+
+/* Count the TLV objects parsed by the TLV stream parser. */
+static void_t count_tlv_object(const tlv_object_view_t * p_tlv_object_view, void_t * p_callback_data)
+{
+    if (p_tlv_object_view)
+    {
+        (*(uint32_t *)p_callback_data)++;
+    }
+}
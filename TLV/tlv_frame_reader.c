@@ -0,0 +1,277 @@
+/*
+ * Name: tlv_frame_reader.c
+ *
+ * Description:
+ * All API definitions required for the TLV frame reader (finds a complete TLV message in the received TLV data in place).
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#define TLV_OBJECT_SOURCE_CODE
+
+#include <string.h>
+
+#include "tlv_api.h"
+#include "tlv.h"
+#include "tlv_universal_class.h"
+#include "tlv_application_class.h"
+#include "tlv_definition.h"
+#include "tlv_stream_parser.h"
+
+/* Copy the TLV data octets at the offset, the TLV data octets can be split across the TLV data segments. */
+static uint32_t get_frame_octets(const tlv_data_segment_t * p_tlv_data_segments, uint32_t segment_count, uint32_t offset,
+    uint8_t * p_octets, uint32_t octet_count);
+
+/* Parse the tag and length octets of the TLV object. */
+static uint32_t parse_frame_header(const uint8_t * p_header, uint32_t header_octets, uint32_t * p_header_length,
+    uint32_t * p_value_length, bool_t * p_b_indefinite_length);
+
+/* Function to initialize the TLV frame reader. */
+uint32_t tlv_frame_reader_init(tlv_frame_reader_t * p_tlv_frame_reader, uint32_t max_message_length)
+{
+    p_tlv_frame_reader->checked_length = 0U;
+    p_tlv_frame_reader->container_depth = 0U;
+    p_tlv_frame_reader->max_message_length = max_message_length;
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Function to check if a complete top level TLV message is received in the TLV data segments. */
+uint32_t tlv_frame_reader_check(tlv_frame_reader_t * p_tlv_frame_reader, const tlv_data_segment_t * p_tlv_data_segments, uint32_t segment_count,
+    uint32_t * p_message_length)
+{
+    TLV_STATUS status = TLV_FRAME_INCOMPLETE;
+    uint32_t data_length = 0U;
+
+    for (uint32_t index = 0U; index < segment_count; index++)
+    {
+        data_length += p_tlv_data_segments[index].data_length;
+    }
+
+    /* Check the TLV objects received after the TLV objects already checked, until the top level TLV message is complete. */
+    while (p_tlv_frame_reader->checked_length < data_length)
+    {
+        uint8_t header[TLV_STREAM_MAX_HEADER_LENGTH];
+        uint32_t header_length = 0U;
+        uint32_t value_length = 0U;
+        bool_t b_indefinite_length = FALSE;
+        uint32_t header_octets = get_frame_octets(p_tlv_data_segments, segment_count, p_tlv_frame_reader->checked_length, header,
+            TLV_STREAM_MAX_HEADER_LENGTH);
+
+        status = parse_frame_header(header, header_octets, &header_length, &value_length, &b_indefinite_length);
+        if (TLV_SUCCESS != status)
+        {
+            break;
+        }
+
+        if ((!header[0]) && (!p_tlv_frame_reader->container_depth))
+        {
+            /* End of contents without an indefinite length container. */
+            status = TLV_BAD_TAG;
+            break;
+        }
+
+        if ((TRUE == b_indefinite_length) && (TLV_PARSER_MAX_CONTAINER_DEPTH <= p_tlv_frame_reader->container_depth))
+        {
+            status = TLV_MAX_CONTAINER_DEPTH;
+            break;
+        }
+
+        /* TLV message can not be longer than the max message length. */
+        if ((header_length + value_length) > (p_tlv_frame_reader->max_message_length - p_tlv_frame_reader->checked_length))
+        {
+            status = TLV_BAD_DATA_SIZE;
+            break;
+        }
+
+        /* Value octets of the TLV object are not received yet, check again after more TLV data is received. */
+        if ((header_length + value_length) > (data_length - p_tlv_frame_reader->checked_length))
+        {
+            status = TLV_FRAME_INCOMPLETE;
+            break;
+        }
+
+        p_tlv_frame_reader->checked_length += (header_length + value_length);
+
+        if (TRUE == b_indefinite_length)
+        {
+            p_tlv_frame_reader->container_depth++;
+        }
+        else if (!header[0])
+        {
+            p_tlv_frame_reader->container_depth--;
+        }
+
+        if (!p_tlv_frame_reader->container_depth)
+        {
+            /* Top level TLV message is complete. */
+            *p_message_length = p_tlv_frame_reader->checked_length;
+            break;
+        }
+
+        status = TLV_FRAME_INCOMPLETE;
+    }
+
+    if (TLV_FRAME_INCOMPLETE != status)
+    {
+        /* TLV message complete or not valid, check the next TLV message from the start. */
+        p_tlv_frame_reader->checked_length = 0U;
+        p_tlv_frame_reader->container_depth = 0U;
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to reset the TLV frame reader. */
+uint32_t tlv_frame_reader_reset(tlv_frame_reader_t * p_tlv_frame_reader)
+{
+    p_tlv_frame_reader->checked_length = 0U;
+    p_tlv_frame_reader->container_depth = 0U;
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Copy the TLV data octets at the offset, the TLV data octets can be split across the TLV data segments. */
+static uint32_t get_frame_octets(const tlv_data_segment_t * p_tlv_data_segments, uint32_t segment_count, uint32_t offset,
+    uint8_t * p_octets, uint32_t octet_count)
+{
+    uint32_t copied_octets = 0U;
+
+    for (uint32_t index = 0U; (index < segment_count) && (copied_octets < octet_count); index++)
+    {
+        uint32_t segment_length = p_tlv_data_segments[index].data_length;
+
+        if (offset >= segment_length)
+        {
+            /* Offset is in the next TLV data segments. */
+            offset -= segment_length;
+            continue;
+        }
+
+        uint32_t copy_length = segment_length - offset;
+        if (copy_length > (octet_count - copied_octets))
+        {
+            copy_length = octet_count - copied_octets;
+        }
+
+        memcpy(&p_octets[copied_octets], &p_tlv_data_segments[index].p_tlv_data[offset], copy_length);
+        copied_octets += copy_length;
+        offset = 0U;
+    }
+
+    /* Return number of octets copied. */
+    return copied_octets;
+}
+
+/* Parse the tag and length octets of the TLV object, same checks as the TLV stream parser. */
+static uint32_t parse_frame_header(const uint8_t * p_header, uint32_t header_octets, uint32_t * p_header_length,
+    uint32_t * p_value_length, bool_t * p_b_indefinite_length)
+{
+    TLV_STATUS status = TLV_SUCCESS;
+    uint8_t tag_class = (uint8_t)(p_header[0] & (uint8_t)TLV_TAG_CLASS_FILTER);
+    uint32_t tag_number = (uint32_t)(p_header[0] & (uint8_t)TLV_TAG_NUMBER_FILTER);
+    bool_t b_constructed_object = (p_header[0] & (uint8_t)TAG_UNIVERSAL_CONSTRUCTED) ? TRUE : FALSE;
+    uint32_t index = TAG_1OCTET;
+
+    *p_value_length = 0U;
+    *p_b_indefinite_length = FALSE;
+
+    /* Private class tags are not supported, tag number 0 is only allowed for end of contents. */
+    if ((TAG_PRIVATE_CLS_PRIMITIVE == tag_class) || (TAG_PRIVATE_CLS_CONSTRUCTED == tag_class) || ((!tag_number) && (p_header[0])))
+    {
+        status = TLV_BAD_TAG;
+    }
+    else if (ONE_OCTET_TAG_MAX == tag_number)
+    {
+        /* Tag number is in the extended tag octets. */
+        bool_t b_extended_tag_octet = TRUE;
+        tag_number = 0U;
+
+        while ((TLV_SUCCESS == status) && (TRUE == b_extended_tag_octet))
+        {
+            if (index >= header_octets)
+            {
+                status = TLV_FRAME_INCOMPLETE;
+            }
+            else if (index >= TAG_4OCTET)
+            {
+                status = TLV_BAD_TAG;
+            }
+            else
+            {
+                tag_number = (tag_number << SHIFT_7BIT) | (uint32_t)(p_header[index] & EXTENDED_TAG_FILTER);
+                b_extended_tag_octet = (p_header[index++] & (uint8_t)EXTENDED_TAG) ? TRUE : FALSE;
+            }
+        }
+    }
+
+    if ((TLV_SUCCESS == status) && (index >= header_octets))
+    {
+        status = TLV_FRAME_INCOMPLETE;
+    }
+
+    if (TLV_SUCCESS == status)
+    {
+        uint8_t length_octet = p_header[index++];
+
+        if (!(length_octet & (uint8_t)LONG_LENGTH_FORM))
+        {
+            *p_value_length = (uint32_t)length_octet;
+        }
+        else
+        {
+            uint32_t length_octets = (uint32_t)(length_octet & (uint8_t)LENGTH_FILTER);
+
+            if (!length_octets)
+            {
+                /* Indefinite length, only allowed for constructed container TLV objects. */
+                if ((TRUE != b_constructed_object) || (!tag_number))
+                {
+                    status = TLV_BAD_TAG;
+                }
+                else
+                {
+                    *p_b_indefinite_length = TRUE;
+                }
+            }
+            else if (length_octets > VALUE_LENGTH_4OCTET)
+            {
+                status = TLV_BAD_BUFFER_LENGTH;
+            }
+            else if ((index + length_octets) > header_octets)
+            {
+                status = TLV_FRAME_INCOMPLETE;
+            }
+            else
+            {
+                for (; length_octets; length_octets--)
+                {
+                    *p_value_length = (*p_value_length << SHIFT_8BIT) | (uint32_t)p_header[index++];
+                }
+            }
+        }
+    }
+
+    if ((TLV_SUCCESS == status) && (!tag_number) && (*p_value_length))
+    {
+        /* End of contents should not have value octets (short or long form length). */
+        status = TLV_BAD_TAG;
+    }
+    else if ((TLV_SUCCESS == status) && (*p_value_length > (FIVE_OCTET_MAX_LENGTH - index)))
+    {
+        /* The encoded TLV object length should be within 32 bits. */
+        status = TLV_BAD_BUFFER_LENGTH;
+    }
+
+    if (TLV_SUCCESS == status)
+    {
+        *p_header_length = index;
+    }
+
+    /* Return status. */
+    return status;
+}
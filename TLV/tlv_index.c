@@ -0,0 +1,255 @@
+/*
+ * Name: tlv_index.c
+ *
+ * Description:
+ * All API definitions required for the TLV index (TLV data buffer parsed once into a flat array of TLV index nodes).
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#define TLV_OBJECT_SOURCE_CODE
+
+#include "tlv_api.h"
+#include "tlv.h"
+#include "tlv_universal_class.h"
+#include "tlv_object_parser.h"
+#include "tlv_definition.h"
+
+/* Tag class of the first tag octet (without the constructed bit). */
+#define TLV_INDEX_TAG_CLASS_FILTER      (TLV_TAG_CLASS_FILTER & ~TAG_UNIVERSAL_CONSTRUCTED)
+
+/* Add the parsed TLV object to the TLV index as the last child of the parent node. */
+static uint32_t add_tlv_index_node(tlv_index_t * p_tlv_index, uint32_t buffer_index, const tlv_object_t * p_tlv_object,
+    uint32_t parent_node_index, uint32_t last_child_node_index);
+
+/*
+ * Function to build the TLV index, the TLV data buffer is parsed once (in one pass) into the TLV index nodes.
+ * Note: The containers are not parsed with recursive calls, the parent node index is used to return to the container.
+ * Containers are indexed up to TLV_PARSER_MAX_CONTAINER_DEPTH deep.
+ */
+uint32_t tlv_index_build(tlv_index_t * p_tlv_index, const uint8_t * p_tlv_data_buffer, uint32_t buffer_length,
+    tlv_index_node_t * p_tlv_index_nodes, uint32_t max_node_count)
+{
+    TLV_STATUS status = TLV_SUCCESS;
+    tlv_object_t work_tlv_object;
+    uint32_t buffer_index = 0U;
+    uint32_t parent_node_index = TLV_INDEX_NO_NODE;
+    uint32_t last_child_node_index = TLV_INDEX_NO_NODE;
+    uint32_t container_depth = 0U;
+
+    p_tlv_index->p_tlv_data_buffer = p_tlv_data_buffer;
+    p_tlv_index->buffer_length = buffer_length;
+    p_tlv_index->p_tlv_index_nodes = p_tlv_index_nodes;
+    p_tlv_index->max_node_count = max_node_count;
+    p_tlv_index->node_count = 0U;
+    for (uint32_t i = 0U; i <= TAG_MAX; i++)
+    {
+        p_tlv_index->tag_first_node_index[i] = TLV_INDEX_NO_NODE;
+    }
+
+    while (TLV_SUCCESS == status)
+    {
+        /* Close the container (indefinite length) at its end of contents octets. */
+        if ((TLV_INDEX_NO_NODE != parent_node_index) && ((buffer_index + VALUE_LENGTH_2OCTET) <= buffer_length) &&
+            ((uint8_t)TAG_END_OF_CONTENT == p_tlv_data_buffer[buffer_index]) &&
+            ((uint8_t)TAG_END_OF_CONTENT == p_tlv_data_buffer[buffer_index + 1U]))
+        {
+            tlv_index_node_t * p_parent_node = &p_tlv_index_nodes[parent_node_index];
+
+            /* Encoded length of the container is derived from the value length. */
+            p_parent_node->tlv_object_value_length = buffer_index - TLV_INDEX_NODE_VALUE_OFFSET(p_parent_node);
+            buffer_index += VALUE_LENGTH_2OCTET;
+
+            /* Return to the container's parent, the container is its last child. */
+            last_child_node_index = parent_node_index;
+            parent_node_index = p_parent_node->parent_node_index;
+            container_depth--;
+            continue;
+        }
+
+        if (buffer_index >= buffer_length)
+        {
+            /* TLV data buffer is indexed, the containers should be closed. */
+            if (TLV_INDEX_NO_NODE != parent_node_index)
+            {
+                status = TLV_BAD_BUFFER_LENGTH;
+            }
+            break;
+        }
+
+        /* Parse the tag and length octets of the next TLV object. */
+        status = get_parsed_tlv_object(&p_tlv_data_buffer[buffer_index], (buffer_length - buffer_index), &work_tlv_object);
+        if ((TLV_SUCCESS == status) && (work_tlv_object.tlv_curr_encoded_object_length > (buffer_length - buffer_index)))
+        {
+            status = TLV_BAD_BUFFER_LENGTH;
+        }
+
+        if (TLV_SUCCESS == status)
+        {
+            status = add_tlv_index_node(p_tlv_index, buffer_index, &work_tlv_object, parent_node_index, last_child_node_index);
+        }
+
+        if (TLV_SUCCESS == status)
+        {
+            uint32_t node_index = p_tlv_index->node_count - 1U;
+
+            if (TRUE == TLV_INDEX_NODE_IS_CONTAINER(&p_tlv_index_nodes[node_index]))
+            {
+                if (TLV_PARSER_MAX_CONTAINER_DEPTH <= container_depth)
+                {
+                    /* Container within too many containers. */
+                    status = TLV_MAX_CONTAINER_DEPTH;
+                    break;
+                }
+
+                /* Index the contents of the container, the next TLV object is its first child. */
+                buffer_index = TLV_INDEX_NODE_VALUE_OFFSET(&p_tlv_index_nodes[node_index]);
+                parent_node_index = node_index;
+                last_child_node_index = TLV_INDEX_NO_NODE;
+                container_depth++;
+            }
+            else
+            {
+                buffer_index += work_tlv_object.tlv_curr_encoded_object_length;
+                last_child_node_index = node_index;
+            }
+        }
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to search the first TLV object with the tag in the TLV index (O(1) for tag numbers up to TAG_MAX, no parsing). */
+uint32_t tlv_index_search_tag(const tlv_index_t * p_tlv_index, uint32_t tag, uint32_t * p_node_index)
+{
+    TLV_STATUS status = TLV_NO_TAG_FOUND;
+
+    if (tag > TAG_MAX)
+    {
+        /* Tag number is not in the tag to node map, search the TLV index nodes (in order of the TLV data buffer). */
+        for (uint32_t node_index = 0U; node_index < p_tlv_index->node_count; node_index++)
+        {
+            if (tag == TLV_INDEX_NODE_TAG_NUMBER(&p_tlv_index->p_tlv_index_nodes[node_index]))
+            {
+                *p_node_index = node_index;
+                status = TLV_SUCCESS;
+                break;
+            }
+        }
+    }
+    else if (TLV_INDEX_NO_NODE != p_tlv_index->tag_first_node_index[tag])
+    {
+        *p_node_index = p_tlv_index->tag_first_node_index[tag];
+        status = TLV_SUCCESS;
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to find the child TLV object with the tag in the container node (only the children are searched). */
+uint32_t tlv_index_find_child(const tlv_index_t * p_tlv_index, uint32_t container_node_index, uint32_t tag, uint32_t * p_node_index)
+{
+    TLV_STATUS status = TLV_NO_TAG_FOUND;
+    uint32_t node_index = TLV_INDEX_NO_NODE;
+
+    if (TLV_INDEX_NO_NODE == container_node_index)
+    {
+        /* Top level TLV objects, node 0 is the first. */
+        node_index = (p_tlv_index->node_count) ? 0U : TLV_INDEX_NO_NODE;
+    }
+    else
+    {
+        node_index = p_tlv_index->p_tlv_index_nodes[container_node_index].first_child_node_index;
+    }
+
+    while (TLV_INDEX_NO_NODE != node_index)
+    {
+        if (tag == TLV_INDEX_NODE_TAG_NUMBER(&p_tlv_index->p_tlv_index_nodes[node_index]))
+        {
+            *p_node_index = node_index;
+            status = TLV_SUCCESS;
+            break;
+        }
+        node_index = p_tlv_index->p_tlv_index_nodes[node_index].next_sibling_node_index;
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to get the TLV object view of the TLV index node. */
+uint32_t tlv_index_get_view(const tlv_index_t * p_tlv_index, uint32_t node_index, tlv_object_view_t * p_tlv_object_view)
+{
+    TLV_STATUS status = TLV_FAIL;
+    tlv_object_t work_tlv_object;
+    uint32_t buffer_index = p_tlv_index->p_tlv_index_nodes[node_index].tlv_header_offset;
+
+    /* Tag and length octets are parsed again, same view as parse_tlv_object_view(). */
+    status = get_parsed_tlv_object(&p_tlv_index->p_tlv_data_buffer[buffer_index], (p_tlv_index->buffer_length - buffer_index), &work_tlv_object);
+    if (TLV_SUCCESS == status)
+    {
+        status = update_parsed_tlv_object_view(&p_tlv_index->p_tlv_data_buffer[buffer_index], (p_tlv_index->buffer_length - buffer_index),
+            &work_tlv_object, p_tlv_object_view);
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Add the parsed TLV object to the TLV index as the last child of the parent node. */
+static uint32_t add_tlv_index_node(tlv_index_t * p_tlv_index, uint32_t buffer_index, const tlv_object_t * p_tlv_object,
+    uint32_t parent_node_index, uint32_t last_child_node_index)
+{
+    TLV_STATUS status = TLV_FAIL;
+
+    if (p_tlv_index->node_count < p_tlv_index->max_node_count)
+    {
+        uint32_t node_index = p_tlv_index->node_count;
+        tlv_index_node_t * p_node = &p_tlv_index->p_tlv_index_nodes[node_index];
+        uint8_t tag_octet = p_tlv_index->p_tlv_data_buffer[buffer_index];
+        uint32_t header_length = p_tlv_object->tlv_curr_encoded_object_length - p_tlv_object->tlv_curr_object_value_length;
+
+        /* Tag number is up to 3 extended tag octets (21 bits) and header length is up to 9 octets, same as the TLV object parser. */
+        p_node->tlv_node_info = (p_tlv_object->tlv_object_tag_number & TLV_INDEX_NODE_TAG_NUMBER_MASK) |
+            ((uint32_t)(tag_octet & (uint8_t)TLV_INDEX_TAG_CLASS_FILTER) << TLV_INDEX_NODE_INFO_SHIFT) |
+            ((header_length << TLV_INDEX_NODE_INFO_SHIFT) & TLV_INDEX_NODE_HEADER_LENGTH_MASK) |
+            ((TRUE == p_tlv_object->b_tlv_container_object) ? TLV_INDEX_NODE_CONTAINER : 0U) |
+            ((TRUE == p_tlv_object->b_tlv_object_length_definite) ? TLV_INDEX_NODE_LENGTH_DEFINITE : 0U);
+        p_node->tlv_header_offset = buffer_index;
+        p_node->tlv_object_value_length = p_tlv_object->tlv_curr_object_value_length;
+        p_node->parent_node_index = parent_node_index;
+        p_node->first_child_node_index = TLV_INDEX_NO_NODE;
+        p_node->next_sibling_node_index = TLV_INDEX_NO_NODE;
+
+        /* Link the node to its parent or previous sibling. */
+        if (TLV_INDEX_NO_NODE != last_child_node_index)
+        {
+            p_tlv_index->p_tlv_index_nodes[last_child_node_index].next_sibling_node_index = node_index;
+        }
+        else if (TLV_INDEX_NO_NODE != parent_node_index)
+        {
+            p_tlv_index->p_tlv_index_nodes[parent_node_index].first_child_node_index = node_index;
+        }
+
+        /* Save the first node of the tag. */
+        if ((p_tlv_object->tlv_object_tag_number <= TAG_MAX) &&
+            (TLV_INDEX_NO_NODE == p_tlv_index->tag_first_node_index[p_tlv_object->tlv_object_tag_number]))
+        {
+            p_tlv_index->tag_first_node_index[p_tlv_object->tlv_object_tag_number] = node_index;
+        }
+
+        p_tlv_index->node_count++;
+        status = TLV_SUCCESS;
+    }
+    else
+    {
+        /* No more TLV index nodes. */
+        status = TLV_NO_MEMORY;
+    }
+
+    /* Return status. */
+    return status;
+}
@@ -0,0 +1,74 @@
+/*
+ * Name: tlv_integer.c
+ *
+ * Description:
+ * All API definitions required to decode arrays of integer TLV objects (e.g. SEQUENCE OF INTEGER), the integer values
+ * are decoded with the inline integer functions of tlv_integer.h.
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#define TLV_OBJECT_SOURCE_CODE
+
+#include <string.h>
+
+#include "tlv_api.h"
+#include "tlv.h"
+#include "tlv_integer.h"
+#include "tlv_definition.h"
+
+/*
+ * Function to decode the integer TLV objects of the tag in the TLV data buffer (e.g. the value of a SEQUENCE OF INTEGER)
+ * into an array of application variables.
+ */
+uint32_t tlv_decode_integer_array(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t tlv_tag, uint8_t * p_values,
+    uint32_t value_size, uint32_t max_value_count, uint32_t * p_value_count)
+{
+    TLV_STATUS status = TLV_SUCCESS;
+    uint8_t tag_octets[TAG_4OCTET];
+    uint32_t tag_length = encode_tag_octets(tag_octets, tlv_tag);
+    uint32_t buffer_index = 0U;
+    uint32_t value_count = 0U;
+
+    while ((buffer_index < buffer_length) && (TLV_SUCCESS == status))
+    {
+        const uint8_t * p_tlv_object = &p_tlv_data_buffer[buffer_index];
+        uint32_t remaining_length = buffer_length - buffer_index;
+
+        if ((VALUE_LENGTH_2OCTET <= remaining_length) && (TAG_END_OF_CONTENT == p_tlv_object[0]) && (TAG_END_OF_CONTENT == p_tlv_object[1]))
+        {
+            /* End of contents octets of the indefinite length container. */
+            break;
+        }
+
+        /* Integer TLV object is the tag octets, one length octet and 1 to 8 value octets. */
+        if ((remaining_length <= tag_length) || (memcmp(p_tlv_object, tag_octets, tag_length)))
+        {
+            status = TLV_NO_TAG_FOUND;
+        }
+        else if ((!p_tlv_object[tag_length]) || (p_tlv_object[tag_length] > value_size) ||
+            ((tag_length + VALUE_LENGTH_1OCTET + p_tlv_object[tag_length]) > remaining_length))
+        {
+            status = TLV_BAD_DATA_SIZE;
+        }
+        else if (value_count >= max_value_count)
+        {
+            status = TLV_BAD_BUFFER_LENGTH;
+        }
+        else
+        {
+            uint32_t octet_count = p_tlv_object[tag_length];
+
+            store_integer_value(&p_values[value_count * value_size], value_size,
+                decode_integer_octets(&p_tlv_object[tag_length + VALUE_LENGTH_1OCTET], octet_count));
+            value_count++;
+            buffer_index += (tag_length + VALUE_LENGTH_1OCTET + octet_count);
+        }
+    }
+
+    *p_value_count = value_count;
+
+    /* Return status. */
+    return status;
+}
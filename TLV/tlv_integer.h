@@ -0,0 +1,179 @@
+/*
+ * Name: tlv_integer.h
+ *
+ * Description:
+ * All definitions required to encode and decode integer values (least significant octet first, minimum number of octets).
+ * The number of octets is computed with count leading zeros (if TLV_INTEGER_BUILTINS is set in tlv_port.h) and 1 to 8 octets
+ * are loaded and stored with two (overlapping) fixed size copies, no loop per octet. All functions are inline.
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#ifndef __TLV_INTEGER_H__
+#define __TLV_INTEGER_H__
+
+#include <string.h>
+
+#include "tlv_port.h"
+
+/* Number of bits in an octet and in an integer value. */
+#define INTEGER_OCTET_BITS          8U
+#define INTEGER_VALUE_BITS          64U
+
+/* Reverse the octets of the 16 bit, 32 bit and 64 bit value (big endian target). */
+#if (0 < TLV_INTEGER_BUILTINS)
+#define SWAP_OCTETS_16(value)       __builtin_bswap16(value)
+#define SWAP_OCTETS_32(value)       __builtin_bswap32(value)
+#define SWAP_OCTETS_64(value)       __builtin_bswap64(value)
+#else
+#define SWAP_OCTETS_16(value)       ((uint16_t)(((uint32_t)(value) >> 8U) | ((uint32_t)(value) << 8U)))
+#define SWAP_OCTETS_32(value)       ((((uint32_t)(value) & 0xFFU) << 24U) | (((uint32_t)(value) & 0xFF00U) << 8U) | \
+                                    (((uint32_t)(value) >> 8U) & 0xFF00U) | ((uint32_t)(value) >> 24U))
+#define SWAP_OCTETS_64(value)       (((uint64_t)SWAP_OCTETS_32((uint32_t)(value)) << 32U) | (uint64_t)SWAP_OCTETS_32((uint32_t)((value) >> 32U)))
+#endif /* TLV_INTEGER_BUILTINS */
+
+/* Count the leading zero bits of the integer value (value should not be 0). */
+static inline uint32_t count_leading_zeros(uint64_t value)
+{
+#if (0 < TLV_INTEGER_BUILTINS)
+    return (uint32_t)__builtin_clzll(value);
+#else
+    uint32_t leading_zeros = 0U;
+
+    while (!(value & ((uint64_t)1U << (INTEGER_VALUE_BITS - 1U))))
+    {
+        value = (value << 1U);
+        leading_zeros++;
+    }
+
+    return leading_zeros;
+#endif /* TLV_INTEGER_BUILTINS */
+}
+
+/* Get the number of octets to encode the integer value (minimum two's complement octets, at least one octet). */
+static inline uint32_t get_integer_octet_count(int64_t value)
+{
+    /* Clear the sign bits, one more bit than the remaining bits is required for the sign (at least one octet). */
+    uint64_t magnitude = ((uint64_t)value ^ (0U - ((uint64_t)value >> (INTEGER_VALUE_BITS - 1U)))) | 1U;
+
+    return (((INTEGER_VALUE_BITS + INTEGER_OCTET_BITS) - count_leading_zeros(magnitude)) / INTEGER_OCTET_BITS);
+}
+
+/* Read 1 to 8 octets (least significant octet first), the first and the last (overlapping) 4 or 2 octets are read. */
+static inline uint64_t read_integer_octets(const uint8_t * p_octets, uint32_t octet_count)
+{
+    uint64_t value = 0U;
+
+    if (4U <= octet_count)
+    {
+        uint32_t first_octets = 0U;
+        uint32_t last_octets = 0U;
+        memcpy(&first_octets, p_octets, 4U);
+        memcpy(&last_octets, &p_octets[octet_count - 4U], 4U);
+#if (0 < TLV_BIG_ENDIAN)
+        first_octets = SWAP_OCTETS_32(first_octets);
+        last_octets = SWAP_OCTETS_32(last_octets);
+#endif /* TLV_BIG_ENDIAN */
+        value = (uint64_t)first_octets | ((uint64_t)last_octets << ((octet_count - 4U) * INTEGER_OCTET_BITS));
+    }
+    else if (2U <= octet_count)
+    {
+        uint16_t first_octets = 0U;
+        uint16_t last_octets = 0U;
+        memcpy(&first_octets, p_octets, 2U);
+        memcpy(&last_octets, &p_octets[octet_count - 2U], 2U);
+#if (0 < TLV_BIG_ENDIAN)
+        first_octets = SWAP_OCTETS_16(first_octets);
+        last_octets = SWAP_OCTETS_16(last_octets);
+#endif /* TLV_BIG_ENDIAN */
+        value = (uint64_t)first_octets | ((uint64_t)last_octets << ((octet_count - 2U) * INTEGER_OCTET_BITS));
+    }
+    else
+    {
+        value = (uint64_t)p_octets[0];
+    }
+
+    return value;
+}
+
+/* Write 1 to 8 octets (least significant octet first), the first and the last (overlapping) 4 or 2 octets are written. */
+static inline void_t write_integer_octets(uint8_t * p_octets, uint32_t octet_count, uint64_t value)
+{
+    if (4U <= octet_count)
+    {
+        uint32_t first_octets = (uint32_t)value;
+        uint32_t last_octets = (uint32_t)(value >> ((octet_count - 4U) * INTEGER_OCTET_BITS));
+#if (0 < TLV_BIG_ENDIAN)
+        first_octets = SWAP_OCTETS_32(first_octets);
+        last_octets = SWAP_OCTETS_32(last_octets);
+#endif /* TLV_BIG_ENDIAN */
+        memcpy(&p_octets[octet_count - 4U], &last_octets, 4U);
+        memcpy(p_octets, &first_octets, 4U);
+    }
+    else if (2U <= octet_count)
+    {
+        uint16_t first_octets = (uint16_t)value;
+        uint16_t last_octets = (uint16_t)(value >> ((octet_count - 2U) * INTEGER_OCTET_BITS));
+#if (0 < TLV_BIG_ENDIAN)
+        first_octets = SWAP_OCTETS_16(first_octets);
+        last_octets = SWAP_OCTETS_16(last_octets);
+#endif /* TLV_BIG_ENDIAN */
+        memcpy(&p_octets[octet_count - 2U], &last_octets, 2U);
+        memcpy(p_octets, &first_octets, 2U);
+    }
+    else
+    {
+        p_octets[0] = (uint8_t)value;
+    }
+}
+
+/* Sign extend the integer value of 1 to 8 octets. */
+static inline int64_t sign_extend_integer_value(uint64_t value, uint32_t octet_count)
+{
+    uint64_t sign_bit = (uint64_t)1U << ((octet_count * INTEGER_OCTET_BITS) - 1U);
+
+    return (int64_t)((value ^ sign_bit) - sign_bit);
+}
+
+/* Decode the integer value octets (1 to 8 octets, least significant octet first), the value is sign extended (0 for other octet counts). */
+static inline int64_t decode_integer_octets(const uint8_t * p_value_octets, uint32_t octet_count)
+{
+    if ((!octet_count) || (octet_count > (INTEGER_VALUE_BITS / INTEGER_OCTET_BITS)))
+    {
+        return 0;
+    }
+
+    return sign_extend_integer_value(read_integer_octets(p_value_octets, octet_count), octet_count);
+}
+
+/* Encode the integer value octets (least significant octet first), octet count from get_integer_octet_count(). */
+static inline void_t encode_integer_octets(uint8_t * p_value_octets, int64_t value, uint32_t octet_count)
+{
+    write_integer_octets(p_value_octets, octet_count, (uint64_t)value);
+}
+
+/* Load the integer value of the application variable (variable size 1 to 8 octets), the value is sign extended. */
+static inline int64_t load_integer_value(const uint8_t * p_value, uint32_t value_length)
+{
+#if (0 < TLV_BIG_ENDIAN)
+    /* Application variable is most significant octet first. */
+    uint64_t value = SWAP_OCTETS_64(read_integer_octets(p_value, value_length)) >> (INTEGER_VALUE_BITS - (value_length * INTEGER_OCTET_BITS));
+    return sign_extend_integer_value(value, value_length);
+#else
+    return decode_integer_octets(p_value, value_length);
+#endif /* TLV_BIG_ENDIAN */
+}
+
+/* Store the integer value to the application variable (variable size 1 to 8 octets), the value is truncated to the variable size. */
+static inline void_t store_integer_value(uint8_t * p_value, uint32_t value_length, int64_t value)
+{
+#if (0 < TLV_BIG_ENDIAN)
+    /* Application variable is most significant octet first. */
+    write_integer_octets(p_value, value_length, SWAP_OCTETS_64((uint64_t)value << (INTEGER_VALUE_BITS - (value_length * INTEGER_OCTET_BITS))));
+#else
+    write_integer_octets(p_value, value_length, (uint64_t)value);
+#endif /* TLV_BIG_ENDIAN */
+}
+
+#endif /* __TLV_INTEGER_H__ */
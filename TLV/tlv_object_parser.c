@@ -27,65 +27,42 @@ static uint32_t get_parsed_tlv_object_primitive(const uint8_t * p_tlv_data_buffe
 /* Get parsed primitive TLV object for the found tag. */
 static uint32_t get_parsed_tlv_object_constructed(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_t * p_tlv_object);
 
+/*
+ * Parser of the TLV object for each tag class, indexed by the class and constructed bits of the first tag octet
+ * (NULL if the tag class is not supported).
+ */
+static uint32_t (* const tlv_class_parser[TLV_TAG_CLASS_COUNT])(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_t * p_tlv_object) =
+{
+    get_parsed_tlv_object_primitive,        /* TAG_UNIVERSAL_PRIMITIVE */
+    get_parsed_tlv_object_constructed,      /* TAG_UNIVERSAL_CONSTRUCTED */
+    get_parsed_tlv_object_primitive,        /* TAG_APPL_CLS_PRIMITIVE */
+    get_parsed_tlv_object_constructed,      /* TAG_APPL_CLS_CONSTRUCTED */
+    get_parsed_tlv_object_primitive,        /* TAG_CS_CLS_PRIMITIVE */
+    get_parsed_tlv_object_constructed,      /* TAG_CS_CLS_CONSTRUCTED */
+    NULL,                                   /* TAG_PRIVATE_CLS_PRIMITIVE, not supported. */
+    NULL                                    /* TAG_PRIVATE_CLS_CONSTRUCTED, not supported. */
+};
+
 /* Get parsed TLV object for the found tag. */
 uint32_t get_parsed_tlv_object(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_t * p_tlv_object)
 {
     TLV_STATUS status = TLV_FAIL;
 
-    uint8_t tag_class = (uint8_t)(*p_tlv_data_buffer & (uint8_t)TLV_TAG_CLASS_FILTER);
-    switch (tag_class)
+    /* Get the parsed TLV object with the parser of the tag class. */
+    uint32_t tag_class_index = (uint32_t)(*p_tlv_data_buffer & (uint8_t)TLV_TAG_CLASS_FILTER) >> TLV_TAG_CLASS_SHIFT;
+    if (tlv_class_parser[tag_class_index])
     {
-        case TAG_UNIVERSAL_PRIMITIVE:
-        {
-            /* Get the parsed primitive TLV object. */
-            status = get_parsed_tlv_object_primitive(p_tlv_data_buffer, buffer_length, p_tlv_object);
-        }
-        break;
-        case TAG_UNIVERSAL_CONSTRUCTED:
-        {
-            /* Get the parsed constructed TLV object. */
-            status = get_parsed_tlv_object_constructed(p_tlv_data_buffer, buffer_length, p_tlv_object);
-        }
-        break;
-        case TAG_APPL_CLS_PRIMITIVE:
-        {
-            /* Get the parsed primitive TLV object. */
-            status = get_parsed_tlv_object_primitive(p_tlv_data_buffer, buffer_length, p_tlv_object);
-        }
-        break;
-        case TAG_APPL_CLS_CONSTRUCTED:
-        {
-            /* Get the parsed constructed TLV object. */
-            status = get_parsed_tlv_object_constructed(p_tlv_data_buffer, buffer_length, p_tlv_object);
-        }
-        break;
-        case TAG_CS_CLS_PRIMITIVE:
-        {
-            /* Get the parsed primitive TLV object. */
-            status = get_parsed_tlv_object_primitive(p_tlv_data_buffer, buffer_length, p_tlv_object);
-        }
-        break;
-        case TAG_CS_CLS_CONSTRUCTED:
-        {
-            /* Get the parsed constructed TLV object. */
-            status = get_parsed_tlv_object_constructed(p_tlv_data_buffer, buffer_length, p_tlv_object);
-        }
-        break;
-        case TAG_PRIVATE_CLS_PRIMITIVE:
-        {
-            /* not supported. */
-        }
-        break;
-        case TAG_PRIVATE_CLS_CONSTRUCTED:
-        {
-            /* not supported. */
-        }
-        break;
-        default:
+        status = tlv_class_parser[tag_class_index](p_tlv_data_buffer, buffer_length, p_tlv_object);
+    }
+
+    if (TLV_SUCCESS == status)
+    {
+        /* Check the parsed TLV object with the TLV codec of the tag number (if the TLV codec has a decode check). */
+        const tlv_codec_t * p_tlv_codec = get_tlv_codec(p_tlv_object->tlv_object_tag_number);
+        if ((p_tlv_codec) && (p_tlv_codec->p_decode))
         {
-            /* Do nothing. */
+            status = p_tlv_codec->p_decode(p_tlv_object);
         }
-        break;
     }
 
     /* Return status. */
@@ -102,7 +79,7 @@ uint32_t update_parsed_tlv_object(const uint8_t * p_tlv_data_buffer, uint32_t bu
     {
         /* Allocate memory for the TLV encoded buffer. */
         p_tlv_object->p_tlv_object_encoded_buffer = NULL;
-        p_tlv_object->p_tlv_object_encoded_buffer = (uint8_t*)calloc(p_tlv_object->tlv_curr_encoded_object_length, sizeof(uint8_t));
+        p_tlv_object->p_tlv_object_encoded_buffer = (uint8_t*)allocate_tlv_memory(p_tlv_object->p_tlv_arena, p_tlv_object->tlv_curr_encoded_object_length);
         if (p_tlv_object->p_tlv_object_encoded_buffer)
         {
             /* If successful copy the TLV encoded buffer. */
@@ -203,6 +180,44 @@ uint32_t update_searched_tlv_object(const uint8_t * p_tlv_data_buffer, uint32_t
     return status;
 }
 
+/* Update TLV object view of the parsed TLV object (points into the TLV data buffer, no copy). */
+uint32_t update_parsed_tlv_object_view(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, const tlv_object_t * p_tlv_object, tlv_object_view_t * p_tlv_object_view)
+{
+    TLV_STATUS status = TLV_FAIL;
+
+    /* The encoded TLV object should be within the TLV data buffer. */
+    if (p_tlv_object->tlv_curr_encoded_object_length <= buffer_length)
+    {
+        p_tlv_object_view->tlv_object_tag_number = p_tlv_object->tlv_object_tag_number;
+        p_tlv_object_view->tlv_tag_length = p_tlv_object->tlv_tag_length;
+        p_tlv_object_view->b_tlv_container_object = p_tlv_object->b_tlv_container_object;
+        p_tlv_object_view->b_tlv_object_length_definite = p_tlv_object->b_tlv_object_length_definite;
+        p_tlv_object_view->tlv_encoded_object_length = p_tlv_object->tlv_curr_encoded_object_length;
+        p_tlv_object_view->tlv_object_value_length = p_tlv_object->tlv_curr_object_value_length;
+        p_tlv_object_view->p_tlv_object_encoded_buffer = p_tlv_data_buffer;
+
+        /* store the start of value buffer. */
+        if (FALSE == p_tlv_object->b_tlv_container_object)
+        {
+            uint32_t value_index = ((p_tlv_object->tlv_curr_encoded_object_length) - (p_tlv_object->tlv_curr_object_value_length));
+            p_tlv_object_view->p_tlv_value_buffer = &p_tlv_data_buffer[value_index];
+        }
+        else
+        {
+            p_tlv_object_view->p_tlv_value_buffer = NULL;
+        }
+
+        status = TLV_SUCCESS;
+    }
+    else
+    {
+        status = TLV_BAD_BUFFER_LENGTH;
+    }
+
+    /* Return status. */
+    return status;
+}
+
 /* Get parsed primitive TLV object for the found tag. */
 static uint32_t get_parsed_tlv_object_primitive(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_t * p_tlv_object)
 {
@@ -268,26 +283,24 @@ static uint32_t parse_tlv_object_tag(const uint8_t * p_tlv_data_buffer, uint32_t
     else if ((((p_tlv_data_buffer[0] & (uint8_t)TLV_TAG_NUMBER_FILTER) == (uint8_t)ONE_OCTET_TAG_MAX)) &&
         (buffer_length >= TAG_2OCTET))
     {
-        if (!(p_tlv_data_buffer[1] & (uint8_t)EXTENDED_TAG))
+        /* Extended tag octets, 7 bits of the tag number per octet and bit 8 set if more tag octets follow. */
+        uint32_t tag_number = 0U;
+        for (uint32_t i = 1U; (i < TAG_4OCTET) && (i < buffer_length); i++)
         {
-            p_tlv_object->tlv_tag_length = (uint32_t)TAG_2OCTET;
-            p_tlv_object->tlv_object_tag_number = (uint32_t)(p_tlv_data_buffer[1] & EXTENDED_TAG_FILTER);
-        }
-        else
-        {
-            if (buffer_length >= TAG_3OCTET)
-            {
-                p_tlv_object->tlv_tag_length = (uint32_t)TAG_3OCTET;
-                p_tlv_object->tlv_object_tag_number = (uint32_t)(p_tlv_data_buffer[1] & EXTENDED_TAG_FILTER);
-                p_tlv_object->tlv_object_tag_number = p_tlv_object->tlv_object_tag_number << 7U;
-                p_tlv_object->tlv_object_tag_number |= (uint32_t)(p_tlv_data_buffer[2] & EXTENDED_TAG_FILTER);
-            }
-            else
+            tag_number = (tag_number << SHIFT_7BIT) | (uint32_t)(p_tlv_data_buffer[i] & EXTENDED_TAG_FILTER);
+            if (!(p_tlv_data_buffer[i] & (uint8_t)EXTENDED_TAG))
             {
-                /* Tag number is not correct for application TLV object. */
-                status = TLV_BAD_TAG;
+                p_tlv_object->tlv_tag_length = i + 1U;
+                p_tlv_object->tlv_object_tag_number = tag_number;
+                break;
             }
         }
+
+        if (!p_tlv_object->tlv_tag_length)
+        {
+            /* Tag number is not correct for application TLV object (more than 4 tag octets or tag octets not in the buffer). */
+            status = TLV_BAD_TAG;
+        }
     }
     else
     {
@@ -329,7 +342,7 @@ static uint32_t parse_tlv_object_lenght(const uint8_t * p_tlv_data_buffer, uint3
             length_octets = (uint32_t)(p_tlv_data_buffer[p_tlv_object->tlv_tag_length] & LENGTH_FILTER);
             if (buffer_length >= (p_tlv_object->tlv_tag_length + VALUE_LENGTH_1OCTET + length_octets))
             {
-                if (length_octets > VALUE_LENGTH_2OCTET)
+                if (length_octets > VALUE_LENGTH_4OCTET)
                 {
                     /* Bad buffer length. */
                     status = TLV_BAD_BUFFER_LENGTH;
@@ -348,18 +361,22 @@ static uint32_t parse_tlv_object_lenght(const uint8_t * p_tlv_data_buffer, uint3
                     /* Definite length. */
                     for (uint32_t i = 1; i <= length_octets; i++)
                     {
-                        p_tlv_object->tlv_curr_object_value_length |= (uint32_t)p_tlv_data_buffer[(p_tlv_object->tlv_tag_length + i)];
-
-                        if (i < length_octets)
-                        {
-                            p_tlv_object->tlv_curr_object_value_length = ((p_tlv_object->tlv_curr_object_value_length << 8U) & 0xFF00U);
-                        }
+                        p_tlv_object->tlv_curr_object_value_length = (p_tlv_object->tlv_curr_object_value_length << SHIFT_8BIT) |
+                            (uint32_t)p_tlv_data_buffer[(p_tlv_object->tlv_tag_length + i)];
                     }
                     p_tlv_object->b_tlv_container_object = FALSE;
                     p_tlv_object->b_tlv_object_length_definite = TRUE;
 
-                    /* Length decoded. */
-                    status = TLV_SUCCESS;
+                    /* Length decoded, the encoded TLV object length should be within 32 bits. */
+                    if (p_tlv_object->tlv_curr_object_value_length > (FIVE_OCTET_MAX_LENGTH - (p_tlv_object->tlv_tag_length + VALUE_LENGTH_1OCTET + length_octets)))
+                    {
+                        p_tlv_object->tlv_curr_object_value_length = 0U;
+                        status = TLV_BAD_BUFFER_LENGTH;
+                    }
+                    else
+                    {
+                        status = TLV_SUCCESS;
+                    }
                 }
             }
             else
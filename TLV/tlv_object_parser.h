@@ -22,4 +22,7 @@ uint32_t update_parsed_tlv_object(const uint8_t * p_tlv_data_buffer, uint32_t bu
 /* Update searched TLV object. */
 uint32_t update_searched_tlv_object(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, tlv_object_t * p_tlv_object);
 
+/* Update TLV object view of the parsed TLV object (points into the TLV data buffer, no copy). */
+uint32_t update_parsed_tlv_object_view(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, const tlv_object_t * p_tlv_object, tlv_object_view_t * p_tlv_object_view);
+
 #endif /* __TLV_OBJECT_PARSER_H__ */
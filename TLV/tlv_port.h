@@ -9,18 +9,55 @@
  *
  */
 
-#ifndef __DATA_TYPES__
-#define __DATA_TYPES__
+#ifndef __TLV_PORT_H__
+#define __TLV_PORT_H__
 
 
 #include <stdio.h>
 #include <stddef.h>
 #include <stdlib.h>
 
+/*
+ * App data is sent to a file descriptor (socket, pipe) with writev() of the encoded TLV objects (POSIX), if the target supports
+ * writev(). Set TLV_SEND_WRITEV to 0 to build the send vector only (tlv_app_data_send_fd() returns TLV_SEND_FAILED).
+ */
+#ifndef TLV_SEND_WRITEV
+#if defined(__unix__) || defined(__APPLE__)
+#define TLV_SEND_WRITEV    1
+#else
+#define TLV_SEND_WRITEV    0
+#endif
+#endif /* TLV_SEND_WRITEV */
+
+/*
+ * The send vector of writev() is struct iovec of sys/uio.h, the POSIX headers define the fixed width integer types of stdint.h.
+ */
+#if (0 < TLV_SEND_WRITEV)
+#include <sys/uio.h>
+#ifndef TLV_PORT_HAS_STDINT
+#define TLV_PORT_HAS_STDINT    1
+#endif /* TLV_PORT_HAS_STDINT */
+#endif /* TLV_SEND_WRITEV */
+
+/*
+ * The fixed width integer types of stdint.h are used if the target has stdint.h (C99 and later), else the fixed width integer types
+ * are defined below. Set TLV_PORT_HAS_STDINT to 0 if the target has no stdint.h (always set with TLV_SEND_WRITEV), it should be the
+ * same as RB_PORT_HAS_STDINT if the ring buffer API is included too.
+ */
+#ifndef TLV_PORT_HAS_STDINT
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#define TLV_PORT_HAS_STDINT    1
+#else
+#define TLV_PORT_HAS_STDINT    0
+#endif
+#endif /* TLV_PORT_HAS_STDINT */
 
  /*
   * If the compiler recognize bool data type, then define BOOL_AWARE in this file.
   */
+#if (0 < TLV_PORT_HAS_STDINT)
+#include <stdint.h>
+#else
 #ifndef int8_t
 typedef char int8_t;
 #endif /* int8_t */
@@ -50,13 +87,20 @@ typedef unsigned int uint32_t;
 #endif /* uint32_t */
 
 #ifndef uint64_t
-typedef long long int uint64_t;
+typedef unsigned long long int uint64_t;
 #endif /* uint64_t */
+#endif /* TLV_PORT_HAS_STDINT */
 
 #ifndef void_t
 typedef void void_t;
 #endif /* void_t_t */
 
+/*
+ * bool_t is shared with the port headers of the other modules (e.g. ring_buffer_port.h), it is defined by the port header included first.
+ */
+#ifndef __DATA_TYPES__
+#define __DATA_TYPES__
+
 #ifndef bool_t
 
 #ifndef BOOL_AWARE
@@ -76,3 +120,111 @@ typedef bool bool_t;
 #endif /* bool_t */
 
 #endif /* __DATA_TYPES__ */
+
+/*
+ * TLV data buffer is scanned (for tag and end of contents octets) 16 octets at a time with SSE2, if the target supports SSE2
+ * (all x86-64 processors). Set TLV_SCAN_SSE2 to 0 to scan one octet at a time.
+ */
+#ifndef TLV_SCAN_SSE2
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define TLV_SCAN_SSE2    1
+#else
+#define TLV_SCAN_SSE2    0
+#endif
+#endif /* TLV_SCAN_SSE2 */
+
+/*
+ * Integer TLV objects are encoded and decoded with the count leading zeros and byte swap builtins (GCC and Clang), the
+ * number of value octets is computed without a loop per octet. Set TLV_INTEGER_BUILTINS to 0 for the portable code.
+ */
+#ifndef TLV_INTEGER_BUILTINS
+#if defined(__GNUC__) || defined(__clang__)
+#define TLV_INTEGER_BUILTINS    1
+#else
+#define TLV_INTEGER_BUILTINS    0
+#endif
+#endif /* TLV_INTEGER_BUILTINS */
+
+/*
+ * Integer value octets are encoded least significant octet first, the octets are byte swapped on a big endian target.
+ * Set TLV_BIG_ENDIAN to 1 on a big endian target if the compiler does not define the byte order.
+ */
+#ifndef TLV_BIG_ENDIAN
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define TLV_BIG_ENDIAN          1
+#else
+#define TLV_BIG_ENDIAN          0
+#endif
+#endif /* TLV_BIG_ENDIAN */
+
+/*
+ * TLV batch decode uses a worker thread pool of POSIX threads (link with -pthread), if the target supports POSIX threads.
+ * Set TLV_BATCH_THREAD_POOL to 0 to decode the batch in the calling thread only.
+ */
+#ifndef TLV_BATCH_THREAD_POOL
+#if defined(__unix__) || defined(__APPLE__)
+#define TLV_BATCH_THREAD_POOL    1
+#else
+#define TLV_BATCH_THREAD_POOL    0
+#endif
+#endif /* TLV_BATCH_THREAD_POOL */
+
+/*
+ * The counts of the TLV counting allocator are atomic (C11 stdatomic.h), one TLV counting allocator can count the allocations of
+ * all the threads (TLV contexts per thread, TLV batch pool). Set TLV_ATOMIC_COUNTS to 0 if the target has no stdatomic.h, the
+ * counts are then not atomic and the TLV counting allocator should be used by one thread only.
+ */
+#ifndef TLV_ATOMIC_COUNTS
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#define TLV_ATOMIC_COUNTS       1
+#else
+#define TLV_ATOMIC_COUNTS       0
+#endif
+#endif /* TLV_ATOMIC_COUNTS */
+
+#endif /* __TLV_PORT_H__ */
+
+#ifndef __TLV_ALLOCATOR__
+#define __TLV_ALLOCATOR__
+
+/*
+ * TLV allocator, the heap memory of the TLV module (TLV encoded buffers and app data not allocated from an arena, TLV batch pool)
+ * is allocated and freed with the TLV allocator functions (e.g. a size class allocator) instead of calloc and free.
+ * p_alloc and p_free should be set, p_realloc and p_aligned_alloc are optional (NULL). The allocator context is passed to each function.
+ */
+typedef struct tlv_allocator
+{
+    void_t              * (*p_alloc)(void_t * p_allocator_context, size_t size);
+    void_t                (*p_free)(void_t * p_allocator_context, void_t * p_memory);
+    void_t              * (*p_realloc)(void_t * p_allocator_context, void_t * p_memory, size_t size);
+    void_t              * (*p_aligned_alloc)(void_t * p_allocator_context, size_t alignment, size_t size);
+    void_t              * p_allocator_context;
+
+} tlv_allocator_t;
+
+/* Count of the TLV counting allocator (atomic with TLV_ATOMIC_COUNTS). */
+#if (0 < TLV_ATOMIC_COUNTS)
+#include <stdatomic.h>
+typedef _Atomic uint64_t    tlv_allocator_count_t;
+#else
+typedef uint64_t            tlv_allocator_count_t;
+#endif /* TLV_ATOMIC_COUNTS */
+
+/*
+ * TLV counting allocator, counts the allocations, frees and allocated octets and forwards them to the backing TLV allocator
+ * (profiling of the allocations per message). A realloc of allocated memory is counted as a reallocation with the new size
+ * (the old size is not known), a realloc of NULL is counted as an allocation.
+ */
+typedef struct tlv_counting_allocator
+{
+    tlv_allocator_t         tlv_allocator;
+    const tlv_allocator_t * p_backing_allocator;
+    tlv_allocator_count_t   allocation_count;
+    tlv_allocator_count_t   free_count;
+    tlv_allocator_count_t   allocated_octets;
+    tlv_allocator_count_t   reallocation_count;
+    tlv_allocator_count_t   reallocated_octets;
+
+} tlv_counting_allocator_t;
+
+#endif /* __TLV_ALLOCATOR__ */
@@ -0,0 +1,120 @@
+/*
+ * Name: tlv_scan.c
+ *
+ * Description:
+ * All definitions required to scan the TLV data buffer for tag octets and end of contents octets.
+ * The TLV data buffer is scanned 16 octets at a time with SSE2 (if TLV_SCAN_SSE2 is set in tlv_port.h), else one octet at a time.
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#define TLV_OBJECT_SOURCE_CODE
+
+#include <string.h>
+
+#include "tlv_api.h"
+#include "tlv_application_class.h"
+#include "tlv_definition.h"
+
+#if (0 < TLV_SCAN_SSE2)
+#include <emmintrin.h>
+
+/* Number of octets scanned at a time. */
+#define TLV_SCAN_VECTOR_LENGTH      16U
+#endif /* TLV_SCAN_SSE2 */
+
+/*
+ * Find the first octet (from the buffer index) that can be the first tag octet of a TLV object, returns buffer length if not found.
+ * Private class tags and tag number 0 (end of contents) octets can not start a TLV object.
+ */
+uint32_t find_tlv_tag_octet(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t buffer_index)
+{
+#if (0 < TLV_SCAN_SSE2)
+    const __m128i class_filter = _mm_set1_epi8((char)TAG_PRIVATE_CLS_PRIMITIVE);
+    const __m128i tag_number_filter = _mm_set1_epi8((char)TLV_TAG_NUMBER_FILTER);
+    const __m128i zero = _mm_setzero_si128();
+
+    while ((buffer_index + TLV_SCAN_VECTOR_LENGTH) <= buffer_length)
+    {
+        __m128i octets = _mm_loadu_si128((const __m128i *)(const void_t *)&p_tlv_data_buffer[buffer_index]);
+        __m128i private_class = _mm_cmpeq_epi8(_mm_and_si128(octets, class_filter), class_filter);
+        __m128i tag_number_zero = _mm_cmpeq_epi8(_mm_and_si128(octets, tag_number_filter), zero);
+        uint32_t tag_octet_mask = (uint32_t)_mm_movemask_epi8(_mm_or_si128(private_class, tag_number_zero)) ^ 0xFFFFU;
+
+        if (tag_octet_mask)
+        {
+            /* Index of the first tag octet in the scanned octets. */
+            while (!(tag_octet_mask & 1U))
+            {
+                tag_octet_mask >>= 1U;
+                buffer_index++;
+            }
+            return buffer_index;
+        }
+        buffer_index += TLV_SCAN_VECTOR_LENGTH;
+    }
+#endif /* TLV_SCAN_SSE2 */
+
+    /* Scan the (remaining) octets one at a time. */
+    while (buffer_index < buffer_length)
+    {
+        uint8_t octet = p_tlv_data_buffer[buffer_index];
+        if (((octet & (uint8_t)TAG_PRIVATE_CLS_PRIMITIVE) != (uint8_t)TAG_PRIVATE_CLS_PRIMITIVE) && (octet & (uint8_t)TLV_TAG_NUMBER_FILTER))
+        {
+            break;
+        }
+        buffer_index++;
+    }
+
+    /* Return index of the tag octet. */
+    return buffer_index;
+}
+
+/* Find the first end of contents octets (two 0x00 octets) from the buffer index, returns buffer length if not found. */
+uint32_t find_end_of_contents_octets(const uint8_t * p_tlv_data_buffer, uint32_t buffer_length, uint32_t buffer_index)
+{
+#if (0 < TLV_SCAN_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+
+    /* Octets and the next octets are compared, a match is 0x00 followed by 0x00. */
+    while ((buffer_index + TLV_SCAN_VECTOR_LENGTH + 1U) <= buffer_length)
+    {
+        __m128i octets = _mm_loadu_si128((const __m128i *)(const void_t *)&p_tlv_data_buffer[buffer_index]);
+        __m128i next_octets = _mm_loadu_si128((const __m128i *)(const void_t *)&p_tlv_data_buffer[buffer_index + 1U]);
+        uint32_t end_of_contents_mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(octets, zero), _mm_cmpeq_epi8(next_octets, zero)));
+
+        if (end_of_contents_mask)
+        {
+            /* Index of the first end of contents octets in the scanned octets. */
+            while (!(end_of_contents_mask & 1U))
+            {
+                end_of_contents_mask >>= 1U;
+                buffer_index++;
+            }
+            return buffer_index;
+        }
+        buffer_index += TLV_SCAN_VECTOR_LENGTH;
+    }
+#endif /* TLV_SCAN_SSE2 */
+
+    /* Scan the (remaining) octets for 0x00 with memchr() and check the next octet. */
+    while ((buffer_index + 1U) < buffer_length)
+    {
+        const uint8_t * p_octet = (const uint8_t *)memchr(&p_tlv_data_buffer[buffer_index], (int32_t)TAG_END_OF_CONTENT, (size_t)(buffer_length - buffer_index - 1U));
+        if (!p_octet)
+        {
+            break;
+        }
+
+        buffer_index = (uint32_t)(p_octet - p_tlv_data_buffer);
+        if ((uint8_t)TAG_END_OF_CONTENT == p_tlv_data_buffer[buffer_index + 1U])
+        {
+            return buffer_index;
+        }
+        buffer_index++;
+    }
+
+    /* End of contents octets not found. */
+    return buffer_length;
+}
@@ -0,0 +1,399 @@
+/*
+ * Name: tlv_stream_parser.c
+ *
+ * Description:
+ * All API definitions required for the TLV stream parser (decoder of TLV data received in chunks).
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#define TLV_OBJECT_SOURCE_CODE
+
+#include <string.h>
+
+#include "tlv_api.h"
+#include "tlv.h"
+#include "tlv_universal_class.h"
+#include "tlv_application_class.h"
+#include "tlv_definition.h"
+#include "tlv_stream_parser.h"
+
+/* Parse the TLV data octets, the TLV objects parsed are reported by the callback. */
+static uint32_t parse_tlv_stream_data(tlv_stream_parser_t * p_tlv_stream_parser, const uint8_t * p_tlv_data, uint32_t data_length);
+
+/* Parse a tag octet of the TLV object. */
+static uint32_t parse_tlv_stream_tag_octet(tlv_stream_parser_t * p_tlv_stream_parser, uint8_t tag_octet);
+
+/* Parse a length octet of the TLV object. */
+static uint32_t parse_tlv_stream_length_octet(tlv_stream_parser_t * p_tlv_stream_parser, uint8_t length_octet);
+
+/* Report the parsed TLV object to the callback. */
+static void_t report_tlv_stream_object(tlv_stream_parser_t * p_tlv_stream_parser, const uint8_t * p_tlv_object_start);
+
+/* Report the value octets of the TLV object larger than the TLV object buffer to the value callback. */
+static void_t report_tlv_stream_value(tlv_stream_parser_t * p_tlv_stream_parser, const uint8_t * p_value, uint32_t value_length);
+
+/* Reset the parser state to parse the next TLV object. */
+static void_t reset_tlv_stream_object(tlv_stream_parser_t * p_tlv_stream_parser);
+
+/* Function to initialize the TLV stream parser. */
+uint32_t tlv_stream_parser_init(tlv_stream_parser_t * p_tlv_stream_parser, uint8_t * p_tlv_object_buffer, uint32_t tlv_object_buffer_size,
+    tlv_stream_callback_t p_callback, void_t * p_callback_data)
+{
+    p_tlv_stream_parser->p_tlv_object_buffer = p_tlv_object_buffer;
+    p_tlv_stream_parser->tlv_object_buffer_size = tlv_object_buffer_size;
+    p_tlv_stream_parser->p_callback = p_callback;
+    p_tlv_stream_parser->p_value_callback = NULL;
+    p_tlv_stream_parser->p_callback_data = p_callback_data;
+
+    reset_tlv_stream_object(p_tlv_stream_parser);
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Function to feed TLV data (a chunk of any length) to the TLV stream parser. */
+uint32_t tlv_stream_parser_feed(tlv_stream_parser_t * p_tlv_stream_parser, const uint8_t * p_tlv_data, uint32_t data_length)
+{
+    TLV_STATUS status = TLV_FAIL;
+
+    status = parse_tlv_stream_data(p_tlv_stream_parser, p_tlv_data, data_length);
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to reset the TLV stream parser, the partially parsed TLV object is discarded. */
+uint32_t tlv_stream_parser_reset(tlv_stream_parser_t * p_tlv_stream_parser)
+{
+    reset_tlv_stream_object(p_tlv_stream_parser);
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Function to set the value callback of the TLV stream parser (NULL to clear). */
+uint32_t tlv_stream_parser_set_value_callback(tlv_stream_parser_t * p_tlv_stream_parser, tlv_stream_value_callback_t p_value_callback)
+{
+    p_tlv_stream_parser->p_value_callback = p_value_callback;
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Parse the TLV data octets, the TLV objects parsed are reported by the callback. */
+static uint32_t parse_tlv_stream_data(tlv_stream_parser_t * p_tlv_stream_parser, const uint8_t * p_tlv_data, uint32_t data_length)
+{
+    TLV_STATUS status = TLV_SUCCESS;
+    TLV_STATUS octet_status = TLV_FAIL;
+
+    /* Start of the TLV object in the TLV data, NULL if the TLV object started in the TLV data fed earlier. */
+    const uint8_t * p_tlv_object_start = NULL;
+    uint32_t data_index = 0U;
+
+    while (data_index < data_length)
+    {
+        switch (p_tlv_stream_parser->stream_state)
+        {
+            case TLV_STREAM_STATE_TAG:
+            case TLV_STREAM_STATE_LENGTH:
+            {
+                if (!p_tlv_stream_parser->tlv_object_length)
+                {
+                    p_tlv_object_start = &p_tlv_data[data_index];
+                }
+
+                /* Keep the tag and length octets in the TLV object buffer. */
+                uint8_t octet = p_tlv_data[data_index];
+                p_tlv_stream_parser->p_tlv_object_buffer[p_tlv_stream_parser->tlv_object_length] = octet;
+                p_tlv_stream_parser->tlv_object_length++;
+                data_index++;
+
+                if (TLV_STREAM_STATE_TAG == p_tlv_stream_parser->stream_state)
+                {
+                    octet_status = parse_tlv_stream_tag_octet(p_tlv_stream_parser, octet);
+                    if (TLV_SUCCESS == octet_status)
+                    {
+                        /* Tag parsed, now get the length. */
+                        p_tlv_stream_parser->stream_state = TLV_STREAM_STATE_LENGTH;
+                        octet_status = TLV_STREAM_MORE_OCTETS;
+                    }
+                }
+                else
+                {
+                    octet_status = parse_tlv_stream_length_octet(p_tlv_stream_parser, octet);
+                    if (TLV_SUCCESS == octet_status)
+                    {
+                        if (p_tlv_stream_parser->tlv_object_value_length > (p_tlv_stream_parser->tlv_object_buffer_size - p_tlv_stream_parser->tlv_object_length))
+                        {
+                            /*
+                             * TLV object is too large for the TLV object buffer, the value octets are reported to the value callback
+                             * (if set) as they are fed, else the value octets are skipped.
+                             */
+                            p_tlv_stream_parser->tlv_remaining_value_length = p_tlv_stream_parser->tlv_object_value_length;
+                            if (p_tlv_stream_parser->p_value_callback)
+                            {
+                                p_tlv_stream_parser->stream_state = TLV_STREAM_STATE_STREAM_VALUE;
+                            }
+                            else
+                            {
+                                p_tlv_stream_parser->stream_state = TLV_STREAM_STATE_SKIP_VALUE;
+                                status = TLV_BAD_DATA_SIZE;
+                            }
+                        }
+                        else if (!p_tlv_stream_parser->tlv_object_value_length)
+                        {
+                            /* Container TLV object, end of contents or TLV object without value octets. */
+                            report_tlv_stream_object(p_tlv_stream_parser, p_tlv_object_start);
+                            reset_tlv_stream_object(p_tlv_stream_parser);
+                        }
+                        else
+                        {
+                            /* Length parsed, now get the value. */
+                            p_tlv_stream_parser->stream_state = TLV_STREAM_STATE_VALUE;
+                            p_tlv_stream_parser->tlv_remaining_value_length = p_tlv_stream_parser->tlv_object_value_length;
+                        }
+                    }
+                }
+
+                if ((TLV_SUCCESS != octet_status) && (TLV_STREAM_MORE_OCTETS != octet_status))
+                {
+                    /*
+                     * Not a valid TLV object, skip the first octet and parse the rest of the tag and length octets again.
+                     * This is a recursive call with less octets, the depth is limited by TLV_STREAM_MAX_HEADER_LENGTH.
+                     */
+                    uint8_t header[TLV_STREAM_MAX_HEADER_LENGTH];
+                    uint32_t header_length = p_tlv_stream_parser->tlv_object_length - 1U;
+                    memcpy(header, &p_tlv_stream_parser->p_tlv_object_buffer[1], header_length);
+
+                    reset_tlv_stream_object(p_tlv_stream_parser);
+                    status = octet_status;
+
+                    octet_status = parse_tlv_stream_data(p_tlv_stream_parser, header, header_length);
+                    status = (TLV_SUCCESS == octet_status) ? status : octet_status;
+
+                    /* The TLV object being parsed (if any) started in the skipped octets. */
+                    p_tlv_object_start = NULL;
+                }
+            }
+            break;
+            case TLV_STREAM_STATE_VALUE:
+            case TLV_STREAM_STATE_SKIP_VALUE:
+            case TLV_STREAM_STATE_STREAM_VALUE:
+            {
+                uint32_t value_length = data_length - data_index;
+                value_length = (value_length > p_tlv_stream_parser->tlv_remaining_value_length) ? p_tlv_stream_parser->tlv_remaining_value_length : value_length;
+
+                if ((TLV_STREAM_STATE_VALUE == p_tlv_stream_parser->stream_state) && (!p_tlv_object_start))
+                {
+                    /* TLV object started in the TLV data fed earlier, keep the value octets in the TLV object buffer. */
+                    memcpy(&p_tlv_stream_parser->p_tlv_object_buffer[p_tlv_stream_parser->tlv_object_length], &p_tlv_data[data_index], value_length);
+                }
+                else if (TLV_STREAM_STATE_STREAM_VALUE == p_tlv_stream_parser->stream_state)
+                {
+                    /* Value octets are reported from the fed TLV data, not kept in the TLV object buffer. */
+                    report_tlv_stream_value(p_tlv_stream_parser, &p_tlv_data[data_index], value_length);
+                }
+                p_tlv_stream_parser->tlv_object_length += value_length;
+                p_tlv_stream_parser->tlv_remaining_value_length -= value_length;
+                data_index += value_length;
+
+                if (!p_tlv_stream_parser->tlv_remaining_value_length)
+                {
+                    if (TLV_STREAM_STATE_VALUE == p_tlv_stream_parser->stream_state)
+                    {
+                        report_tlv_stream_object(p_tlv_stream_parser, p_tlv_object_start);
+                    }
+                    reset_tlv_stream_object(p_tlv_stream_parser);
+                }
+            }
+            break;
+            default:
+            {
+                /* Do nothing. */
+            }
+            break;
+        }
+    }
+
+    /* TLV object is split, keep the value octets received (tag and length octets are already in the TLV object buffer). */
+    if ((TLV_STREAM_STATE_VALUE == p_tlv_stream_parser->stream_state) && (p_tlv_object_start))
+    {
+        uint32_t header_length = p_tlv_stream_parser->tlv_tag_length + p_tlv_stream_parser->tlv_length_octets;
+        memcpy(&p_tlv_stream_parser->p_tlv_object_buffer[header_length], &p_tlv_object_start[header_length],
+            (p_tlv_stream_parser->tlv_object_length - header_length));
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Parse a tag octet of the TLV object. */
+static uint32_t parse_tlv_stream_tag_octet(tlv_stream_parser_t * p_tlv_stream_parser, uint8_t tag_octet)
+{
+    TLV_STATUS status = TLV_BAD_TAG;
+
+    if (!p_tlv_stream_parser->tlv_tag_length)
+    {
+        /* First tag octet, private class tags are not supported. */
+        uint8_t tag_class = (uint8_t)(tag_octet & (uint8_t)TLV_TAG_CLASS_FILTER);
+        if ((TAG_PRIVATE_CLS_PRIMITIVE != tag_class) && (TAG_PRIVATE_CLS_CONSTRUCTED != tag_class))
+        {
+            p_tlv_stream_parser->tlv_tag_length = TAG_1OCTET;
+            p_tlv_stream_parser->b_tlv_constructed_object = (tag_octet & (uint8_t)TAG_UNIVERSAL_CONSTRUCTED) ? TRUE : FALSE;
+            p_tlv_stream_parser->tlv_object_tag_number = (uint32_t)(tag_octet & (uint8_t)TLV_TAG_NUMBER_FILTER);
+
+            if (ONE_OCTET_TAG_MAX == p_tlv_stream_parser->tlv_object_tag_number)
+            {
+                /* Tag number is in the extended tag octets. */
+                p_tlv_stream_parser->tlv_object_tag_number = 0U;
+                status = TLV_STREAM_MORE_OCTETS;
+            }
+            else if ((p_tlv_stream_parser->tlv_object_tag_number) || (!tag_octet))
+            {
+                /* Tag number 0 is only allowed for end of contents. */
+                status = TLV_SUCCESS;
+            }
+        }
+    }
+    else
+    {
+        /* Extended tag octet. */
+        p_tlv_stream_parser->tlv_tag_length++;
+        p_tlv_stream_parser->tlv_object_tag_number = (p_tlv_stream_parser->tlv_object_tag_number << SHIFT_7BIT) | (uint32_t)(tag_octet & EXTENDED_TAG_FILTER);
+
+        if (!(tag_octet & (uint8_t)EXTENDED_TAG))
+        {
+            status = TLV_SUCCESS;
+        }
+        else if (p_tlv_stream_parser->tlv_tag_length < TAG_4OCTET)
+        {
+            status = TLV_STREAM_MORE_OCTETS;
+        }
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Parse a length octet of the TLV object. */
+static uint32_t parse_tlv_stream_length_octet(tlv_stream_parser_t * p_tlv_stream_parser, uint8_t length_octet)
+{
+    TLV_STATUS status = TLV_BAD_BUFFER_LENGTH;
+
+    if (!p_tlv_stream_parser->tlv_length_octets)
+    {
+        /* First length octet. */
+        p_tlv_stream_parser->tlv_length_octets = VALUE_LENGTH_1OCTET;
+
+        if (!(length_octet & (uint8_t)LONG_LENGTH_FORM))
+        {
+            p_tlv_stream_parser->tlv_object_value_length = (uint32_t)length_octet;
+
+            /* End of contents should not have value octets. */
+            status = ((p_tlv_stream_parser->tlv_object_tag_number) || (!length_octet)) ? TLV_SUCCESS : TLV_BAD_TAG;
+        }
+        else
+        {
+            p_tlv_stream_parser->tlv_remaining_length_octets = (uint32_t)(length_octet & (uint8_t)LENGTH_FILTER);
+
+            if (!p_tlv_stream_parser->tlv_remaining_length_octets)
+            {
+                /* Indefinite length, only allowed for constructed container TLV objects. */
+                status = ((TRUE == p_tlv_stream_parser->b_tlv_constructed_object) && (p_tlv_stream_parser->tlv_object_tag_number)) ?
+                    TLV_SUCCESS : TLV_BAD_TAG;
+            }
+            else if (p_tlv_stream_parser->tlv_remaining_length_octets <= VALUE_LENGTH_4OCTET)
+            {
+                status = TLV_STREAM_MORE_OCTETS;
+            }
+        }
+    }
+    else
+    {
+        /* Long form length octet. */
+        p_tlv_stream_parser->tlv_length_octets++;
+        p_tlv_stream_parser->tlv_remaining_length_octets--;
+        p_tlv_stream_parser->tlv_object_value_length = (p_tlv_stream_parser->tlv_object_value_length << SHIFT_8BIT) | (uint32_t)length_octet;
+
+        if (p_tlv_stream_parser->tlv_remaining_length_octets)
+        {
+            status = TLV_STREAM_MORE_OCTETS;
+        }
+        else if ((!p_tlv_stream_parser->tlv_object_tag_number) && (p_tlv_stream_parser->tlv_object_value_length))
+        {
+            /* End of contents should not have value octets. */
+            status = TLV_BAD_TAG;
+        }
+        else if (p_tlv_stream_parser->tlv_object_value_length <= (FIVE_OCTET_MAX_LENGTH - p_tlv_stream_parser->tlv_object_length))
+        {
+            /* The encoded TLV object length should be within 32 bits. */
+            status = TLV_SUCCESS;
+        }
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Report the parsed TLV object to the callback. */
+static void_t report_tlv_stream_object(tlv_stream_parser_t * p_tlv_stream_parser, const uint8_t * p_tlv_object_start)
+{
+    tlv_object_view_t tlv_object_view;
+    uint32_t header_length = p_tlv_stream_parser->tlv_tag_length + p_tlv_stream_parser->tlv_length_octets;
+
+    tlv_object_view.tlv_object_tag_number = p_tlv_stream_parser->tlv_object_tag_number;
+    tlv_object_view.tlv_tag_length = p_tlv_stream_parser->tlv_tag_length;
+    tlv_object_view.tlv_encoded_object_length = p_tlv_stream_parser->tlv_object_length;
+    tlv_object_view.tlv_object_value_length = p_tlv_stream_parser->tlv_object_value_length;
+
+    /* Indefinite length (length octet 0x80) is a container TLV object. */
+    tlv_object_view.b_tlv_container_object = ((VALUE_LENGTH_1OCTET == p_tlv_stream_parser->tlv_length_octets) &&
+        (INDEFINITE_LENGTH == p_tlv_stream_parser->p_tlv_object_buffer[p_tlv_stream_parser->tlv_tag_length])) ? TRUE : FALSE;
+    tlv_object_view.b_tlv_object_length_definite = (TRUE == tlv_object_view.b_tlv_container_object) ? FALSE : TRUE;
+
+    /* TLV object that is in the fed TLV data is not copied. */
+    tlv_object_view.p_tlv_object_encoded_buffer = (p_tlv_object_start) ? p_tlv_object_start : p_tlv_stream_parser->p_tlv_object_buffer;
+    tlv_object_view.p_tlv_value_buffer = (TRUE == tlv_object_view.b_tlv_container_object) ? NULL : &tlv_object_view.p_tlv_object_encoded_buffer[header_length];
+
+    if (p_tlv_stream_parser->p_callback)
+    {
+        p_tlv_stream_parser->p_callback(&tlv_object_view, p_tlv_stream_parser->p_callback_data);
+    }
+}
+
+/* Report the value octets of the TLV object larger than the TLV object buffer to the value callback. */
+static void_t report_tlv_stream_value(tlv_stream_parser_t * p_tlv_stream_parser, const uint8_t * p_value, uint32_t value_length)
+{
+    tlv_object_view_t tlv_object_view;
+    uint32_t header_length = p_tlv_stream_parser->tlv_tag_length + p_tlv_stream_parser->tlv_length_octets;
+
+    tlv_object_view.tlv_object_tag_number = p_tlv_stream_parser->tlv_object_tag_number;
+    tlv_object_view.tlv_tag_length = p_tlv_stream_parser->tlv_tag_length;
+    tlv_object_view.b_tlv_container_object = FALSE;
+    tlv_object_view.b_tlv_object_length_definite = TRUE;
+    tlv_object_view.tlv_encoded_object_length = header_length + p_tlv_stream_parser->tlv_object_value_length;
+    tlv_object_view.tlv_object_value_length = p_tlv_stream_parser->tlv_object_value_length;
+
+    /* Only the tag and length octets are in the TLV object buffer. */
+    tlv_object_view.p_tlv_object_encoded_buffer = p_tlv_stream_parser->p_tlv_object_buffer;
+    tlv_object_view.p_tlv_value_buffer = NULL;
+
+    p_tlv_stream_parser->p_value_callback(&tlv_object_view, p_value,
+        (p_tlv_stream_parser->tlv_object_value_length - p_tlv_stream_parser->tlv_remaining_value_length), value_length, p_tlv_stream_parser->p_callback_data);
+}
+
+/* Reset the parser state to parse the next TLV object. */
+static void_t reset_tlv_stream_object(tlv_stream_parser_t * p_tlv_stream_parser)
+{
+    p_tlv_stream_parser->stream_state = TLV_STREAM_STATE_TAG;
+    p_tlv_stream_parser->tlv_object_tag_number = 0U;
+    p_tlv_stream_parser->tlv_tag_length = 0U;
+    p_tlv_stream_parser->b_tlv_constructed_object = FALSE;
+    p_tlv_stream_parser->tlv_length_octets = 0U;
+    p_tlv_stream_parser->tlv_remaining_length_octets = 0U;
+    p_tlv_stream_parser->tlv_object_value_length = 0U;
+    p_tlv_stream_parser->tlv_remaining_value_length = 0U;
+    p_tlv_stream_parser->tlv_object_length = 0U;
+}
@@ -0,0 +1,29 @@
+/*
+ * Name: tlv_stream_parser.h
+ *
+ * Description:
+ * All definitions required for the TLV stream parser (decoder of TLV data received in chunks).
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#ifndef __TLV_STREAM_PARSER_H__
+#define __TLV_STREAM_PARSER_H__
+
+#include "tlv_port.h"
+
+/* TLV stream parser states. */
+#define TLV_STREAM_STATE_TAG            0x0U
+#define TLV_STREAM_STATE_LENGTH         0x1U
+#define TLV_STREAM_STATE_VALUE          0x2U
+#define TLV_STREAM_STATE_SKIP_VALUE     0x3U
+#define TLV_STREAM_STATE_STREAM_VALUE   0x4U
+
+/* TLV object octet is parsed, more octets are required. */
+#define TLV_STREAM_MORE_OCTETS          0xFFFFFFFEU
+
+/* Maximum tag and length octets of a TLV object (the TLV object buffer should at least hold these octets). */
+#define TLV_STREAM_MAX_HEADER_LENGTH    (TAG_4OCTET + VALUE_LENGTH_5OCTET)
+
+#endif /* __TLV_STREAM_PARSER_H__ */
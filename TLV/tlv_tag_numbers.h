@@ -63,13 +63,14 @@
 
 /* Maximum integer size allowed. */
 #define MAX_INTEGER_BYTES           8U /* CAUTION: Can be 4 OR 8; default 8 */
-#define MAX_UTF8STRING_LENGTH       25U /* CAUTION: Max 65535U. */
+#define MAX_UTF8STRING_LENGTH       25U /* CAUTION: Max APP_TAG_MAX_VALUE_LENGTH. */
 
 
 /********** APPLICATION TAG NUMBERS ***********/
 /* - Application tag numbers are in range <32 to 254> (127). */
 /* - CAUTION: Application should not have tag numbers 0 to 31 to avoid_t conflict with universal tag numbers */
 /* - Application tag numbers are encoded in 2 byte or 3 byte (16 bits or 24 bits) TLV object tags. */
+/* - TLV objects (tlv_api.h) can also have context specific class tag numbers <255 to TAG_MAX_EXTENDED> encoded in 3 byte or 4 byte TLV object tags. */
 
 /*
  * - Application class tag numbers range <32 to 158>.
@@ -92,10 +93,11 @@
  /* Max application tag numbers */
 #define TAG_MAX                     254U /* CAUTION: Do not change the max tags allowed. */
 
-/* Note: more than 2 byte TLV object tags are not supported in this implementation. */
+/* Max tag numbers of TLV objects (4 byte TLV object tags), the tlv app data layer is limited to TAG_MAX. */
+#define TAG_MAX_EXTENDED            2097151U
 
 
 #define MAX_CONTAINER_CHILD_COUNT   10U
-#define APP_TAG_MAX_VALUE_LENGTH    65535U
+#define APP_TAG_MAX_VALUE_LENGTH    16777215U /* CAUTION: Max 4294967286U (tag, length and value octets within 32 bits). */
 
 #endif /* __TLV_TAG_NUMBERS_H__ */
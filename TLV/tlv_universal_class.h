@@ -22,13 +22,16 @@
 #define CHECK_POSITIVE              0x00U
 
 /*
- * Function to create universal class TLV object
- * - if buffer_length == 0; indefinite buffer length
- * - if buffer_length != 0; definite buffer length
- *
- * Note: indefinite buffer length is only allowed for (constructed container TLV objects, not allowed for primitive TLV objects)
+ * Function to create (universal class) integer TLV object.
+ * Note: indefinite buffer length is not allowed for primitive TLV objects (buffer_length should not be 0)
+ */
+uint32_t create_integer_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_buffer, uint32_t buffer_length);
+
+/*
+ * Function to create (universal class) UTF8 string TLV object.
+ * Note: indefinite buffer length is not allowed for primitive TLV objects (buffer_length should not be 0)
  */
-uint32_t create_universal_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_buffer, uint32_t buffer_length);
+uint32_t create_utf8_string_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_buffer, uint32_t buffer_length);
 
 /* Encode the integer value into TLV object. */
 void_t add_data_integer_tlv_object(tlv_object_t * p_tlv_object, const uint8_t * p_tlv_buffer, uint32_t buffer_length);
@@ -9,76 +9,29 @@
  */
 #define TLV_APP_DATA_SOURCE_CODE
 
+#include <string.h>
+
 #include "tlv_api.h"
 #include "tlv_universal_class.h"
+#include "tlv_integer.h"
 #include "tlv_definition.h"
 
-/* Create (universal class) integer TLV object. */
-static uint32_t create_integer_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_buffer, uint32_t buffer_length);
-
-/* Create (universal class) integer TLV object. */
-static uint32_t create_utf8_string_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_buffer, uint32_t buffer_length);
-
 /*
- * Function to create universal class TLV object
- * - if buffer_length == 0; indefinite buffer length
- * - if buffer_length != 0; definite buffer length
- *
- * Note: indefinite length is a option for only for constructed container TLV objects, not allowed for primitive TLV objects
+ * Create (universal class) integer TLV object.
+ * Note: indefinite length is not allowed for primitive TLV objects (buffer_length should not be 0).
  */
-uint32_t create_universal_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_buffer, uint32_t buffer_length)
+uint32_t create_integer_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_buffer, uint32_t buffer_length)
 {
     TLV_STATUS status = TLV_FAIL;
 
-    switch (tlv_tag)
+    /* Check is buffer length is zero, indefinite length in primitive tag number is not allowed. */
+    if (!buffer_length)
     {
-        case TAG_INTEGER:
-        {
-            /* Check is buffer length is zero */
-            if (buffer_length)
-            {
-                /* Definite length TLV object. */
-                p_tlv_object->b_tlv_object_length_definite = TRUE;
-                status = create_integer_tlv_object(p_tlv_object, tlv_tag, p_tlv_buffer, buffer_length);
-            }
-            else
-            {
-                /* Indefinite length in primitive tag number is not allowed. */
-                status = TLV_NOT_A_CONTAINER;
-            }
-        }
-        break;
-        case TAG_UTF8STRING:
-        {
-            /* Check is buffer length is zero */
-            if (buffer_length)
-            {
-                /* Definite length TLV object. */
-                p_tlv_object->b_tlv_object_length_definite = TRUE;
-                status = create_utf8_string_tlv_object(p_tlv_object, tlv_tag, p_tlv_buffer, buffer_length);
-            }
-            else
-            {
-                /* Indefinite length in primitive tag number is not allowed. */
-                status = TLV_NOT_A_CONTAINER;
-            }
-        }
-        break;
-        default:
-        {
-            /* do nothing */
-            status = TLV_TAG_NOT_SUPPORTED;
-        }
+        return TLV_NOT_A_CONTAINER;
     }
 
-    return status;
-}
-
-
-/* Create (universal class) integer TLV object. */
-static uint32_t create_integer_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_buffer, uint32_t buffer_length)
-{
-    TLV_STATUS status = TLV_FAIL;
+    /* Definite length TLV object. */
+    p_tlv_object->b_tlv_object_length_definite = TRUE;
 
     /* Encode a integer TLV object. */
 
@@ -86,7 +39,7 @@ static uint32_t create_integer_tlv_object(tlv_object_t * p_tlv_object, uint32_t
 
     uint8_t tlv_encoded_buffer_length = (uint8_t)UNIVERSAL_TAG_LENGTH + (uint8_t)VALUE_LENGTH_1OCTET + (uint8_t)MAX_INTEGER_BYTES;
     p_tlv_object->p_tlv_object_encoded_buffer = NULL;
-    p_tlv_object->p_tlv_object_encoded_buffer = (uint8_t *)calloc(tlv_encoded_buffer_length, sizeof(uint8_t));
+    p_tlv_object->p_tlv_object_encoded_buffer = (uint8_t *)allocate_tlv_memory(p_tlv_object->p_tlv_arena, tlv_encoded_buffer_length);
 
     if (p_tlv_object->p_tlv_object_encoded_buffer != NULL)
     {
@@ -137,11 +90,23 @@ static uint32_t create_integer_tlv_object(tlv_object_t * p_tlv_object, uint32_t
 }
 
 
-/* Create (universal class) integer TLV object. */
-static uint32_t create_utf8_string_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_buffer, uint32_t buffer_length)
+/*
+ * Create (universal class) UTF8 string TLV object.
+ * Note: indefinite length is not allowed for primitive TLV objects (buffer_length should not be 0).
+ */
+uint32_t create_utf8_string_tlv_object(tlv_object_t * p_tlv_object, uint32_t tlv_tag, const uint8_t * p_tlv_buffer, uint32_t buffer_length)
 {
     TLV_STATUS status = TLV_FAIL;
 
+    /* Check is buffer length is zero, indefinite length in primitive tag number is not allowed. */
+    if (!buffer_length)
+    {
+        return TLV_NOT_A_CONTAINER;
+    }
+
+    /* Definite length TLV object. */
+    p_tlv_object->b_tlv_object_length_definite = TRUE;
+
     /* encode the UTF8 STRING TLV object. */
 
     /* Allocate the TLV encoder buffer. */
@@ -151,7 +116,7 @@ static uint32_t create_utf8_string_tlv_object(tlv_object_t * p_tlv_object, uint3
 
     uint32_t tlv_encoded_buffer_length = UNIVERSAL_TAG_LENGTH + length_octets + buffer_length;
     p_tlv_object->p_tlv_object_encoded_buffer = NULL;
-    p_tlv_object->p_tlv_object_encoded_buffer = (uint8_t *)calloc(tlv_encoded_buffer_length, sizeof(uint8_t));
+    p_tlv_object->p_tlv_object_encoded_buffer = (uint8_t *)allocate_tlv_memory(p_tlv_object->p_tlv_arena, tlv_encoded_buffer_length);
 
     if (p_tlv_object->p_tlv_object_encoded_buffer != NULL)
     {
@@ -205,27 +170,9 @@ static uint32_t create_utf8_string_tlv_object(tlv_object_t * p_tlv_object, uint3
 /* Encode the integer value into TLV object. */
 void_t add_data_integer_tlv_object(tlv_object_t * p_tlv_object, const uint8_t * p_tlv_buffer, uint32_t buffer_length)
 {
-    uint32_t int_value_octet_count = buffer_length;
-    bool_t b_set_negative_bit = FALSE;
-
-    /* if the integer is -ve or +ve */
-    if (p_tlv_buffer[int_value_octet_count - 1U] == 0xFF)
-    {
-        b_set_negative_bit = TRUE;
-    }
-
-    /* get the number octets to encode for the integer value. */
-    for (; int_value_octet_count > 1; int_value_octet_count--)
-    {
-        if (((uint8_t)CHECK_POSITIVE == p_tlv_buffer[(int_value_octet_count - 1U)]) || ((uint8_t)CHECK_NEGATIVE == p_tlv_buffer[(int_value_octet_count - 1)]))
-        {
-            /* Do nothing. */
-        }
-        else
-        {
-            break;
-        }
-    }
+    /* get the integer value and the number octets to encode the integer value. */
+    int64_t int_value = load_integer_value(p_tlv_buffer, buffer_length);
+    uint32_t int_value_octet_count = get_integer_octet_count(int_value);
 
     /* Add length of the tag value */
     p_tlv_object->p_tlv_object_encoded_buffer[p_tlv_object->tlv_tag_length] = (uint8_t)int_value_octet_count;
@@ -238,25 +185,9 @@ void_t add_data_integer_tlv_object(tlv_object_t * p_tlv_object, const uint8_t *
     /* Save current length of the value. */
     p_tlv_object->tlv_curr_object_value_length = int_value_octet_count;
 
-    /* Copy the TLV encoded value */
-    for (uint32_t i = 0; i < p_tlv_object->tlv_max_object_value_length; i++)
-    {
-        if (i < p_tlv_object->tlv_curr_object_value_length)
-        {
-            p_tlv_object->p_tlv_value_buffer[(i)] = p_tlv_buffer[i];
-
-            if ((p_tlv_object->tlv_curr_object_value_length == (i + 1U)) && b_set_negative_bit)
-            {
-                /* set -ve if not set already */
-                p_tlv_object->p_tlv_value_buffer[i] |= (uint8_t)(1U << OCTET_SIGNED_BIT);
-            }
-        }
-        else
-        {
-            /* Stuff zeros in empty TLV buffer space. */
-            p_tlv_object->p_tlv_value_buffer[(i)] = (uint8_t)0x0U;
-        }
-    }
+    /* Encode the integer value octets, stuff zeros in empty TLV buffer space. */
+    encode_integer_octets(p_tlv_object->p_tlv_value_buffer, int_value, int_value_octet_count);
+    memset(&p_tlv_object->p_tlv_value_buffer[int_value_octet_count], 0, (p_tlv_object->tlv_max_object_value_length - int_value_octet_count));
 }
 
 
@@ -266,35 +197,8 @@ void_t add_data_universal_tlv_object(tlv_object_t * p_tlv_object, const uint8_t
     uint32_t length_octets = 0U;
     length_octets = get_length_octets(buffer_length);
 
-    switch (length_octets)
-    {
-        case VALUE_LENGTH_1OCTET:
-        {
-            /* Add length of the tag value. */
-            p_tlv_object->p_tlv_object_encoded_buffer[p_tlv_object->tlv_tag_length] = (uint8_t)buffer_length;
-        }
-        break;
-        case VALUE_LENGTH_2OCTET:
-        {
-            /* Add length of the tag value. */
-            p_tlv_object->p_tlv_object_encoded_buffer[p_tlv_object->tlv_tag_length] = (uint8_t)LONG_LENGTH_FORM | (uint8_t)VALUE_LENGTH_1OCTET;
-            p_tlv_object->p_tlv_object_encoded_buffer[(p_tlv_object->tlv_tag_length + 1U)] = (uint8_t)buffer_length;
-        }
-        break;
-        case VALUE_LENGTH_3OCTET:
-        {
-            /* Add length of the tag value. */
-            p_tlv_object->p_tlv_object_encoded_buffer[p_tlv_object->tlv_tag_length] = (uint8_t)LONG_LENGTH_FORM | (uint8_t)VALUE_LENGTH_2OCTET;
-            p_tlv_object->p_tlv_object_encoded_buffer[(p_tlv_object->tlv_tag_length + 1U)] = (uint8_t)((buffer_length & MASK_BIT_8_TO_15) >> SHIFT_8BIT);
-            p_tlv_object->p_tlv_object_encoded_buffer[(p_tlv_object->tlv_tag_length + 2U)] = (uint8_t)(buffer_length & MASK_BIT_0_TO_7);
-        }
-        break;
-        default:
-        {
-            /* do nothing. */
-            /* validity of the buffer length is checked in error check functions. */
-        }
-    }
+    /* Add length of the tag value. */
+    (void_t)encode_length_octets(&p_tlv_object->p_tlv_object_encoded_buffer[p_tlv_object->tlv_tag_length], buffer_length);
 
     /* Save start of value buffer. */
     p_tlv_object->p_tlv_value_buffer = &(p_tlv_object->p_tlv_object_encoded_buffer[(p_tlv_object->tlv_tag_length + length_octets)]);
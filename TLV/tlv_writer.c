@@ -0,0 +1,257 @@
+/*
+ * Name: tlv_writer.c
+ *
+ * Description:
+ * All API definitions required for the TLV writer (one pass encoder into the application provided TLV data buffer).
+ *
+ * Author: Hemant Pundpal                                   Date: 19 Oct 2026
+ *
+ */
+
+#define TLV_OBJECT_SOURCE_CODE
+
+#include <string.h>
+
+#include "tlv_api.h"
+#include "tlv.h"
+#include "tlv_universal_class.h"
+#include "tlv_integer.h"
+#include "tlv_definition.h"
+
+/* Encode the tag and length octets of a definite length TLV object, if the TLV object fits in the TLV data buffer. */
+static uint32_t write_tlv_object_header(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, uint32_t value_length);
+
+/* Function to initialize the TLV writer to encode TLV objects into the TLV data buffer. */
+uint32_t tlv_writer_init(tlv_writer_t * p_tlv_writer, uint8_t * p_tlv_data_buffer, uint32_t buffer_size)
+{
+    p_tlv_writer->p_tlv_data_buffer = p_tlv_data_buffer;
+    p_tlv_writer->buffer_size = buffer_size;
+    p_tlv_writer->encoded_length = 0U;
+    p_tlv_writer->container_depth = 0U;
+
+    /* Return status. */
+    return TLV_SUCCESS;
+}
+
+/* Function to encode an integer TLV object. */
+uint32_t tlv_writer_add_integer(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_value, uint32_t value_length)
+{
+    TLV_STATUS status = TLV_FAIL;
+
+    /* get the integer value and the number octets to encode the integer value. */
+    int64_t int_value = load_integer_value(p_value, value_length);
+    uint32_t int_value_octet_count = get_integer_octet_count(int_value);
+
+    status = write_tlv_object_header(p_tlv_writer, tlv_tag, int_value_octet_count);
+    if (TLV_SUCCESS == status)
+    {
+        /* Encode the integer value octets. */
+        encode_integer_octets(&p_tlv_writer->p_tlv_data_buffer[p_tlv_writer->encoded_length], int_value, int_value_octet_count);
+        p_tlv_writer->encoded_length += int_value_octet_count;
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to encode an array of integer TLV objects of the tag (e.g. the child TLV objects of a SEQUENCE OF INTEGER). */
+uint32_t tlv_writer_add_integer_array(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_values, uint32_t value_size,
+    uint32_t value_count)
+{
+    TLV_STATUS status = TLV_SUCCESS;
+    uint8_t tag_octets[TAG_4OCTET];
+
+    /* The tag octets are encoded once, each integer TLV object has one length octet. */
+    uint32_t tag_length = encode_tag_octets(tag_octets, tlv_tag);
+
+    for (uint32_t i = 0U; i < value_count; i++)
+    {
+        int64_t int_value = load_integer_value(&p_values[i * value_size], value_size);
+        uint32_t int_value_octet_count = get_integer_octet_count(int_value);
+
+        if ((p_tlv_writer->encoded_length + tag_length + VALUE_LENGTH_1OCTET + int_value_octet_count) > p_tlv_writer->buffer_size)
+        {
+            /* The integer TLV objects encoded so far are kept. */
+            status = TLV_BAD_BUFFER_LENGTH;
+            break;
+        }
+
+        uint8_t * p_encoded_buffer = &p_tlv_writer->p_tlv_data_buffer[p_tlv_writer->encoded_length];
+        memcpy(p_encoded_buffer, tag_octets, tag_length);
+        p_encoded_buffer[tag_length] = (uint8_t)int_value_octet_count;
+        encode_integer_octets(&p_encoded_buffer[tag_length + VALUE_LENGTH_1OCTET], int_value, int_value_octet_count);
+        p_tlv_writer->encoded_length += (tag_length + VALUE_LENGTH_1OCTET + int_value_octet_count);
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to encode a TLV object with the value octets. */
+uint32_t tlv_writer_add_value(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, const uint8_t * p_value, uint32_t value_length)
+{
+    TLV_STATUS status = TLV_FAIL;
+
+    status = write_tlv_object_header(p_tlv_writer, tlv_tag, value_length);
+    if (TLV_SUCCESS == status)
+    {
+        /* Copy the value octets. */
+        memcpy(&p_tlv_writer->p_tlv_data_buffer[p_tlv_writer->encoded_length], p_value, value_length);
+        p_tlv_writer->encoded_length += value_length;
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to open a container TLV object. */
+uint32_t tlv_writer_open_container(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, bool_t b_length_definite)
+{
+    TLV_STATUS status = TLV_FAIL;
+    uint32_t tag_octets = get_tag_octets(tlv_tag);
+
+    if (TLV_WRITER_MAX_CONTAINER_DEPTH <= p_tlv_writer->container_depth)
+    {
+        status = TLV_MAX_CONTAINER_DEPTH;
+    }
+    else if ((p_tlv_writer->encoded_length + tag_octets + VALUE_LENGTH_1OCTET) > p_tlv_writer->buffer_size)
+    {
+        status = TLV_BAD_BUFFER_LENGTH;
+    }
+    else
+    {
+        uint8_t * p_encoded_buffer = &p_tlv_writer->p_tlv_data_buffer[p_tlv_writer->encoded_length];
+        (void_t)encode_tag_octets(p_encoded_buffer, tlv_tag);
+
+        /*
+         * Indefinite length is encoded now, for definite length one length octet is reserved and the length
+         * is encoded when the container is closed.
+         */
+        p_encoded_buffer[tag_octets] = (uint8_t)INDEFINITE_LENGTH;
+        p_tlv_writer->encoded_length += (tag_octets + VALUE_LENGTH_1OCTET);
+
+        p_tlv_writer->container_value_index[p_tlv_writer->container_depth] = p_tlv_writer->encoded_length;
+        p_tlv_writer->b_container_length_definite[p_tlv_writer->container_depth] = b_length_definite;
+        p_tlv_writer->container_depth++;
+
+        status = TLV_SUCCESS;
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to close the last opened container TLV object. */
+uint32_t tlv_writer_close_container(tlv_writer_t * p_tlv_writer)
+{
+    TLV_STATUS status = TLV_FAIL;
+
+    if (!p_tlv_writer->container_depth)
+    {
+        /* No container is open. */
+        return TLV_NOT_A_CONTAINER;
+    }
+
+    uint32_t value_index = p_tlv_writer->container_value_index[p_tlv_writer->container_depth - 1U];
+
+    if (FALSE == p_tlv_writer->b_container_length_definite[p_tlv_writer->container_depth - 1U])
+    {
+        /* Encode the end of contents octets. */
+        if ((p_tlv_writer->encoded_length + VALUE_LENGTH_2OCTET) <= p_tlv_writer->buffer_size)
+        {
+            p_tlv_writer->p_tlv_data_buffer[p_tlv_writer->encoded_length] = (uint8_t)TAG_END_OF_CONTENT;
+            p_tlv_writer->p_tlv_data_buffer[p_tlv_writer->encoded_length + 1U] = (uint8_t)TAG_END_OF_CONTENT;
+            p_tlv_writer->encoded_length += VALUE_LENGTH_2OCTET;
+            status = TLV_SUCCESS;
+        }
+        else
+        {
+            status = TLV_BAD_BUFFER_LENGTH;
+        }
+    }
+    else
+    {
+        uint32_t value_length = p_tlv_writer->encoded_length - value_index;
+        uint32_t length_octets = get_length_octets(value_length);
+
+        if (!length_octets)
+        {
+            /* Value length is more than the max value length. */
+            status = TLV_BAD_DATA_SIZE;
+        }
+        else if ((p_tlv_writer->encoded_length + length_octets - VALUE_LENGTH_1OCTET) > p_tlv_writer->buffer_size)
+        {
+            status = TLV_BAD_BUFFER_LENGTH;
+        }
+        else
+        {
+            /* Move the child TLV objects if more than the reserved length octet is required. */
+            if (VALUE_LENGTH_1OCTET < length_octets)
+            {
+                memmove(&p_tlv_writer->p_tlv_data_buffer[value_index + length_octets - VALUE_LENGTH_1OCTET],
+                    &p_tlv_writer->p_tlv_data_buffer[value_index], value_length);
+                p_tlv_writer->encoded_length += (length_octets - VALUE_LENGTH_1OCTET);
+            }
+            (void_t)encode_length_octets(&p_tlv_writer->p_tlv_data_buffer[value_index - VALUE_LENGTH_1OCTET], value_length);
+            status = TLV_SUCCESS;
+        }
+    }
+
+    if (TLV_SUCCESS == status)
+    {
+        p_tlv_writer->container_depth--;
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Function to get the number of encoded octets in the TLV data buffer. */
+uint32_t tlv_writer_finish(tlv_writer_t * p_tlv_writer, uint32_t * p_encoded_length)
+{
+    TLV_STATUS status = TLV_FAIL;
+
+    if (p_tlv_writer->container_depth)
+    {
+        /* All containers should be closed. */
+        status = TLV_CONTAINER_OPEN;
+    }
+    else
+    {
+        *p_encoded_length = p_tlv_writer->encoded_length;
+        status = TLV_SUCCESS;
+    }
+
+    /* Return status. */
+    return status;
+}
+
+/* Encode the tag and length octets of a definite length TLV object, if the TLV object fits in the TLV data buffer. */
+static uint32_t write_tlv_object_header(tlv_writer_t * p_tlv_writer, uint32_t tlv_tag, uint32_t value_length)
+{
+    TLV_STATUS status = TLV_FAIL;
+    uint32_t tag_octets = (tlv_tag <= TAG_MAX_UNIVERSAL) ? TAG_1OCTET : get_tag_octets(tlv_tag);
+    uint32_t length_octets = get_length_octets(value_length);
+
+    if (!length_octets)
+    {
+        /* Value length is more than the max value length. */
+        status = TLV_BAD_DATA_SIZE;
+    }
+    else if ((p_tlv_writer->encoded_length + tag_octets + length_octets + value_length) > p_tlv_writer->buffer_size)
+    {
+        status = TLV_BAD_BUFFER_LENGTH;
+    }
+    else
+    {
+        uint8_t * p_encoded_buffer = &p_tlv_writer->p_tlv_data_buffer[p_tlv_writer->encoded_length];
+        (void_t)encode_tag_octets(p_encoded_buffer, tlv_tag);
+        (void_t)encode_length_octets(&p_encoded_buffer[tag_octets], value_length);
+        p_tlv_writer->encoded_length += (tag_octets + length_octets);
+
+        status = TLV_SUCCESS;
+    }
+
+    /* Return status. */
+    return status;
+}